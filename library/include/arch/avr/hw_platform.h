@@ -12,8 +12,12 @@
 
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include <avr/pgmspace.h>
 #include <util/delay.h>
 
+/** Place data in RAM not initialized at startup, i.e. preserved over warm resets. */
+#define NOINIT __attribute__((section(".noinit")))
+
 /** When compiling for the test suite, include test hardware platform header instead. */
 #else
 #include "arch/test/hw_platform.h"
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 namespace test
@@ -262,6 +263,13 @@ void delay_us(std::uint16_t us) noexcept;
 #define TCNT5   test::Memory::data.reg16[96U]
 #define OCR5B   test::Memory::data.reg16[97U]
 
+#define TWCR     test::Memory::data.reg8[196U]
+#define ASSR     test::Memory::data.reg8[197U]
+#define SP       test::Memory::data.reg16[99U]
+
+/** Address of the last byte of the internal SRAM. */
+#define RAMEND   0x08FFU
+
 /** Mapping of AVR register bits and flags. */
 #define I_FLAG 7U
 #define WDP0   0U
@@ -271,6 +279,11 @@ void delay_us(std::uint16_t us) noexcept;
 #define WDCE   4U
 #define WDE    3U
 #define WDRF   3U
+#define PORF   0U
+#define EXTRF  1U
+#define BORF   2U
+#define WDIE   6U
+#define WDIF   7U
 
 #define REFS0  6U
 #define ADEN   7U
@@ -280,13 +293,69 @@ void delay_us(std::uint16_t us) noexcept;
 #define ADPS2  2U
 #define ADIF   4U
 
+#define CS00   0U
 #define CS01   1U
+#define CS02   2U
+#define CS10   0U
 #define CS11   1U
+#define CS12   2U
+#define CS20   0U
 #define CS21   1U
+#define CS22   2U
+#define WGM01  1U
 #define WGM12  3U
+#define WGM21  1U
 #define TOIE0  0U
+#define OCIE0A 1U
 #define OCIE1A 1U
 #define TOIE2  0U
+#define OCIE2A 1U
+#define TOV0   0U
+#define OCF0A  1U
+#define OCF1A  1U
+#define TOV2   0U
+#define OCF2A  1U
+#define WGM00  0U
+#define WGM10  0U
+#define WGM11  1U
+#define WGM13  4U
+#define WGM20  0U
+#define COM0A1 7U
+#define COM0B1 5U
+#define COM1A1 7U
+#define COM1B1 5U
+#define COM2A1 7U
+#define COM2B1 5U
+#define ICNC1  7U
+#define ICES1  6U
+#define TOIE1  0U
+#define ICIE1  5U
+#define TOV1   0U
+#define ICF1   5U
+
+#define SE     0U
+#define SM0    1U
+#define SM1    2U
+#define SM2    3U
+
+#define PRADC    0U
+#define PRUSART0 1U
+#define PRSPI    2U
+#define PRTIM1   3U
+#define PRTIM0   5U
+#define PRTIM2   6U
+#define PRTWI    7U
+
+#define SPE    6U
+#define TWEN   2U
+#define AS2    5U
+
+#define INT0   0U
+#define INT1   1U
+#define ISC00  0U
+#define ISC01  1U
+#define ISC10  2U
+#define ISC11  3U
 
 #define UDRE0  5U
 #define RXEN0  4U
@@ -294,6 +363,10 @@ void delay_us(std::uint16_t us) noexcept;
 #define UCSZ00 1U
 #define UCSZ01 2U
 #define RXC0   7U
+#define TXC0   6U
+#define U2X0   1U
+#define MPCM0  0U
+#define RXCIE0 7U
 
 #define EEPE  1U
 #define EEMPE 2U
@@ -311,4 +384,16 @@ void delay_us(std::uint16_t us) noexcept;
 /** Implement interrupt service routines as functions. */
 #define ISR(vector) void vector() noexcept
 
+/** Place constant data in program memory (ordinary memory when testing). */
+#define PROGMEM
+
+/** Read a 16-bit word from program memory. */
+#define pgm_read_word(addr) (*(addr))
+
+/** Copy data from program memory. */
+#define memcpy_P(dest, src, size) memcpy((dest), (src), (size))
+
+/** Place data in RAM not initialized at startup (ordinary memory when testing). */
+#define NOINIT
+
 #endif /** TESTSUITE */
\ No newline at end of file
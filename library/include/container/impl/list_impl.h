@@ -21,8 +21,8 @@ struct List<T>::Node
     Node* next;     // Pointer to next data.
     T data;         // Data the node holds.
 
-    static Node* create(const T& data) noexcept;
-    static void destroy(Node* self) noexcept;
+    static Node* create(const T& data, memory::allocator::Interface* allocator) noexcept;
+    static void destroy(Node* self, memory::allocator::Interface* allocator) noexcept;
     static Node* get(Iterator& iterator) noexcept;
     static const Node* get(ConstIterator& iterator) noexcept;
 };
@@ -32,7 +32,16 @@ template <typename T>
 List<T>::List() noexcept
     : myFirst{nullptr}
     , myLast{nullptr}
-    , mySize{nullptr} {}
+    , mySize{}
+    , myAllocator{nullptr} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+List<T>::List(memory::allocator::Interface& allocator) noexcept
+    : List()
+{
+    myAllocator = &allocator;
+}
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -46,6 +55,7 @@ List<T>::List(const size_t size, const T& startValue) noexcept
 template <typename T>
 template <typename... Values> 
 List<T>::List(const Values&&... values) noexcept
+    : List()
 { 
     const T array[sizeof...(values)]{(values)...};
     addValues(array);
@@ -60,6 +70,7 @@ template <typename T>
 List<T>::List(const List<T>& other) noexcept
     : List()
 {
+    myAllocator = other.myAllocator;
     copy(other);
 }
 
@@ -69,6 +80,7 @@ List<T>::List(List<T>&& other) noexcept
     : myFirst{other.myFirst}
     , myLast{other.myLast}
     , mySize{other.mySize}
+    , myAllocator{other.myAllocator}
 {
     other.myFirst = nullptr;
     other.myLast  = nullptr;
@@ -92,6 +104,7 @@ List<T>& List<T>::operator=(List<T>&& other) noexcept
     myFirst = other.myFirst;
     myLast  = other.myLast;
     mySize  = other.mySize;
+    myAllocator = other.myAllocator;
 
     other.myFirst = nullptr;
     other.myLast  = nullptr;
@@ -202,7 +215,7 @@ bool List<T>::resize(const size_t newSize, const T& startValue) noexcept
 template <typename T>
 bool List<T>::pushFront(const T& value) noexcept
 {
-    auto node1{Node::create(value)};
+    auto node1{Node::create(value, myAllocator)};
     if (node1 == nullptr) { return false; }
 
     if (mySize++ == 0U) 
@@ -224,7 +237,7 @@ bool List<T>::pushFront(const T& value) noexcept
 template <typename T>
 bool List<T>::pushBack(const T& value) noexcept
 {
-    auto node2{Node::create(value)};
+    auto node2{Node::create(value, myAllocator)};
     if (node2 == nullptr) { return false; }  
 
     if (mySize++ == 0U) 
@@ -247,7 +260,7 @@ template <typename T>
 bool List<T>::insert(Iterator& iterator, const T& value) noexcept
 {
     if (iterator == nullptr) {  return false; }
-    auto node2{Node::create(value)};
+    auto node2{Node::create(value, myAllocator)};
     if (node2 == nullptr) return false;   
     auto node1{Node::get(iterator)->previous};
     auto node3{node1->next};
@@ -270,7 +283,7 @@ void List<T>::popFront() noexcept
         auto node1{myFirst};
         auto node2{node1->next};
         node2->previous = nullptr;
-        Node::destroy(node1);
+        Node::destroy(node1, myAllocator);
         myFirst = node2;
         mySize--;
     }
@@ -286,7 +299,7 @@ void List<T>::popBack() noexcept
         auto node2{myLast};
         auto node1{node2->previous};
         node1->next = nullptr;     
-        Node::destroy(node2);
+        Node::destroy(node2, myAllocator);
         myLast = node1;
         mySize--;
     }
@@ -304,7 +317,7 @@ bool List<T>::remove(Iterator& iterator) noexcept
         auto node3{node2->next};
         node1->next = node3;
         node3->previous = node1;
-        Node::destroy(node2);
+        Node::destroy(node2, myAllocator);
         mySize--;
         return true;
     }
@@ -352,16 +365,17 @@ void List<T>::removeAllNodes() noexcept
     for (auto i{begin()}; i != end();) 
     {
         auto next{Node::get(i)->next};
-        Node::destroy(Node::get(i));
+        Node::destroy(Node::get(i), myAllocator);
         i = next;
     }
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-typename List<T>::Node* List<T>::Node::create(const T& data) noexcept
+typename List<T>::Node* List<T>::Node::create(const T& data, 
+                                              memory::allocator::Interface* allocator) noexcept
 {
-    auto self{utils::newMemory<Node>()};
+    auto self{utils::newMemory<Node>(1U, allocator)};
     if (self == nullptr) { return nullptr; }
     self->data     = data;
     self->previous = nullptr;
@@ -371,7 +385,10 @@ typename List<T>::Node* List<T>::Node::create(const T& data) noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T>
-void List<T>::Node::destroy(Node* self) noexcept { utils::deleteMemory(self); }
+void List<T>::Node::destroy(Node* self, memory::allocator::Interface* allocator) noexcept 
+{ 
+    utils::deleteMemory(self, allocator); 
+}
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -0,0 +1,67 @@
+/**
+ * @brief Implementation details of container::RingBuffer class.
+ * 
+ * @note Don't include this header, use <ring_buffer.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Size>
+RingBuffer<T, Size>::RingBuffer() noexcept
+    : myData{}
+    , myHead{}
+    , myTail{}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Size>
+constexpr uint8_t RingBuffer<T, Size>::capacity() noexcept { return Size; }
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Size>
+uint8_t RingBuffer<T, Size>::size() const noexcept 
+{ 
+    // The indexes wrap around at 256, which is a multiple of the size.
+    return static_cast<uint8_t>(myHead - myTail); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Size>
+bool RingBuffer<T, Size>::isEmpty() const noexcept { return myHead == myTail; }
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Size>
+bool RingBuffer<T, Size>::isFull() const noexcept { return Size == size(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Size>
+bool RingBuffer<T, Size>::push(const T& value) noexcept
+{
+    if (isFull()) { return false; }
+
+    // Store the value before publishing it by updating the write index.
+    const uint8_t head{myHead};
+    myData[head & (Size - 1U)] = value;
+    myHead = static_cast<uint8_t>(head + 1U);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Size>
+bool RingBuffer<T, Size>::pop(T& value) noexcept
+{
+    if (isEmpty()) { return false; }
+
+    // Read the value before releasing the slot by updating the read index.
+    const uint8_t tail{myTail};
+    value  = myData[tail & (Size - 1U)];
+    myTail = static_cast<uint8_t>(tail + 1U);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Size>
+void RingBuffer<T, Size>::clear() noexcept { myTail = myHead; }
+} // namespace container
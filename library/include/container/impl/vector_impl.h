@@ -13,7 +13,16 @@ namespace container
 template <typename T>
 Vector<T>::Vector() noexcept
     : myData{nullptr}
-    , mySize{} {}
+    , mySize{}
+    , myAllocator{nullptr} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+Vector<T>::Vector(memory::allocator::Interface& allocator) noexcept
+    : Vector()
+{
+    myAllocator = &allocator;
+}
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -38,6 +47,7 @@ template <typename T>
 Vector<T>::Vector(const Vector<T>& other) noexcept
     : Vector()
 { 
+    myAllocator = other.myAllocator;
     copy(other); 
 }
 
@@ -48,6 +58,7 @@ Vector<T>::Vector(Vector&& other) noexcept
 {
     myData       = other.myData;
     mySize       = other.mySize;
+    myAllocator  = other.myAllocator;
     other.myData = nullptr;
     other.mySize = 0U;
 }
@@ -75,6 +86,7 @@ Vector<T>& Vector<T>::operator=(Vector<T>&& other) noexcept
     clear();
     myData       = other.myData;
     mySize       = other.mySize;
+    myAllocator  = other.myAllocator;
     other.myData = nullptr;
     other.mySize = 0U;
     return *this;
@@ -198,7 +210,7 @@ const T* Vector<T>::last() const noexcept { return mySize > 0U ? end() - 1U : nu
 template <typename T>
 void Vector<T>::clear() noexcept 
 {
-    utils::deleteMemory<T>(myData);
+    utils::deleteMemory<T>(myData, myAllocator);
     myData = nullptr;
     mySize = 0U;
 }
@@ -207,7 +219,7 @@ void Vector<T>::clear() noexcept
 template <typename T>
 bool Vector<T>::resize(const size_t newSize) noexcept 
 {
-    auto copy{utils::reallocMemory<T>(myData, newSize)};
+    auto copy{utils::reallocMemory<T>(myData, newSize, myAllocator)};
     if (copy == nullptr) { return false; }
     myData = copy;
     mySize = newSize;
@@ -5,6 +5,8 @@
 
 #include <stddef.h>
 
+#include "memory/allocator/interface.h"
+
 namespace container 
 {
 /**
@@ -27,6 +29,13 @@ public:
      */
     explicit List() noexcept;
 
+    /**
+     * @brief Create empty list allocating its nodes via given allocator.
+     *
+     * @param[in] allocator Reference to the allocator to use instead of the heap.
+     */
+    explicit List(memory::allocator::Interface& allocator) noexcept;
+
     /**
      * @brief Create list of given size initialized with given start value.
      *
@@ -52,6 +61,8 @@ public:
 
     /**
      * @brief Create list as a copy of another list.
+     * 
+     *        The new list uses the same allocator as the other list.
      *
      * @param[in] other Reference to other list to copy from.
      */
@@ -60,7 +71,8 @@ public:
     /**
      * @brief Move memory from another list.
      * 
-     *        The other list is emptied once the move operation is completed.
+     *        The other list is emptied once the move operation is completed, the allocator
+     *        of the other list is taken over.
      *
      * @param[in] other Reference to other list to move memory from.
      */
@@ -280,6 +292,9 @@ protected:
 
     /** The size of the list in number of nodes. */
     size_t mySize;
+
+    /** Pointer to the allocator holding the nodes, or nullptr if the nodes are held on the heap. */
+    memory::allocator::Interface* myAllocator;
 };
 } // namespace container
 
@@ -0,0 +1,112 @@
+/**
+ * @brief Implementation of ring buffers of any type.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace container
+{
+/**
+ * @brief Class for implementation of ring buffers.
+ * 
+ *        The buffer is lock-free for a single producer and a single consumer, such as an ISR 
+ *        pushing values and the main loop popping them. The read and write indexes are 8-bit,
+ *        so they're updated atomically without disabling interrupts.
+ * 
+ * @tparam T    The buffer type.
+ * @tparam Size The buffer size. Must be a power of two between 2 - 128.
+ */
+template <typename T, uint8_t Size>
+class RingBuffer
+{
+    // Generate a compiler error if the buffer size is invalid.
+    static_assert((1U < Size) && (128U >= Size) && (0U == (Size & (Size - 1U))), 
+        "Ring buffer size must be a power of two between 2 - 128!");
+
+public:
+    /**
+     * @brief Create empty ring buffer.
+     */
+    RingBuffer() noexcept;
+
+    /**
+     * @brief Delete ring buffer.
+     */
+    ~RingBuffer() noexcept = default;
+
+    /**
+     * @brief Get the capacity of the buffer.
+     * 
+     * @return The max number of values the buffer can hold.
+     */
+    static constexpr uint8_t capacity() noexcept;
+
+    /**
+     * @brief Get the number of values in the buffer.
+     * 
+     * @return The number of values in the buffer.
+     */
+    uint8_t size() const noexcept;
+
+    /**
+     * @brief Check whether the buffer is empty.
+     * 
+     * @return True if the buffer is empty, false otherwise.
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * @brief Check whether the buffer is full.
+     * 
+     * @return True if the buffer is full, false otherwise.
+     */
+    bool isFull() const noexcept;
+
+    /**
+     * @brief Push value to the back of the buffer.
+     * 
+     *        Only call this method from the producer.
+     * 
+     * @param[in] value The value to push.
+     * 
+     * @return True if the value was pushed, false if the buffer is full.
+     */
+    bool push(const T& value) noexcept;
+
+    /**
+     * @brief Pop value from the front of the buffer.
+     * 
+     *        Only call this method from the consumer.
+     * 
+     * @param[out] value Reference to variable to store the popped value.
+     * 
+     * @return True if a value was popped, false if the buffer is empty.
+     */
+    bool pop(T& value) noexcept;
+
+    /**
+     * @brief Clear the buffer.
+     * 
+     *        Only call this method from the consumer.
+     */
+    void clear() noexcept;
+
+    RingBuffer(const RingBuffer&)            = delete; // No copy constructor.
+    RingBuffer(RingBuffer&&)                 = delete; // No move constructor.
+    RingBuffer& operator=(const RingBuffer&) = delete; // No copy assignment.
+    RingBuffer& operator=(RingBuffer&&)      = delete; // No move assignment.
+
+private:
+    /** Buffer values. */
+    T myData[Size];
+
+    /** Free-running write index, only updated by the producer. */
+    volatile uint8_t myHead;
+
+    /** Free-running read index, only updated by the consumer. */
+    volatile uint8_t myTail;
+};
+} // namespace container
+
+#include "impl/ring_buffer_impl.h"
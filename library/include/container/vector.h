@@ -5,6 +5,8 @@
 
 #include <stddef.h>
 
+#include "memory/allocator/interface.h"
+
 namespace container 
 {
 /**
@@ -24,6 +26,13 @@ public:
      */
     Vector() noexcept;
 
+    /**
+     * @brief Create empty vector allocating its memory via given allocator.
+     *
+     * @param[in] allocator Reference to the allocator to use instead of the heap.
+     */
+    explicit Vector(memory::allocator::Interface& allocator) noexcept;
+
     /**
      * @brief Create vector of given size.
      *
@@ -43,6 +52,8 @@ public:
 
     /**
      * @brief Create vector as a copy of another vector.
+     * 
+     *        The new vector uses the same allocator as the other vector.
      *
      * @param[in] other Reference to other vector to copy from.
      */
@@ -51,7 +62,8 @@ public:
     /**
      * @brief Move memory from another vector.
      * 
-     *        The other vector is emptied once the move operation is completed.
+     *        The other vector is emptied once the move operation is completed, the allocator
+     *        of the other vector is taken over.
      *
      * @param[in] other Reference to other vector to move memory from.
      */
@@ -78,7 +90,8 @@ public:
      * 
      *        Previous values are cleared before copying.
      * 
-     *        The other vector is emptied once the move operation is completed.
+     *        The other vector is emptied once the move operation is completed, the allocator
+     *        of the other vector is taken over.
      *
      * @param[in] other Reference to vector holding the data to move. 
      * 
@@ -278,6 +291,9 @@ protected:
 
     /** The size of the field in number of elements it can hold. */
     size_t mySize;
+
+    /** Pointer to the allocator holding the data, or nullptr if the data is held on the heap. */
+    memory::allocator::Interface* myAllocator;
 };
 } // namespace container
 
@@ -0,0 +1,162 @@
+/**
+ * @brief Input capture driver for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "container/ring_buffer.h"
+#include "driver/capture/interface.h"
+
+namespace driver
+{
+namespace capture
+{
+/**
+ * @brief Input capture driver for ATmega328P.
+ * 
+ *        The input capture unit of Timer 1 latches the counter value on edges of pin 8 (ICP1)
+ *        in hardware, which is then stored in a ring buffer by the capture interrupt. The timer
+ *        runs without prescaler, so the resolution is 62.5 ns. Timer overflows extend the 
+ *        timestamps to 32 bits, hence periods up to 268 s can be measured. The noise canceler
+ *        is enabled, which delays each capture by four clock cycles.
+ * 
+ *        Timer 1 is reserved via timer::Atmega328p::reserveCircuit(), so only one input capture
+ *        unit can be used at a time, and not while Timer 1 is used by a timer or for PWM.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Atmega328p final : public Interface
+{
+public:
+    /**
+     * @brief Enumeration of edges to capture.
+     */
+    enum class Edge : uint8_t
+    {
+        Rising,  // Capture rising edges only.
+        Falling, // Capture falling edges only.
+        Both,    // Capture both edges, required for measuring the duty cycle.
+    };
+
+    /** Time per timer count in microseconds. */
+    static constexpr double CountInterval_us{0.0625};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] edge The edges to capture (default = both).
+     * @param[in] enable Enable the input capture unit immediately (default = false).
+     */
+    explicit Atmega328p(Edge edge = Edge::Both, bool enable = false) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Atmega328p() noexcept override;
+
+    /**
+     * @brief Check if the input capture unit is initialized.
+     * 
+     *        An uninitialized unit indicates that Timer 1 was unavailable when the unit was 
+     *        created.
+     * 
+     * @return True if the input capture unit is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Check whether the input capture unit is enabled.
+     * 
+     * @return True if the input capture unit is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Set enablement of the input capture unit.
+     * 
+     * @param[in] enable True to enable the input capture unit, false otherwise.
+     */
+    void setEnabled(bool enable) noexcept override;
+
+    /**
+     * @brief Get the number of captured events not yet read.
+     * 
+     * @return The number of captured events.
+     */
+    uint8_t eventCount() const noexcept override;
+
+    /**
+     * @brief Get the number of events lost due to a full event buffer.
+     * 
+     * @return The number of lost events.
+     */
+    uint16_t lostEventCount() const noexcept override;
+
+    /**
+     * @brief Read the oldest captured event.
+     * 
+     * @param[out] event Reference to variable to store the event.
+     * 
+     * @return True if an event was read, false if no events are available.
+     */
+    bool readEvent(Event& event) noexcept override;
+
+    /**
+     * @brief Measure the input signal based on the captured events.
+     * 
+     *        All captured events are consumed. The last edges are retained, so consecutive 
+     *        measurements cover the signal without gaps.
+     * 
+     * @param[out] measurement Reference to variable to store the measurement results.
+     * 
+     * @return True on success, false if no complete period has been captured.
+     */
+    bool measure(Measurement& measurement) noexcept override;
+
+    /**
+     * @brief Store the captured timestamp.
+     * 
+     *        This method is invoked by the capture interrupt.
+     */
+    void handleCapture() noexcept;
+
+    /**
+     * @brief Extend the timestamps on timer overflow.
+     * 
+     *        This method is invoked by the overflow interrupt.
+     */
+    void handleOverflow() noexcept;
+
+    Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
+    Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
+    Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
+    Atmega328p& operator=(Atmega328p&&)      = delete; // No move assignment.
+
+private:
+    /** The number of events the buffer can hold. */
+    static constexpr uint8_t BufferSize{32U};
+
+    /** Buffer holding captured events. */
+    container::RingBuffer<Event, BufferSize> myEvents;
+
+    /** Timestamp of the last rising and falling edge handled by measure(). */
+    uint32_t myLastEdge[2U];
+
+    /** Indicate whether the timestamps of the last edges are valid. */
+    bool myLastEdgeValid[2U];
+
+    /** The number of timer overflows, i.e. the upper 16 bits of the timestamps. */
+    volatile uint16_t myOverflowCount;
+
+    /** The number of events lost due to a full event buffer. */
+    volatile uint16_t myLostEventCount;
+
+    /** The edges to capture. */
+    Edge myEdge;
+
+    /** Indicate whether the input capture unit is enabled. */
+    bool myEnabled;
+};
+} // namespace capture
+} // namespace driver
@@ -0,0 +1,116 @@
+/**
+ * @brief Input capture interface.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace capture
+{
+/**
+ * @brief Structure of capture events.
+ */
+struct Event
+{
+    /** Timestamp of the event in timer counts. */
+    uint32_t timestamp;
+
+    /** Indicate whether the event was a rising edge (otherwise it was a falling edge). */
+    bool rising;
+};
+
+/**
+ * @brief Structure of measurement results.
+ */
+struct Measurement
+{
+    /** Average period in microseconds. */
+    double period_us;
+
+    /** Average high time in microseconds (0 unless both edges are captured). */
+    double highTime_us;
+
+    /** Frequency in Hz. */
+    double frequency_Hz;
+
+    /** Duty cycle between 0.0 - 1.0 (0 unless both edges are captured). */
+    double dutyCycle;
+
+    /** The number of periods the measurement is based on. */
+    uint16_t periodCount;
+};
+
+/**
+ * @brief Input capture interface.
+ */
+class Interface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Interface() noexcept = default;
+
+    /**
+     * @brief Check if the input capture unit is initialized.
+     * 
+     *        An uninitialized unit indicates that the required hardware was unavailable when the
+     *        unit was created.
+     * 
+     * @return True if the input capture unit is initialized, false otherwise.
+     */
+    virtual bool isInitialized() const noexcept = 0;
+
+    /**
+     * @brief Check whether the input capture unit is enabled.
+     * 
+     * @return True if the input capture unit is enabled, false otherwise.
+     */
+    virtual bool isEnabled() const noexcept = 0;
+
+    /**
+     * @brief Set enablement of the input capture unit.
+     * 
+     * @param[in] enable True to enable the input capture unit, false otherwise.
+     */
+    virtual void setEnabled(bool enable) noexcept = 0;
+
+    /**
+     * @brief Get the number of captured events not yet read.
+     * 
+     * @return The number of captured events.
+     */
+    virtual uint8_t eventCount() const noexcept = 0;
+
+    /**
+     * @brief Get the number of events lost due to a full event buffer.
+     * 
+     * @return The number of lost events.
+     */
+    virtual uint16_t lostEventCount() const noexcept = 0;
+
+    /**
+     * @brief Read the oldest captured event.
+     * 
+     * @param[out] event Reference to variable to store the event.
+     * 
+     * @return True if an event was read, false if no events are available.
+     */
+    virtual bool readEvent(Event& event) noexcept = 0;
+
+    /**
+     * @brief Measure the input signal based on the captured events.
+     * 
+     *        All captured events are consumed. The last edges are retained, so consecutive 
+     *        measurements cover the signal without gaps.
+     * 
+     * @param[out] measurement Reference to variable to store the measurement results.
+     * 
+     * @return True on success, false if no complete period has been captured.
+     */
+    virtual bool measure(Measurement& measurement) noexcept = 0;
+};
+} // namespace capture
+} // namespace driver
@@ -16,6 +16,10 @@ namespace eeprom
  * 
  *        Use the singleton design pattern to ensure only one EEPROM instance exists,
  *        reflecting the hardware limitation of a single EEPROM on the MCU.
+ * 
+ *        Each byte is accessed with interrupts disabled and the interrupt state is restored
+ *        afterwards, so the EEPROM can also be written from interrupt context, such as on
+ *        watchdog timeout.
  */
 class Atmega328p final : public Interface
 {
@@ -17,6 +17,10 @@ struct Hardware;
 /**
  * @brief GPIO driver for ATmega328P.
  * 
+ *        Callbacks are registered per pin. On pin change interrupt, the input of the associated
+ *        I/O port is compared with the input latched on the previous interrupt, so that only
+ *        the callbacks of the pins that actually changed are invoked, along with the edge.
+ * 
  *        This class is non-copyable and non-movable.
  */
 class Atmega328p final : public Interface
@@ -28,16 +32,28 @@ public:
     /** Enumeration of I/O ports. */
     enum class IoPort : uint8_t;
 
+    /** Callback invoked with the edge that caused a pin change interrupt. */
+    using EdgeCallback = void (*)(Edge edge);
+
     /**
      * @brief Constructor.
      *
      * @param[in] pin The pin number of the GPIO.
      * @param[in] direction The GPIO direction.
-     * @param[in] callback Callback associated with the GPIO (default = none).
+     * @param[in] callback Callback invoked when the input of the GPIO changes (default = none).
      */
     explicit Atmega328p(uint8_t pin, Direction direction, 
         void (*callback)() = nullptr) noexcept;
 
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] pin The pin number of the GPIO.
+     * @param[in] direction The GPIO direction.
+     * @param[in] callback Callback invoked with the edge when the input of the GPIO changes.
+     */
+    Atmega328p(uint8_t pin, Direction direction, EdgeCallback callback) noexcept;
+
     /**
      * @brief Destructor.
      */
@@ -84,6 +100,9 @@ public:
     /**
      * @brief Enable/disable pin change interrupt for the GPIO.
      * 
+     *        The current input is latched when the interrupt is enabled, so that only 
+     *        subsequent changes of the input invoke the callback of the GPIO.
+     * 
      * @param[in] enable True to enable pin change interrupt for the GPIO, false otherwise.
      */
     void enableInterrupt(bool enable) noexcept override;
@@ -103,6 +122,24 @@ public:
      * @note This operation is only supported for pins set to output.
      */
     void blink(const uint16_t& blinkSpeed_ms) noexcept;
+
+    /**
+     * @brief Reserve given pin for other purposes, such as GPIOs bound at compile time.
+     * 
+     *        A reserved pin can't be used by any GPIO until released.
+     * 
+     * @param[in] pin The pin number to reserve.
+     * 
+     * @return True if the pin was reserved, false if it's invalid or already in use.
+     */
+    static bool reservePin(uint8_t pin) noexcept;
+
+    /**
+     * @brief Release given pin reserved via reservePin().
+     * 
+     * @param[in] pin The pin number to release.
+     */
+    static void releasePin(uint8_t pin) noexcept;
     
     Atmega328p()                             = delete; // No default constructor.
     Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
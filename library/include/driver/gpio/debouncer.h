@@ -0,0 +1,147 @@
+/**
+ * @brief Debounced input service sampling GPIO inputs from a shared tick.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/gpio/interface.h"
+
+namespace driver
+{
+namespace gpio
+{
+/**
+ * @brief Enumeration of debounced input events.
+ */
+enum class InputEvent : uint8_t
+{
+    Press,     // The input became active.
+    Release,   // The input became inactive.
+    LongPress, // The input has been active for the long press time.
+    Count,     // Number of input events.
+};
+
+/**
+ * @brief Debounced input service sampling GPIO inputs from a shared tick.
+ *
+ *        All registered inputs are sampled each time tick() is called, typically from a periodic
+ *        software timer callback, so any number of inputs share a single timer and no pin
+ *        change interrupts have to be disabled during debouncing. Each input has its own
+ *        integrator, which counts up while the input is active and down while inactive. The
+ *        debounced state only changes when the integrator reaches its limits, so contact
+ *        bounces shorter than the integrator limit are filtered out independently per input.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Debouncer final
+{
+public:
+    /** Callback invoked with the index of the input and the event. */
+    using Callback = void (*)(uint8_t input, InputEvent event);
+
+    /** The max number of inputs. */
+    static constexpr uint8_t MaxInputCount{8U};
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] callback Callback invoked on input events.
+     * @param[in] integratorLimit The number of consecutive samples required to change the
+     *                            debounced state (default = 4).
+     * @param[in] longPressTicks The number of ticks an input must be active to generate a long
+     *                           press event, or 0 to disable long press events (default = 100).
+     */
+    explicit Debouncer(Callback callback, uint8_t integratorLimit = 4U,
+                       uint16_t longPressTicks = 100U) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Debouncer() noexcept = default;
+
+    /**
+     * @brief Register input to debounce.
+     *
+     *        The current input is taken as the initial debounced state, hence no event is
+     *        generated for inputs being active when registered.
+     *
+     * @param[in] input Reference to the input to debounce.
+     * @param[in] activeLow True if the input is active when low, such as a button connected
+     *                      to ground (default = false).
+     *
+     * @return The index of the input passed to the callback, or -1 if no more inputs can be
+     *         registered.
+     */
+    int8_t add(const Interface& input, bool activeLow = false) noexcept;
+
+    /**
+     * @brief Get the number of registered inputs.
+     *
+     * @return The number of registered inputs.
+     */
+    uint8_t inputCount() const noexcept;
+
+    /**
+     * @brief Check whether given input is active after debouncing.
+     *
+     * @param[in] input The index of the input.
+     *
+     * @return True if the input is active, false otherwise or if the index is invalid.
+     */
+    bool isActive(uint8_t input) const noexcept;
+
+    /**
+     * @brief Sample all registered inputs and invoke the callback for each input event.
+     *
+     *        This method can be called from interrupt context.
+     */
+    void tick() noexcept;
+
+    Debouncer()                            = delete; // No default constructor.
+    Debouncer(const Debouncer&)            = delete; // No copy constructor.
+    Debouncer(Debouncer&&)                 = delete; // No move constructor.
+    Debouncer& operator=(const Debouncer&) = delete; // No copy assignment.
+    Debouncer& operator=(Debouncer&&)      = delete; // No move assignment.
+
+private:
+    /**
+     * @brief Structure of a debounced input.
+     */
+    struct Input
+    {
+        /** Pointer to the sampled input. */
+        const Interface* gpio;
+
+        /** Integrator, counting consecutive active samples. */
+        uint8_t integrator;
+
+        /** Indicate whether the input is active when low. */
+        bool activeLow;
+
+        /** The debounced state (true = active). */
+        bool active;
+
+        /** The number of ticks the input has been active (saturating). */
+        uint16_t activeTicks;
+    };
+
+    void update(uint8_t index, bool sample) noexcept;
+
+    /** The registered inputs. */
+    Input myInputs[MaxInputCount];
+
+    /** Callback invoked on input events. */
+    const Callback myCallback;
+
+    /** The number of consecutive samples required to change the debounced state. */
+    const uint8_t myIntegratorLimit;
+
+    /** The number of ticks required to generate a long press event (0 = disabled). */
+    const uint16_t myLongPressTicks;
+
+    /** The number of registered inputs. */
+    uint8_t myInputCount;
+};
+} // namespace gpio
+} // namespace driver
@@ -0,0 +1,202 @@
+/**
+ * @brief Implementation details of gpio::Pin and gpio::PinAdapter classes.
+ *
+ * @note Don't include this header, use <pin.h> instead!
+ */
+#pragma once
+
+#include "arch/avr/hw_platform.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace gpio
+{
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+Pin<PinNumber, PinDirection>::Pin() noexcept
+    : myInitialized{Atmega328p::reservePin(PinNumber)}
+{
+    // Only configure the hardware if the pin was reserved.
+    if (!myInitialized) { return; }
+
+    if constexpr (Direction::Output == PinDirection) { utils::set(ddrx(), Bit); }
+    else if constexpr (Direction::InputPullup == PinDirection) { utils::set(portx(), Bit); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+Pin<PinNumber, PinDirection>::~Pin() noexcept
+{
+    // Skip cleanup if the pin wasn't reserved.
+    if (!myInitialized) { return; }
+
+    // Free resources used for the GPIO before deletion.
+    utils::clear(pcmskx(), Bit);
+    utils::clear(ddrx(), Bit);
+    utils::clear(portx(), Bit);
+    Atmega328p::releasePin(PinNumber);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+bool Pin<PinNumber, PinDirection>::isInitialized() const noexcept { return myInitialized; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+constexpr Direction Pin<PinNumber, PinDirection>::direction() noexcept { return PinDirection; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+bool Pin<PinNumber, PinDirection>::read() const noexcept { return utils::read(pinx(), Bit); }
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+void Pin<PinNumber, PinDirection>::write(const bool output) noexcept
+{
+    if (output) { set(); }
+    else { clear(); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+void Pin<PinNumber, PinDirection>::set() noexcept
+{
+    static_assert(Direction::Output == PinDirection, "Only outputs can be written!");
+    utils::set(portx(), Bit);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+void Pin<PinNumber, PinDirection>::clear() noexcept
+{
+    static_assert(Direction::Output == PinDirection, "Only outputs can be written!");
+    utils::clear(portx(), Bit);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+void Pin<PinNumber, PinDirection>::toggle() noexcept
+{
+    static_assert(Direction::Output == PinDirection, "Only outputs can be toggled!");
+
+    // The hardware will toggle the output when writing to the pin register.
+    utils::set(pinx(), Bit);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+void Pin<PinNumber, PinDirection>::enableInterrupt(const bool enable) noexcept
+{
+    // Enable/disable interrupts on the associated pin as specified.
+    if (enable)
+    {
+        utils::globalInterruptEnable();
+        utils::set(PCICR, pcix());
+        utils::set(pcmskx(), Bit);
+    }
+    else { utils::clear(pcmskx(), Bit); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+void Pin<PinNumber, PinDirection>::enableInterruptOnPort(const bool enable) noexcept
+{
+    // Enable/disable interrupts on the associated port as specified.
+    if (enable) { utils::set(PCICR, pcix()); }
+    else { utils::clear(PCICR, pcix()); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+volatile uint8_t& Pin<PinNumber, PinDirection>::ddrx() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == Port) { return DDRB; }
+    else if constexpr (Atmega328p::IoPort::C == Port) { return DDRC; }
+    else { return DDRD; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+volatile uint8_t& Pin<PinNumber, PinDirection>::portx() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == Port) { return PORTB; }
+    else if constexpr (Atmega328p::IoPort::C == Port) { return PORTC; }
+    else { return PORTD; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+volatile uint8_t& Pin<PinNumber, PinDirection>::pinx() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == Port) { return PINB; }
+    else if constexpr (Atmega328p::IoPort::C == Port) { return PINC; }
+    else { return PIND; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+volatile uint8_t& Pin<PinNumber, PinDirection>::pcmskx() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == Port) { return PCMSK0; }
+    else if constexpr (Atmega328p::IoPort::C == Port) { return PCMSK1; }
+    else { return PCMSK2; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinNumber, Direction PinDirection>
+constexpr uint8_t Pin<PinNumber, PinDirection>::pcix() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == Port) { return PCIE0; }
+    else if constexpr (Atmega328p::IoPort::C == Port) { return PCIE1; }
+    else { return PCIE2; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename PinType>
+PinAdapter<PinType>::PinAdapter(PinType& pin) noexcept
+    : myPin{pin}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename PinType>
+bool PinAdapter<PinType>::isInitialized() const noexcept { return myPin.isInitialized(); }
+
+// -----------------------------------------------------------------------------
+template <typename PinType>
+Direction PinAdapter<PinType>::direction() const noexcept { return PinType::direction(); }
+
+// -----------------------------------------------------------------------------
+template <typename PinType>
+bool PinAdapter<PinType>::read() const noexcept { return myPin.read(); }
+
+// -----------------------------------------------------------------------------
+template <typename PinType>
+void PinAdapter<PinType>::write(const bool output) noexcept
+{
+    if constexpr (Direction::Output == PinType::direction()) { myPin.write(output); }
+    else { (void) (output); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename PinType>
+void PinAdapter<PinType>::toggle() noexcept
+{
+    if constexpr (Direction::Output == PinType::direction()) { myPin.toggle(); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename PinType>
+void PinAdapter<PinType>::enableInterrupt(const bool enable) noexcept
+{
+    myPin.enableInterrupt(enable);
+}
+
+// -----------------------------------------------------------------------------
+template <typename PinType>
+void PinAdapter<PinType>::enableInterruptOnPort(const bool enable) noexcept
+{
+    myPin.enableInterruptOnPort(enable);
+}
+} // namespace gpio
+} // namespace driver
@@ -20,6 +20,16 @@ enum class Direction : uint8_t
     Count,       // Number of supported data directions.
 };
 
+/**
+ * @brief Enumeration of GPIO edges, i.e. input transitions.
+ */
+enum class Edge : uint8_t
+{
+    Falling, // Transition from high to low.
+    Rising,  // Transition from low to high.
+    Count,   // Number of supported edges.
+};
+
 /**
  * @brief GPIO interface.
  */
@@ -0,0 +1,237 @@
+/**
+ * @brief GPIO bound to a pin at compile time for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/gpio/atmega328p.h"
+#include "driver/gpio/interface.h"
+
+namespace driver
+{
+namespace gpio
+{
+/**
+ * @brief GPIO bound to a pin at compile time for ATmega328P.
+ *
+ *        The I/O port, the registers and the bit of the pin are resolved at compile time, and
+ *        all operations are inlined, non-virtual and unchecked. Hence each operation compiles
+ *        to a single SBI/CBI/SBIS instruction. Writing to or toggling an input is rejected at
+ *        compile time. Use PinAdapter when a gpio::Interface is required.
+ *
+ *        The pin is reserved on construction, see Atmega328p::reservePin(). The hardware is only
+ *        configured if the reservation succeeded, but the I/O operations don't check it.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam PinNumber The pin number of the GPIO, see Atmega328p::Port.
+ * @tparam PinDirection The GPIO direction.
+ */
+template <uint8_t PinNumber, Direction PinDirection>
+class Pin final
+{
+    static_assert(Atmega328p::Port::C5 >= PinNumber, "Invalid pin number!");
+    static_assert(Direction::Count > PinDirection, "Invalid direction!");
+
+public:
+    /** The I/O port associated with the pin. */
+    static constexpr Atmega328p::IoPort Port
+    {
+        Atmega328p::Port::B0 > PinNumber ? Atmega328p::IoPort::D :
+            (Atmega328p::Port::C0 > PinNumber ? Atmega328p::IoPort::B : Atmega328p::IoPort::C)
+    };
+
+    /** The physical pin on the I/O port. */
+    static constexpr uint8_t Bit
+    {
+        Atmega328p::IoPort::D == Port ? PinNumber - Atmega328p::Port::D0 :
+            (Atmega328p::IoPort::B == Port ? PinNumber - Atmega328p::Port::B0
+                                           : PinNumber - Atmega328p::Port::C0)
+    };
+
+    /** Bit mask of the pin. */
+    static constexpr uint8_t Mask{static_cast<uint8_t>(1U << Bit)};
+
+    /**
+     * @brief Constructor, reserve and configure the pin.
+     */
+    Pin() noexcept;
+
+    /**
+     * @brief Destructor, reset and release the pin.
+     */
+    ~Pin() noexcept;
+
+    /**
+     * @brief Check whether the GPIO is initialized, i.e. whether the pin was reserved.
+     *
+     * @return True if the GPIO is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept;
+
+    /**
+     * @brief Get the data direction of the GPIO.
+     *
+     * @return The data direction of the GPIO.
+     */
+    static constexpr Direction direction() noexcept;
+
+    /**
+     * @brief Read input of the GPIO.
+     *
+     * @return True if the input is high, false otherwise.
+     */
+    bool read() const noexcept;
+
+    /**
+     * @brief Write output to the GPIO.
+     *
+     * @param[in] output The output value to write (true = high, false = low).
+     *
+     * @note This operation is only supported for pins set to output.
+     */
+    void write(bool output) noexcept;
+
+    /**
+     * @brief Set the output of the GPIO high.
+     *
+     * @note This operation is only supported for pins set to output.
+     */
+    void set() noexcept;
+
+    /**
+     * @brief Set the output of the GPIO low.
+     *
+     * @note This operation is only supported for pins set to output.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Toggle the output of the GPIO.
+     *
+     * @note This operation is only supported for pins set to output.
+     */
+    void toggle() noexcept;
+
+    /**
+     * @brief Enable/disable pin change interrupt for the GPIO.
+     *
+     *        No callback is associated with the pin, hence the interrupt is only useful for
+     *        waking up the MCU from sleep.
+     *
+     * @param[in] enable True to enable pin change interrupt for the GPIO, false otherwise.
+     */
+    void enableInterrupt(bool enable) noexcept;
+
+    /**
+     * @brief Enable pin change interrupt for I/O port associated with the GPIO.
+     *
+     * @param[in] enable True to enable pin change interrupt for the I/O port, false otherwise.
+     */
+    void enableInterruptOnPort(bool enable) noexcept;
+
+    Pin(const Pin&)            = delete; // No copy constructor.
+    Pin(Pin&&)                 = delete; // No move constructor.
+    Pin& operator=(const Pin&) = delete; // No copy assignment.
+    Pin& operator=(Pin&&)      = delete; // No move assignment.
+
+private:
+    static volatile uint8_t& ddrx() noexcept;
+    static volatile uint8_t& portx() noexcept;
+    static volatile uint8_t& pinx() noexcept;
+    static volatile uint8_t& pcmskx() noexcept;
+    static constexpr uint8_t pcix() noexcept;
+
+    /** Indicate whether the pin was reserved. */
+    const bool myInitialized;
+};
+
+/**
+ * @brief Adapter implementing the GPIO interface for GPIOs bound at compile time.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam PinType The type of the adapted GPIO, see gpio::Pin.
+ */
+template <typename PinType>
+class PinAdapter final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] pin Reference to the GPIO to adapt.
+     */
+    explicit PinAdapter(PinType& pin) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~PinAdapter() noexcept override = default;
+
+    /**
+     * @brief Check whether the GPIO is initialized.
+     *
+     * @return True if the GPIO is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Get the data direction of the GPIO.
+     *
+     * @return The data direction of the GPIO.
+     */
+    Direction direction() const noexcept override;
+
+    /**
+     * @brief Read input of the GPIO.
+     *
+     * @return True if the input is high, false otherwise.
+     */
+    bool read() const noexcept override;
+
+    /**
+     * @brief Write output to the GPIO.
+     *
+     * @param[in] output The output value to write (true = high, false = low).
+     *
+     * @note This operation is ignored for pins not set to output.
+     */
+    void write(bool output) noexcept override;
+
+    /**
+     * @brief Toggle the output of the GPIO.
+     *
+     * @note This operation is ignored for pins not set to output.
+     */
+    void toggle() noexcept override;
+
+    /**
+     * @brief Enable/disable pin change interrupt for the GPIO.
+     *
+     * @param[in] enable True to enable pin change interrupt for the GPIO, false otherwise.
+     */
+    void enableInterrupt(bool enable) noexcept override;
+
+    /**
+     * @brief Enable pin change interrupt for I/O port associated with the GPIO.
+     *
+     * @param[in] enable True to enable pin change interrupt for the I/O port, false otherwise.
+     */
+    void enableInterruptOnPort(bool enable) noexcept override;
+
+    PinAdapter()                             = delete; // No default constructor.
+    PinAdapter(const PinAdapter&)            = delete; // No copy constructor.
+    PinAdapter(PinAdapter&&)                 = delete; // No move constructor.
+    PinAdapter& operator=(const PinAdapter&) = delete; // No copy assignment.
+    PinAdapter& operator=(PinAdapter&&)      = delete; // No move assignment.
+
+private:
+    /** Reference to the adapted GPIO. */
+    PinType& myPin;
+};
+} // namespace gpio
+} // namespace driver
+
+#include "impl/pin_impl.h"
@@ -0,0 +1,127 @@
+/**
+ * @brief Group of GPIO pins on the same I/O port for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/gpio/atmega328p.h"
+#include "driver/gpio/interface.h"
+
+namespace driver
+{
+namespace gpio
+{
+/** Registers of an I/O port. */
+struct PortRegisters;
+
+/**
+ * @brief Group of GPIO pins on the same I/O port for ATmega328P.
+ *
+ *        All pins of the group are read, written and toggled via single register operations,
+ *        so they change simultaneously, such as the lines of a parallel bus. Masks and values
+ *        refer to the bits of the I/O port, i.e. bit n corresponds to physical pin n, see
+ *        pinMask(). Bits outside the group are ignored.
+ *
+ *        The pins are reserved on construction, see Atmega328p::reservePin(). The group is
+ *        only initialized if all pins are valid, free and associated with the same I/O port.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class PortGroup final
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] pins Pointer to the pin numbers of the group.
+     * @param[in] pinCount The number of pins.
+     * @param[in] direction The direction of the pins.
+     */
+    PortGroup(const uint8_t* pins, uint8_t pinCount, Direction direction) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~PortGroup() noexcept;
+
+    /**
+     * @brief Check whether the group is initialized.
+     *
+     * @return True if the group is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept;
+
+    /**
+     * @brief Get the data direction of the pins.
+     *
+     * @return The data direction of the pins.
+     */
+    Direction direction() const noexcept;
+
+    /**
+     * @brief Get the mask of the pins in the group.
+     *
+     * @return The mask of the pins, or 0 if the group is uninitialized.
+     */
+    uint8_t mask() const noexcept;
+
+    /**
+     * @brief Read the input of all pins in the group at once.
+     *
+     * @return The input of the pins, with the bits outside the group cleared.
+     */
+    uint8_t read() const noexcept;
+
+    /**
+     * @brief Write the output of given pins in the group at once.
+     *
+     * @param[in] mask Mask of the pins to write.
+     * @param[in] value The output values of the pins (1 = high, 0 = low).
+     *
+     * @note This operation is only supported for pins set to output.
+     */
+    void write(uint8_t mask, uint8_t value) noexcept;
+
+    /**
+     * @brief Toggle the output of given pins in the group at once.
+     *
+     * @param[in] mask Mask of the pins to toggle.
+     *
+     * @note This operation is only supported for pins set to output.
+     */
+    void toggle(uint8_t mask) noexcept;
+
+    /**
+     * @brief Get the mask of given pin on its I/O port.
+     *
+     * @param[in] pin The pin number.
+     *
+     * @return The mask of the pin, or 0 if the pin is invalid.
+     */
+    static uint8_t pinMask(uint8_t pin) noexcept;
+
+    PortGroup()                            = delete; // No default constructor.
+    PortGroup(const PortGroup&)            = delete; // No copy constructor.
+    PortGroup(PortGroup&&)                 = delete; // No move constructor.
+    PortGroup& operator=(const PortGroup&) = delete; // No copy assignment.
+    PortGroup& operator=(PortGroup&&)      = delete; // No move assignment.
+
+private:
+    bool reservePins(const uint8_t* pins, uint8_t pinCount) noexcept;
+    void releasePins() noexcept;
+
+    /** Registers of the associated I/O port. */
+    PortRegisters* myRegs;
+
+    /** The direction of the pins. */
+    const Direction myDirection;
+
+    /** The associated I/O port. */
+    Atmega328p::IoPort myIoPort;
+
+    /** Mask of the pins in the group. */
+    uint8_t myMask;
+};
+} // namespace gpio
+} // namespace driver
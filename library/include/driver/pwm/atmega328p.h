@@ -0,0 +1,129 @@
+/**
+ * @brief PWM driver for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/pwm/interface.h"
+
+namespace driver
+{
+namespace pwm
+{
+/** PWM channel structure. */
+struct Channel;
+
+/**
+ * @brief PWM driver for ATmega328P.
+ * 
+ *        The waveform is generated by the output compare units of the hardware timers, so 
+ *        no CPU time is required once the duty cycle is set. The following pins are available:
+ *            - Pin 6 (OC0A) and pin 5 (OC0B), using Timer 0.
+ *            - Pin 9 (OC1A) and pin 10 (OC1B), using Timer 1.
+ *            - Pin 11 (OC2A) and pin 3 (OC2B), using Timer 2.
+ * 
+ *        Timer 1 supports any frequency between 1 Hz - 8 MHz with 16-bit resolution at best. 
+ *        Timer 0 and Timer 2 use 8-bit resolution, so the frequency is rounded to the nearest
+ *        one available via their prescalers (62.5 kHz, 7.8 kHz, 977 Hz, 244 Hz or 61 Hz, plus 
+ *        1953 Hz and 488 Hz for Timer 2).
+ * 
+ *        The timer circuit is reserved via timer::Atmega328p::reserveCircuit(), hence a circuit 
+ *        is either used for PWM generation or by a timer. Both outputs of a circuit can be used 
+ *        at the same time, but only if the same frequency is requested.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Atmega328p final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] pin The pin number of the PWM output.
+     * @param[in] frequency_Hz The requested frequency in Hz. Must be greater than 0.
+     * @param[in] dutyCycle The duty cycle between 0.0 - 1.0 (default = 0.0).
+     * @param[in] enable Enable the PWM output immediately (default = false).
+     */
+    explicit Atmega328p(uint8_t pin, uint32_t frequency_Hz, double dutyCycle = 0.0, 
+                        bool enable = false) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Atmega328p() noexcept override;
+
+    /**
+     * @brief Check if the PWM output is initialized.
+     * 
+     *        An uninitialized PWM output indicates that the specified pin or frequency was 
+     *        invalid, or that the required timer circuit was unavailable when the output 
+     *        was created.
+     * 
+     * @return True if the PWM output is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Check whether the PWM output is enabled.
+     * 
+     * @return True if the PWM output is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Set enablement of the PWM output.
+     * 
+     *        A disabled PWM output is held low.
+     * 
+     * @param[in] enable True to enable the PWM output, false otherwise.
+     */
+    void setEnabled(bool enable) noexcept override;
+
+    /**
+     * @brief Get the frequency of the PWM output.
+     * 
+     * @return The actual frequency in Hz, or 0 if the PWM output is uninitialized.
+     */
+    uint32_t frequency_Hz() const noexcept override;
+
+    /**
+     * @brief Get the duty cycle of the PWM output.
+     * 
+     * @return The duty cycle as a floating point value between 0.0 - 1.0.
+     */
+    double dutyCycle() const noexcept override;
+
+    /**
+     * @brief Set the duty cycle of the PWM output.
+     * 
+     *        The duty cycle is rounded to the nearest value supported by the timer resolution.
+     * 
+     * @param[in] dutyCycle The new duty cycle. Must be between 0.0 - 1.0.
+     * 
+     * @return True on success, false if the duty cycle is invalid or the PWM output is 
+     *         uninitialized.
+     */
+    bool setDutyCycle(double dutyCycle) noexcept override;
+
+    Atmega328p()                             = delete; // No default constructor.
+    Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
+    Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
+    Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
+    Atmega328p& operator=(Atmega328p&&)      = delete; // No move assignment.
+
+private:
+    void connect() noexcept;
+    void disconnect() noexcept;
+
+    /** Pointer to the channel associated with the PWM output. */
+    const Channel* myChannel;
+
+    /** The number of counts the output is high each period (up to 65536 for Timer 1). */
+    uint32_t myHighCount;
+
+    /** Indicate whether the PWM output is enabled. */
+    bool myEnabled;
+};
+} // namespace pwm
+} // namespace driver
@@ -0,0 +1,74 @@
+/**
+ * @brief PWM (pulse-width modulation) interface.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace pwm
+{
+/**
+ * @brief PWM (pulse-width modulation) interface.
+ */
+class Interface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Interface() noexcept = default;
+
+    /**
+     * @brief Check if the PWM output is initialized.
+     * 
+     *        An uninitialized PWM output indicates that the specified pin or frequency was 
+     *        invalid, or that the required hardware was unavailable when the output was created.
+     * 
+     * @return True if the PWM output is initialized, false otherwise.
+     */
+    virtual bool isInitialized() const noexcept = 0;
+
+    /**
+     * @brief Check whether the PWM output is enabled.
+     * 
+     * @return True if the PWM output is enabled, false otherwise.
+     */
+    virtual bool isEnabled() const noexcept = 0;
+
+    /**
+     * @brief Set enablement of the PWM output.
+     * 
+     *        A disabled PWM output is held low.
+     * 
+     * @param[in] enable True to enable the PWM output, false otherwise.
+     */
+    virtual void setEnabled(bool enable) noexcept = 0;
+
+    /**
+     * @brief Get the frequency of the PWM output.
+     * 
+     * @return The actual frequency in Hz, which may differ from the requested frequency due to 
+     *         the limited resolution of the hardware.
+     */
+    virtual uint32_t frequency_Hz() const noexcept = 0;
+
+    /**
+     * @brief Get the duty cycle of the PWM output.
+     * 
+     * @return The duty cycle as a floating point value between 0.0 - 1.0.
+     */
+    virtual double dutyCycle() const noexcept = 0;
+
+    /**
+     * @brief Set the duty cycle of the PWM output.
+     * 
+     * @param[in] dutyCycle The new duty cycle. Must be between 0.0 - 1.0.
+     * 
+     * @return True on success, false if the duty cycle is invalid.
+     */
+    virtual bool setDutyCycle(double dutyCycle) noexcept = 0;
+};
+} // namespace pwm
+} // namespace driver
@@ -0,0 +1,93 @@
+/**
+ * @brief Reset cause driver for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/reset/interface.h"
+
+namespace driver
+{
+namespace reset
+{
+/**
+ * @brief Reset cause driver for ATmega328P.
+ *
+ *        The reset flags in MCUSR are captured at early boot, before the static data is
+ *        initialized. A crash record holding the last handled event, the program counter
+ *        interrupted by the last watchdog timeout and the stack high-water mark is kept in
+ *        a RAM section that isn't initialized at startup, so it survives warm resets.
+ *
+ *        Use the singleton design pattern to ensure only one instance exists, reflecting the
+ *        hardware limitation of a single reset status register on the MCU.
+ */
+class Atmega328p final : public Interface
+{
+public:
+    /**
+     * @brief Get the singleton reset cause driver instance.
+     *
+     * @return Reference to the singleton reset cause driver instance.
+     */
+    static Interface& getInstance() noexcept;
+
+    /**
+     * @brief Capture the reset cause and the crash record of the previous run.
+     *
+     *        This method is invoked automatically at early boot on target, where it also
+     *        disables the watchdog timer to avoid a reset loop after a watchdog reset.
+     *        Only call it manually when testing.
+     */
+    static void captureResetCause() noexcept;
+
+    /**
+     * @brief Record the program counter interrupted by a watchdog timeout.
+     *
+     *        This method is invoked by the watchdog timer from interrupt context.
+     *
+     * @param[in] programCounter The interrupted program counter (word address).
+     */
+    static void recordWatchdogTimeout(uint16_t programCounter) noexcept;
+
+    /**
+     * @brief Check whether the reset cause driver is initialized.
+     *
+     * @return True if the reset cause driver is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Get the cause of the last reset.
+     *
+     * @return The cause of the last reset.
+     */
+    Cause cause() const noexcept override;
+
+    /**
+     * @brief Get the crash record of the previous run.
+     *
+     * @param[out] record Reference to crash record to store the crash record in.
+     *
+     * @return True if the crash record was read, false if none is available.
+     */
+    bool crashRecord(CrashRecord& record) const noexcept override;
+
+    /**
+     * @brief Record the event being handled, and update the stack high-water mark.
+     *
+     * @param[in] event The event being handled.
+     */
+    void recordEvent(uint8_t event) noexcept override;
+
+    Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
+    Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
+    Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
+    Atmega328p& operator=(Atmega328p&&)      = delete; // No move assignment.
+
+private:
+    Atmega328p() noexcept = default;
+    ~Atmega328p() noexcept override = default;
+};
+} // namespace reset
+} // namespace driver
@@ -0,0 +1,85 @@
+/**
+ * @brief Reset cause interface.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace reset
+{
+/**
+ * @brief Enumeration of reset causes.
+ */
+enum class Cause : uint8_t
+{
+    PowerOn,  // Power-on reset, RAM content is undefined.
+    BrownOut, // Brown-out reset, RAM content is undefined.
+    Watchdog, // Watchdog system reset.
+    External, // External reset via the reset pin.
+    Unknown,  // No reset flag set, e.g. jump to the reset vector via an unhandled interrupt.
+    Count,    // Number of reset causes.
+};
+
+/**
+ * @brief Structure of a crash record, describing the state of the system before a reset.
+ */
+struct CrashRecord
+{
+    /** The last event handled before the reset. */
+    uint8_t lastEvent;
+
+    /** The program counter interrupted by the last watchdog timeout (word address, 0 if none). */
+    uint16_t programCounter;
+
+    /** The max stack usage in bytes, i.e. the stack high-water mark. */
+    uint16_t stackHighWater;
+};
+
+/**
+ * @brief Reset cause interface.
+ */
+class Interface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Interface() noexcept = default;
+
+    /**
+     * @brief Check whether the reset cause driver is initialized.
+     *
+     * @return True if the reset cause driver is initialized, false otherwise.
+     */
+    virtual bool isInitialized() const noexcept = 0;
+
+    /**
+     * @brief Get the cause of the last reset.
+     *
+     * @return The cause of the last reset.
+     */
+    virtual Cause cause() const noexcept = 0;
+
+    /**
+     * @brief Get the crash record of the previous run.
+     *
+     *        The crash record is only available after warm resets, such as watchdog and
+     *        external resets, since the RAM content is undefined after power-on.
+     *
+     * @param[out] record Reference to crash record to store the crash record in.
+     *
+     * @return True if the crash record was read, false if none is available.
+     */
+    virtual bool crashRecord(CrashRecord& record) const noexcept = 0;
+
+    /**
+     * @brief Record the event being handled, and update the stack high-water mark.
+     *
+     * @param[in] event The event being handled.
+     */
+    virtual void recordEvent(uint8_t event) noexcept = 0;
+};
+} // namespace reset
+} // namespace driver
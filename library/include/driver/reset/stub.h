@@ -0,0 +1,126 @@
+/**
+ * @brief Reset cause stub.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/reset/interface.h"
+
+namespace driver
+{
+namespace reset
+{
+/**
+ * @brief Reset cause stub.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Stub final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] cause The simulated reset cause (default = power-on).
+     */
+    Stub(const Cause cause = Cause::PowerOn) noexcept
+        : myRecord{}
+        , myCause{cause}
+        , myHasRecord{false}
+        , myLastEvent{}
+        , myEventCount{}
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~Stub() noexcept override = default;
+
+    /**
+     * @brief Check whether the reset cause driver is initialized.
+     *
+     * @return True if the reset cause driver is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override { return true; }
+
+    /**
+     * @brief Get the cause of the last reset.
+     *
+     * @return The cause of the last reset.
+     */
+    Cause cause() const noexcept override { return myCause; }
+
+    /**
+     * @brief Get the crash record of the previous run.
+     *
+     * @param[out] record Reference to crash record to store the crash record in.
+     *
+     * @return True if the crash record was read, false if none is available.
+     */
+    bool crashRecord(CrashRecord& record) const noexcept override
+    {
+        if (!myHasRecord) { return false; }
+        record = myRecord;
+        return true;
+    }
+
+    /**
+     * @brief Record the event being handled.
+     *
+     * @param[in] event The event being handled.
+     */
+    void recordEvent(const uint8_t event) noexcept override
+    {
+        myLastEvent = event;
+        myEventCount++;
+    }
+
+    /**
+     * @brief Simulate a crash record surviving the last reset.
+     *
+     * @param[in] record The simulated crash record.
+     */
+    void setCrashRecord(const CrashRecord& record) noexcept
+    {
+        myRecord    = record;
+        myHasRecord = true;
+    }
+
+    /**
+     * @brief Get the last recorded event.
+     *
+     * @return The last recorded event.
+     */
+    uint8_t lastEvent() const noexcept { return myLastEvent; }
+
+    /**
+     * @brief Get the number of recorded events.
+     *
+     * @return The number of recorded events.
+     */
+    uint32_t eventCount() const noexcept { return myEventCount; }
+
+    Stub(const Stub&)            = delete; // No copy constructor.
+    Stub(Stub&&)                 = delete; // No move constructor.
+    Stub& operator=(const Stub&) = delete; // No copy assignment.
+    Stub& operator=(Stub&&)      = delete; // No move assignment.
+
+private:
+    /** The simulated crash record. */
+    CrashRecord myRecord;
+
+    /** The simulated reset cause. */
+    Cause myCause;
+
+    /** Indicate whether a crash record is available. */
+    bool myHasRecord;
+
+    /** The last recorded event. */
+    uint8_t myLastEvent;
+
+    /** The number of recorded events. */
+    uint32_t myEventCount;
+};
+} // namespace reset
+} // namespace driver
@@ -17,7 +17,8 @@ namespace serial
  *        Use the singleton design pattern to ensure only one serial device instance exists,
  *        reflecting the hardware limitation of a single serial port on the MCU.
  * 
- *        Use a 9600 bps baud rate.
+ *        Use a 9600 bps baud rate. Received bytes are buffered by the receive interrupt, so no
+ *        data is lost while the CPU is busy or sleeping between reads.
  */
 class Atmega328p final : public Interface
 {
@@ -68,6 +69,16 @@ public:
      */
     int16_t read(uint8_t* buffer, uint16_t size, uint16_t timeout_ms) const noexcept override;
 
+    /**
+     * @brief Set callback to invoke when data is received.
+     * 
+     *        The callback is invoked from the receive interrupt after the received byte has 
+     *        been buffered.
+     * 
+     * @param[in] callback The callback to invoke, or nullptr to remove the current callback.
+     */
+    void setReceiveCallback(void (*callback)()) noexcept override;
+
     Atmega328p(const Atmega328p&)                      = delete; // No copy constructor.
     Atmega328p(Atmega328p&& other) noexcept            = delete; // No move constructor.
     Atmega328p& operator=(const Atmega328p&)           = delete; // No copy assignment.
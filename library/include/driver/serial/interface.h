@@ -60,6 +60,15 @@ public:
      */
     virtual int16_t read(uint8_t* buffer, uint16_t size, uint16_t timeout_ms) const noexcept = 0;
 
+    /**
+     * @brief Set callback to invoke when data is received.
+     * 
+     *        The callback may be invoked from interrupt context.
+     * 
+     * @param[in] callback The callback to invoke, or nullptr to remove the current callback.
+     */
+    virtual void setReceiveCallback(void (*callback)()) noexcept = 0;
+
     /**
      * @brief Print formatted string to the serial port.
      * 
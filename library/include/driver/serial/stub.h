@@ -29,6 +29,7 @@ public:
      */
     explicit Stub(const uint32_t baudRate_bps = 9600U) noexcept
         : myReadBuffer{}
+        , myReceiveCallback{nullptr}
         , myBaudRate_bps{baudRate_bps}
         , myEnabled{true}
     {}
@@ -91,10 +92,28 @@ public:
         // Copy contents from the simulated read buffer to given read buffer.
         for (uint16_t i{}; i < bytesToRead; ++i) { buffer[i] = myReadBuffer[i]; }
 
+        // Remove the read bytes from the simulated read buffer.
+        if (storedBytes == bytesToRead) { myReadBuffer.clear(); }
+        else
+        {
+            for (uint16_t i{bytesToRead}; i < storedBytes; ++i) 
+            { 
+                myReadBuffer[i - bytesToRead] = myReadBuffer[i]; 
+            }
+            myReadBuffer.resize(storedBytes - bytesToRead);
+        }
+
         // Return the number of bytes read.
         return static_cast<int16_t>(bytesToRead);
     }
 
+    /**
+     * @brief Set callback to invoke when data is received.
+     * 
+     * @param[in] callback The callback to invoke, or nullptr to remove the current callback.
+     */
+    void setReceiveCallback(void (*callback)()) noexcept override { myReceiveCallback = callback; }
+
     /**
      * @brief Print the given string in the serial terminal.
      * 
@@ -128,6 +147,9 @@ public:
         // Copy content to the simulated read buffer.
         myReadBuffer.resize(size);
         for (uint16_t i{}; i < size; ++i) { myReadBuffer[i] = buffer[i]; }
+
+        // Invoke the receive callback (if any) to simulate the receive interrupt.
+        if (nullptr != myReceiveCallback) { myReceiveCallback(); }
     }
 
     Stub(const Stub&)            = delete; // No copy constructor.
@@ -136,8 +158,11 @@ public:
     Stub& operator=(Stub&&)      = delete; // No move assignment.
 
 private:
-    /** Simulated read buffer. */
-    container::Vector<uint8_t> myReadBuffer;
+    /** Simulated read buffer, read bytes are removed. */
+    mutable container::Vector<uint8_t> myReadBuffer;
+
+    /** Callback to invoke when data is received. */
+    void (*myReceiveCallback)();
 
     /** Baud rate in bps (bits per second). */
     const uint32_t myBaudRate_bps;
@@ -55,6 +55,18 @@ public:
      */
     int16_t read() const noexcept override;
 
+    /**
+     * @brief Recalibrate the temperature sensor with a reference temperature.
+     * 
+     *        The current input voltage is read and the model is updated online, so the sensor 
+     *        can be recalibrated continuously without retraining the model.
+     * 
+     * @param[in] referenceTemp The actual temperature in degrees Celsius.
+     * 
+     * @return True if the sensor is initialized after the recalibration, false otherwise.
+     */
+    bool recalibrate(int16_t referenceTemp) noexcept;
+
     Smart()                        = delete; // No default constructor.
     Smart(const Smart&)            = delete; // No copy constructor.
     Smart(Smart&&)                 = delete; // No move constructor.
@@ -17,6 +17,10 @@ namespace tempsensor
 /**
  * @brief TMP36 temperature sensor implementation.
  * 
+ *        For the ATmega328P ADC configuration (10 bits, 5 V supply voltage) the raw ADC count
+ *        is converted to temperature via a lookup table placed in program memory, which avoids
+ *        floating-point operations. Other ADC configurations use the floating-point formula.
+ * 
  *        This class is non-copyable and non-movable.
  */
 class Tmp36 final : public Interface
@@ -49,6 +53,13 @@ public:
      */
     int16_t read() const noexcept override;
 
+    /**
+     * @brief Read the temperature sensor with a resolution of a tenth of a degree.
+     * 
+     * @return The temperature in tenths of degrees Celsius, truncated toward zero.
+     */
+    int16_t readTenths() const noexcept;
+
     Tmp36()                        = delete; // No default constructor.
     Tmp36(const Tmp36&)            = delete; // No copy constructor.
     Tmp36(Tmp36&&)                 = delete; // No move constructor.
@@ -61,6 +72,9 @@ private:
 
     /** Analog pin the temperature sensor is connected to. */
     const uint8_t myPin;
+
+    /** Indicate whether the lookup table matches the ADC configuration. */
+    const bool myUseLookupTable;
 };
 } // namespace tempsensor
 } // namespace driver
@@ -14,6 +14,11 @@ namespace timer
 /**
  * @brief Timer driver for ATmega328P.
  * 
+ *        In periodic mode, the timer interrupts every 0.128 ms to increment a counter. In tickless
+ *        mode, the compare register is programmed for the actual deadline instead, so the timer
+ *        only interrupts on timeout, plus once per counter overflow for long timeouts 
+ *        (every 16.384 ms for Timer 0 and Timer 2, every 4.194 s for Timer 1).
+ * 
  *        This class is non-copyable and non-movable.
  *
  * @note Tree hardware timers Timer 0 - Timer 2 are available.
@@ -21,15 +26,25 @@ namespace timer
 class Atmega328p final : public Interface
 {
 public:
+    /**
+     * @brief Enumeration of timer modes.
+     */
+    enum class Mode : uint8_t
+    {
+        Periodic, // Interrupt every 0.128 ms.
+        Tickless, // Interrupt on timeout and counter overflow only.
+    };
+
     /**
      * @brief Constructor.
      *
      * @param[in] timeout_ms The timeout in milliseconds. Must be greater than 0.
      * @param[in] callback Callback to invoke on timeout (default = none).
      * @param[in] startTimer Start the timer immediately (default = false).
+     * @param[in] mode The timer mode (default = periodic).
      */
     explicit Atmega328p(uint32_t timeout_ms, void (*callback)() = nullptr, 
-                        bool startTimer = false) noexcept;
+                        bool startTimer = false, Mode mode = Mode::Periodic) noexcept;
 
     /**
      * @brief Destructor.
@@ -74,8 +89,29 @@ public:
      */
     void setTimeout_ms(uint32_t timeout_ms) noexcept override;
 
+    /**
+     * @brief Get the timer mode.
+     * 
+     * @return The timer mode.
+     */
+    Mode mode() const noexcept;
+
+    /**
+     * @brief Get the time elapsed since the timer was started or last timed out.
+     * 
+     *        The software counter is combined with the hardware counter, which gives a 
+     *        resolution of 0.5 us in periodic mode and 64 us in tickless mode. A timer
+     *        interrupt pending while interrupts are disabled is accounted for, so this method 
+     *        can be called from both main and interrupt context.
+     * 
+     * @return The elapsed time in microseconds, or 0 if the timer is uninitialized.
+     */
+    uint32_t elapsedTime_us() const noexcept;
+
     /**
      * @brief Start the timer.
+     * 
+     *        In tickless mode, a stopped timer starts over with the full timeout.
      */
     void start() noexcept override;
 
@@ -94,8 +130,28 @@ public:
      */
     void restart() noexcept override;
 
+    /**
+     * @brief Reserve given timer circuit for other purposes, such as PWM generation.
+     * 
+     *        A reserved circuit isn't used by any timer until released.
+     * 
+     * @param[in] circuit Index of the timer circuit to reserve (0 - 2).
+     * 
+     * @return True if the circuit was reserved, false if it's invalid or already in use.
+     */
+    static bool reserveCircuit(uint8_t circuit) noexcept;
+
+    /**
+     * @brief Release given timer circuit reserved via reserveCircuit().
+     * 
+     * @param[in] circuit Index of the timer circuit to release (0 - 2).
+     */
+    static void releaseCircuit(uint8_t circuit) noexcept;
+
     /** 
      * @brief Callback handler. 
+     * 
+     *        Invoked on each timer interrupt. 
      */
     void handleCallback() noexcept;
 
@@ -110,6 +166,8 @@ private:
     void removeCallback() const noexcept;
     bool increment() noexcept;
     void clearTimedOut() noexcept;
+    void startPeriod() noexcept;
+    void scheduleNext() noexcept;
 
     /** Timer hardware structure. */
     struct Hardware;
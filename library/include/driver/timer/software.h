@@ -0,0 +1,148 @@
+/**
+ * @brief Software timer driven by a timer wheel.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/timer/interface.h"
+
+namespace driver
+{
+namespace timer
+{
+/** Hierarchical timer wheel. */
+class Wheel;
+
+/**
+ * @brief Software timer driven by a timer wheel.
+ * 
+ *        Any number of software timers can share the single hardware timer circuit of the 
+ *        wheel. The timer is periodic, i.e. it's restarted automatically on timeout until it's
+ *        stopped. The timer resolution is one millisecond.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Software final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] wheel The timer wheel driving the timer.
+     * @param[in] timeout_ms The timeout in milliseconds. Must be greater than 0.
+     * @param[in] callback Callback to invoke on timeout (default = none).
+     * @param[in] startTimer Start the timer immediately (default = false).
+     */
+    explicit Software(Wheel& wheel, uint32_t timeout_ms, void (*callback)() = nullptr, 
+                      bool startTimer = false) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Software() noexcept override;
+
+    /**
+     * @brief Check if the timer is initialized.
+     * 
+     *        An uninitialized timer indicates that the wheel isn't initialized, or that the 
+     *        given timeout was invalid.
+     * 
+     * @return True if the timer is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Check whether the timer is enabled.
+     *
+     * @return True if the timer is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Check whether the timer has timed out.
+     * 
+     *        The timeout is indicated while the callback is invoked.
+     *
+     * @return True if the timer has timed out, false otherwise.
+     */
+    bool hasTimedOut() const noexcept override;
+
+    /**
+     * @brief Get the timeout of the timer.
+     * 
+     * @return The timeout in milliseconds.
+     */
+    uint32_t timeout_ms() const noexcept override;
+
+    /**
+     * @brief Set timeout of the timer.
+     * 
+     *        The new timeout is used from the next start or timeout.
+     * 
+     * @param[in] timeout_ms The new timeout in milliseconds. Must be greater than 0.
+     */
+    void setTimeout_ms(uint32_t timeout_ms) noexcept override;
+
+    /**
+     * @brief Start the timer.
+     * 
+     *        The timer times out after the full timeout, unless it's already running.
+     */
+    void start() noexcept override;
+
+    /**
+     * @brief Stop the timer.
+     */
+    void stop() noexcept override;
+
+    /**
+     * @brief Toggle the timer.
+     */
+    void toggle() noexcept override;
+
+    /**
+     * @brief Restart the timer.
+     */
+    void restart() noexcept override;
+
+    Software()                           = delete; // No default constructor.
+    Software(const Software&)            = delete; // No copy constructor.
+    Software(Software&&)                 = delete; // No move constructor.
+    Software& operator=(const Software&) = delete; // No copy assignment.
+    Software& operator=(Software&&)      = delete; // No move assignment.
+
+private:
+    friend class Wheel;
+
+    void handleTimeout() noexcept;
+
+    /** The timer wheel driving the timer. */
+    Wheel& myWheel;
+
+    /** Callback to invoke on timeout. */
+    void (*myCallback)();
+
+    /** Next timer in the same wheel slot. */
+    Software* myNext;
+
+    /** Previous timer in the same wheel slot. */
+    Software* myPrev;
+
+    /** Pointer to the slot holding the timer, nullptr if the timer isn't scheduled. */
+    Software** mySlot;
+
+    /** Tick count at which the timer expires. */
+    uint32_t myExpiry;
+
+    /** Timeout in milliseconds. */
+    uint32_t myTimeout_ms;
+
+    /** Indicate whether the timer is enabled. */
+    bool myEnabled;
+
+    /** Indicate whether the timer has timed out. */
+    bool myTimedOut;
+};
+} // namespace timer
+} // namespace driver
@@ -0,0 +1,91 @@
+/**
+ * @brief Monotonic system time service.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/timer/atmega328p.h"
+
+namespace driver
+{
+namespace timer
+{
+/**
+ * @brief Monotonic system time service.
+ * 
+ *        A single hardware timer circuit is used to keep track of the uptime, which is stored 
+ *        as a 64-bit number of microseconds and thereby never wraps around in practice. The time
+ *        base is advanced every 16 ms, the time within the current period is read from the 
+ *        hardware timer. The resolution is 0.5 us in periodic mode and 64 us in tickless mode, 
+ *        where the timer only interrupts every 16 ms instead of every 0.128 ms.
+ * 
+ *        The uptime is read atomically, so it can be read from both main and interrupt context.
+ *        Only one system time service can be used at a time, since the hardware timer callback
+ *        is dispatched to a single instance.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class SystemTime final
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     *        Reserve a hardware timer circuit and start keeping track of the time.
+     * 
+     * @param[in] mode The mode of the hardware timer (default = periodic).
+     */
+    explicit SystemTime(Atmega328p::Mode mode = Atmega328p::Mode::Periodic) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~SystemTime() noexcept;
+
+    /**
+     * @brief Check if the system time service is initialized.
+     * 
+     *        An uninitialized service indicates that no timer circuit was available when the 
+     *        service was created, or that another service is already in use.
+     * 
+     * @return True if the system time service is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept;
+
+    /**
+     * @brief Get the time elapsed since the system time service was created.
+     * 
+     * @return The uptime in microseconds, or 0 if the service is uninitialized.
+     */
+    uint64_t uptime_us() const noexcept;
+
+    /**
+     * @brief Get the time elapsed since the system time service was created.
+     * 
+     * @return The uptime in milliseconds (wraps around after 49.7 days), or 0 if the service 
+     *         is uninitialized.
+     */
+    uint32_t uptime_ms() const noexcept;
+
+    /**
+     * @brief Advance the time base by one period.
+     * 
+     *        This method is invoked by the hardware timer.
+     */
+    void handleTimeout() noexcept;
+
+    SystemTime(const SystemTime&)            = delete; // No copy constructor.
+    SystemTime(SystemTime&&)                 = delete; // No move constructor.
+    SystemTime& operator=(const SystemTime&) = delete; // No copy assignment.
+    SystemTime& operator=(SystemTime&&)      = delete; // No move assignment.
+
+private:
+    /** Hardware timer generating the time base. */
+    Atmega328p myTimer;
+
+    /** The time base in microseconds, i.e. the uptime at the last timeout. */
+    volatile uint64_t myTimeBase_us;
+};
+} // namespace timer
+} // namespace driver
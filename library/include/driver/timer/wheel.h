@@ -0,0 +1,118 @@
+/**
+ * @brief Hierarchical timer wheel driving software timers.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/timer/atmega328p.h"
+
+namespace driver
+{
+namespace timer
+{
+/** Software timer. */
+class Software;
+
+/**
+ * @brief Hierarchical timer wheel driving software timers.
+ * 
+ *        A single hardware timer circuit in tickless mode generates a tick roughly each 
+ *        millisecond. Since the timer can't generate exactly 1 ms, the elapsed time is 
+ *        accumulated and the wheel is advanced by one tick per elapsed millisecond, so the 
+ *        timers don't drift. The wheel consists of eight levels of 16 slots each, where level n holds the 
+ *        timers expiring within 16^(n + 1) ticks. Each slot is an intrusive linked list of 
+ *        software timers, so starting, stopping and expiring a timer take O(1) time regardless
+ *        of the number of timers. Timers of higher levels are moved (cascaded) to lower levels 
+ *        as their expiry approaches.
+ * 
+ *        Only one wheel can be used at a time, since the hardware tick is dispatched to a 
+ *        single instance. The wheel must outlive the software timers using it.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Wheel final
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     *        Reserve a hardware timer circuit and start ticking.
+     */
+    Wheel() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Wheel() noexcept;
+
+    /**
+     * @brief Check if the wheel is initialized.
+     * 
+     *        An uninitialized wheel indicates that no timer circuit was available when the wheel
+     *        was created, or that another wheel is already in use.
+     * 
+     * @return True if the wheel is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept;
+
+    /**
+     * @brief Get the number of ticks since the wheel was created.
+     * 
+     * @return The number of ticks. Each tick corresponds to one millisecond.
+     */
+    uint32_t ticks() const noexcept;
+
+    /**
+     * @brief Advance the wheel by given time.
+     * 
+     *        The wheel ticks once per elapsed millisecond, the remainder is carried over to the
+     *        next call. This method is invoked by the hardware timer.
+     * 
+     * @param[in] time_us The time elapsed since the last call in microseconds.
+     */
+    void elapse(uint32_t time_us) noexcept;
+
+    /**
+     * @brief Advance the wheel by one tick.
+     * 
+     *        Timers due are cascaded to lower levels and expired timers are handled.
+     */
+    void tick() noexcept;
+
+    Wheel(const Wheel&)            = delete; // No copy constructor.
+    Wheel(Wheel&&)                 = delete; // No move constructor.
+    Wheel& operator=(const Wheel&) = delete; // No copy assignment.
+    Wheel& operator=(Wheel&&)      = delete; // No move assignment.
+
+private:
+    friend class Software;
+
+    /** The number of bits of the tick count covered by each level. */
+    static constexpr uint8_t LevelBits{4U};
+
+    /** The number of slots per level. */
+    static constexpr uint8_t SlotCount{1U << LevelBits};
+
+    /** The number of levels, covering the full 32-bit tick range. */
+    static constexpr uint8_t LevelCount{32U / LevelBits};
+
+    void add(Software& timer) noexcept;
+    void remove(Software& timer) noexcept;
+    void insert(Software& timer) noexcept;
+    void cascade(uint8_t level) noexcept;
+
+    /** Hardware timer generating the ticks. */
+    Atmega328p myTickTimer;
+
+    /** Slots holding the first timer of each list. */
+    Software* mySlots[LevelCount][SlotCount];
+
+    /** The number of ticks since the wheel was created. */
+    volatile uint32_t myTicks;
+
+    /** Time elapsed since the last tick in microseconds. */
+    uint16_t myRemainder_us;
+};
+} // namespace timer
+} // namespace driver
@@ -72,9 +72,24 @@ public:
 
     /**
      * @brief Reset the watchdog timer.
+     * 
+     *        The timeout interrupt is re-armed if a timeout callback is set, since the hardware
+     *        disables it after each timeout interrupt.
      */
     void reset() noexcept override;
 
+    /**
+     * @brief Set callback invoked when the watchdog timer times out.
+     * 
+     *        With a callback set, the watchdog timer operates in interrupt-then-reset mode,
+     *        i.e. the callback is invoked from interrupt context on the first timeout and the
+     *        system is reset on the next timeout, unless the watchdog timer is reset in between.
+     * 
+     * @param[in] callback The callback to invoke on timeout, or nullptr to reset the system 
+     *                     immediately on timeout.
+     */
+    void setTimeoutCallback(void (*callback)()) noexcept override;
+
     Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
     Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
     Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
@@ -61,6 +61,19 @@ public:
      * @brief Reset the watchdog timer.
      */
     virtual void reset() noexcept = 0;
+
+    /**
+     * @brief Set callback invoked when the watchdog timer times out.
+     * 
+     *        With a callback set, the watchdog timer operates in interrupt-then-reset mode,
+     *        i.e. the callback is invoked from interrupt context on the first timeout and the
+     *        system is reset on the next timeout, unless the watchdog timer is reset in between.
+     *        The callback can thereby store diagnostic data before the system is reset.
+     * 
+     * @param[in] callback The callback to invoke on timeout, or nullptr to reset the system 
+     *                     immediately on timeout.
+     */
+    virtual void setTimeoutCallback(void (*callback)()) noexcept = 0;
 };
 } // namespace watchdog
 } // namespace driver
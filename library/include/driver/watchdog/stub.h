@@ -26,6 +26,9 @@ public:
      */
     Stub(const uint16_t timeout_ms = 1024U) noexcept
         : myTimeout_ms{timeout_ms}
+        , myEnabled{false}
+        , myResetCount{}
+        , myCallback{nullptr}
     {}
 
     /**
@@ -78,7 +81,29 @@ public:
     /**
      * @brief Reset the watchdog timer.
      */
-    void reset() noexcept override {}
+    void reset() noexcept override { myResetCount++; }
+
+    /**
+     * @brief Set callback invoked when the watchdog timer times out.
+     * 
+     * @param[in] callback The callback to invoke on timeout, or nullptr if none.
+     */
+    void setTimeoutCallback(void (*callback)()) noexcept override { myCallback = callback; }
+
+    /**
+     * @brief Get the number of times the watchdog timer has been reset.
+     * 
+     * @return The number of resets.
+     */
+    uint32_t resetCount() const noexcept { return myResetCount; }
+
+    /**
+     * @brief Simulate a watchdog timeout, i.e. invoke the timeout callback if set.
+     */
+    void simulateTimeout() const noexcept
+    {
+        if (nullptr != myCallback) { myCallback(); }
+    }
 
     Stub(const Stub&)            = delete; // No copy constructor.
     Stub(Stub&&)                 = delete; // No move constructor.
@@ -91,6 +116,12 @@ private:
 
     /** Indicate whether the watchdog is enabled. */
     bool myEnabled;
+
+    /** The number of times the watchdog has been reset. */
+    uint32_t myResetCount;
+
+    /** Callback invoked on timeout. */
+    void (*myCallback)();
 };
 } // namespace watchdog
 } // namespace driver
@@ -3,8 +3,25 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 namespace logic
 {
+/**
+ * @brief Enumeration of events, in priority order (highest priority first).
+ */
+enum class Event : uint8_t
+{
+    Button,        // Button activity.
+    ToggleButton,  // Debounced toggle button press.
+    TempButton,    // Debounced temperature button press.
+    DebounceTimer, // Debounce timer timeout.
+    ToggleTimer,   // Toggle timer timeout.
+    SerialReceive, // Serial data received.
+    TempTimer,     // Temperature timer timeout.
+    Count,         // Number of events.
+};
+
 /**
  * @brief Generic logic for an MCU with configurable hardware devices.
  */
@@ -30,6 +47,16 @@ public:
      */
     virtual void run(const bool& stop) noexcept = 0;
 
+    /**
+     * @brief Post event to be handled by the system.
+     * 
+     *        The event is handled in main context by run(), in priority order. This method can
+     *        be called from interrupt context.
+     * 
+     * @param[in] event The event to post.
+     */
+    virtual void postEvent(Event event) noexcept = 0;
+
     /**
      * @brief Handle button event.
      * 
@@ -4,6 +4,9 @@
 #pragma once
 
 #include "logic/interface.h"
+#include "scheduler/event_queue.h"
+#include "scheduler/state_machine.h"
+#include "utils/command_parser.h"
 
 namespace driver
 {
@@ -16,6 +19,9 @@ namespace eeprom { class Interface; }
 /** GPIO interface. */
 namespace gpio { class Interface; }
 
+/** Reset cause interface. */
+namespace reset { class Interface; }
+
 /** Serial transmission interface. */
 namespace serial { class Interface; }
 
@@ -30,6 +36,15 @@ namespace watchdog { class Interface; }
 
 } // namespace driver
 
+namespace scheduler
+{
+/** Sleep-mode power manager. */
+class PowerManager;
+
+/** Watchdog supervisor monitoring the liveness of individual tasks. */
+class Supervisor;
+} // namespace scheduler
+
 namespace logic
 {
 /**
@@ -47,6 +62,20 @@ namespace logic
  *              last stored state before power down was "on," the LED will automatically blink.
  *            - A temperature sensor to read the surrounding temperature.
  * 
+ *        The behavior is implemented as a table-driven state machine. Button activity, timer
+ *        timeouts and serial commands are translated to state machine inputs, each of which is
+ *        handled by a single table lookup and at most one action. Serial commands are entered
+ *        line by line and looked up in a sorted command table; enter "help" to list them.
+ * 
+ *        Button presses already debounced elsewhere, such as by a gpio::Debouncer, can be 
+ *        posted as separate events per button. These are handled directly, without disabling
+ *        pin change interrupts or starting the debounce timer. If no debounce timer is used,
+ *        the pin change interrupts aren't enabled at all, so contact bounces don't wake up the
+ *        system.
+ * 
+ *        If a reset cause driver is used, each handled event is recorded in its crash record,
+ *        so the last event before a watchdog reset can be printed after the restart.
+ * 
  *        This class is non-copyable and non-movable.
  */
 class Logic : public Interface
@@ -58,24 +87,36 @@ public:
      * @param[in] led The LED to toggle.
      * @param[in] toggleButton Button to toggle the toggle timer.
      * @param[in] tempButton Button to read the temperature.
-     * @param[in] debounceTimer Timer to mitigate effects of contact bounces.
+     * @param[in] debounceTimer Pointer to timer mitigating effects of contact bounces on raw
+     *                          button events, or nullptr if the buttons are debounced
+     *                          elsewhere, e.g. by the debounced input service. In the
+     *                          latter case, the button interrupts aren't enabled.
      * @param[in] toggleTimer Timer to toggle the LED.
      * @param[in] tempTimer Timer to read the temperature.
      * @param[in] serial Serial device to print status messages.
      * @param[in] watchdog Watchdog timer that resets the program if it becomes unresponsive.
      * @param[in] eeprom EEPROM stream to write the status of the LED to EEPROM.
      * @param[in] tempSensor Temperature sensor.
+     * @param[in] powerManager Pointer to power manager selecting the sleep mode when idle, or
+     *                         nullptr to always use idle sleep mode (default = nullptr).
+     * @param[in] supervisor Pointer to watchdog supervisor monitoring the main loop, or nullptr
+     *                       to reset the watchdog unconditionally (default = nullptr).
+     * @param[in] resetCause Pointer to reset cause driver recording each handled event in the
+     *                       crash record, or nullptr if unused (default = nullptr).
      */
     explicit Logic(driver::gpio::Interface& led,
                    driver::gpio::Interface& toggleButton,
                    driver::gpio::Interface& tempButton, 
-                   driver::timer::Interface& debounceTimer, 
+                   driver::timer::Interface* debounceTimer, 
                    driver::timer::Interface& toggleTimer,
                    driver::timer::Interface& tempTimer,
                    driver::serial::Interface& serial, 
                    driver::watchdog::Interface& watchdog, 
                    driver::eeprom::Interface& eeprom, 
-                   driver::tempsensor::Interface& tempSensor) noexcept;
+                   driver::tempsensor::Interface& tempSensor,
+                   scheduler::PowerManager* powerManager = nullptr,
+                   scheduler::Supervisor* supervisor = nullptr,
+                   driver::reset::Interface* resetCause = nullptr) noexcept;
 
     /**
      * @brief Destructor.
@@ -92,10 +133,25 @@ public:
     /**
      * @brief Run the system.  
      * 
+     *        Posted events are handled one at a time in priority order, each run to completion.
+     *        The CPU is put in idle sleep mode whenever no events are pending, and woken up by 
+     *        the next interrupt. The watchdog timer is reset after each wake-up, or serviced 
+     *        via the supervisor if used, in which case the main loop checks in as a task.
+     * 
      * @param[in] stop Reference to stop flag.                                                            
      */
     void run(const bool& stop) noexcept override;
 
+    /**
+     * @brief Post event to be handled by the system.
+     * 
+     *        The event is handled in main context by run(), in priority order. This method can
+     *        be called from interrupt context.
+     * 
+     * @param[in] event The event to post.
+     */
+    void postEvent(Event event) noexcept override;
+
     /**
      * @brief Handle button event.
      * 
@@ -147,14 +203,86 @@ protected:
     virtual void printTemperature() noexcept;
 
 private:
-    void handleToggleButtonPressed() noexcept;
-    void handleTempButtonPressed() noexcept;
+    /**
+     * @brief Enumeration of states.
+     */
+    enum class State : uint8_t
+    {
+        Idle,               // Toggle timer disabled, buttons enabled.
+        Toggling,           // Toggle timer enabled, buttons enabled.
+        IdleDebouncing,     // Toggle timer disabled, buttons disabled during debounce period.
+        TogglingDebouncing, // Toggle timer enabled, buttons disabled during debounce period.
+        Count,              // Number of states.
+    };
+
+    /**
+     * @brief Enumeration of state machine inputs.
+     */
+    enum class Input : uint8_t
+    {
+        ButtonActivity,  // Button activity detected.
+        ToggleRequest,   // Toggle button pressed or command 't' received.
+        TempRequest,     // Temperature button pressed or command 'r' received.
+        DebounceTimeout, // Debounce timer timeout.
+        ToggleTimeout,   // Toggle timer timeout.
+        TempTimeout,     // Temperature timer timeout.
+        StateRequest,    // Command 's' received.
+        PowerRequest,    // Command 'p' received.
+        Count,           // Number of inputs.
+    };
+
+    /** State machine implementing the logic. */
+    using StateMachine = scheduler::StateMachine<Logic, State, Input>;
+
+    /** Parser of serial commands. */
+    using CommandParser = utils::CommandParser<Logic>;
+
+    static void startDebounce(Logic& logic) noexcept;
+    static void endDebounce(Logic& logic) noexcept;
+    static void startToggle(Logic& logic) noexcept;
+    static void stopToggle(Logic& logic) noexcept;
+    static void toggleLed(Logic& logic) noexcept;
+    static void readTemp(Logic& logic) noexcept;
+    static void printTemp(Logic& logic) noexcept;
+    static void printToggleState(Logic& logic) noexcept;
+    static void printPowerStatistics(Logic& logic) noexcept;
+
+    static bool dumpEepromCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool helpCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool memoryCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool powerCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool readTempCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool resetCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool stateCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool setToggleCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool toggleCommand(Logic& logic, const utils::Tokens& args) noexcept;
+    static bool tempIntervalCommand(Logic& logic, const utils::Tokens& args) noexcept;
+
     void restoreToggleStateFromEeprom() noexcept;
     bool readSerialPort() noexcept;
+    void handleReceivedChar(char character) noexcept;
+    bool executeCommand() noexcept;
+    void handleEvent(Event event) noexcept;
+    void kickWatchdog() noexcept;
 
     /** Toggle state address in EEPROM. */
     static constexpr uint16_t ToggleStateAddr{0U};
 
+    /** The max time between two main loop iterations when supervised, in milliseconds. */
+    static constexpr uint32_t MainLoopDeadline_ms{500U};
+
+    /** Transition table of the state machine. */
+    static const StateMachine::Table TransitionTable;
+
+    /** The number of serial commands. */
+    static constexpr uint8_t CommandCount{10U};
+
+    /** Serial command table, sorted by name. */
+    static const CommandParser::Command Commands[CommandCount];
+
+    /** Size of the command line buffer, including the null terminator. */
+    static constexpr uint8_t CommandLineSize{32U};
+
     /** Reference to the LED to toggle. */
     driver::gpio::Interface& myLed;
 
@@ -164,8 +292,8 @@ private:
     /** Button to read the temperature. */
     driver::gpio::Interface& myTempButton;
 
-    /** Debounce timer to mitigate effects of contact bounces. */
-    driver::timer::Interface& myDebounceTimer;
+    /** Debounce timer to mitigate effects of contact bounces (nullptr if unused). */
+    driver::timer::Interface* myDebounceTimer;
 
     /** Timer to toggle the LED. */
     driver::timer::Interface& myToggleTimer;
@@ -184,5 +312,32 @@ private:
 
     /** Temperature sensor. */
     driver::tempsensor::Interface& myTempSensor;
+
+    /** Queue holding events to handle. */
+    scheduler::EventQueue myEvents;
+
+    /** Power manager selecting the sleep mode when idle (nullptr if unused). */
+    scheduler::PowerManager* myPowerManager;
+
+    /** Watchdog supervisor monitoring the main loop (nullptr if unused). */
+    scheduler::Supervisor* mySupervisor;
+
+    /** The task ID of the main loop in the supervisor (-1 if unsupervised). */
+    int8_t myMainLoopTask;
+
+    /** Reset cause driver holding the crash record (nullptr if unused). */
+    driver::reset::Interface* myResetCause;
+
+    /** State machine implementing the logic. */
+    StateMachine myStateMachine;
+
+    /** Parser of serial commands. */
+    CommandParser myCommandParser;
+
+    /** Buffer holding the command line being received. */
+    char myCommandLine[CommandLineSize];
+
+    /** The length of the command line being received (CommandLineSize on overflow). */
+    uint8_t myCommandLength;
 };
 } // namespace logic
\ No newline at end of file
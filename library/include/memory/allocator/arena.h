@@ -0,0 +1,168 @@
+/**
+ * @brief Arena allocator, allocating blocks from a static buffer by bumping a pointer.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "memory/allocator/interface.h"
+
+namespace memory
+{
+namespace allocator
+{
+/**
+ * @brief Arena allocator, allocating blocks from a static buffer by bumping a pointer.
+ *
+ *        Allocation takes constant time and causes no fragmentation. Blocks are released in
+ *        bulk by resetting the arena to a marker, e.g. at the end of a scope via Arena::Scope.
+ *        Only the last allocated block can be resized in place or deallocated individually,
+ *        deallocation of any other block is deferred until the arena is reset.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Arena final : public Interface
+{
+public:
+    /** Marker of a position in the arena, used to release all blocks allocated after it. */
+    using Marker = size_t;
+
+    /** Scope releasing all blocks allocated in the arena during its lifetime. */
+    class Scope;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] buffer Pointer to the buffer to allocate blocks from.
+     * @param[in] size The size of the buffer in bytes.
+     */
+    explicit Arena(uint8_t* buffer, size_t size) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Arena() noexcept override = default;
+
+    /**
+     * @brief Allocate a new block.
+     *
+     * @param[in] size The size of the block in bytes.
+     *
+     * @return Pointer to the new block, or nullptr if the arena is full.
+     */
+    void* allocate(size_t size) noexcept override;
+
+    /**
+     * @brief Resize given block.
+     *
+     *        The last allocated block is resized in place, any other block is copied to a
+     *        new block.
+     *
+     * @param[in] block Pointer to the block to resize, or nullptr to allocate a new block.
+     * @param[in] newSize The new size of the block in bytes, or 0 to deallocate the block.
+     *
+     * @return Pointer to the resized block, or nullptr if the reallocation failed.
+     */
+    void* reallocate(void* block, size_t newSize) noexcept override;
+
+    /**
+     * @brief Deallocate given block.
+     *
+     *        The memory is only reclaimed immediately if the block is the last allocated block.
+     *
+     * @param[in] block Pointer to the block to deallocate (ignored if nullptr).
+     */
+    void deallocate(void* block) noexcept override;
+
+    /**
+     * @brief Get the size of the arena.
+     *
+     * @return The size of the arena in bytes.
+     */
+    size_t capacity() const noexcept;
+
+    /**
+     * @brief Get the number of bytes in use, including alignment padding.
+     *
+     * @return The number of bytes in use.
+     */
+    size_t used() const noexcept;
+
+    /**
+     * @brief Get the current position in the arena.
+     *
+     * @return Marker of the current position.
+     */
+    Marker mark() const noexcept;
+
+    /**
+     * @brief Release all blocks allocated after given marker.
+     *
+     * @param[in] marker Marker obtained via mark() (ignored if beyond the current position).
+     */
+    void release(Marker marker) noexcept;
+
+    /**
+     * @brief Release all blocks.
+     */
+    void reset() noexcept;
+
+    Arena()                        = delete; // No default constructor.
+    Arena(const Arena&)            = delete; // No copy constructor.
+    Arena(Arena&&)                 = delete; // No move constructor.
+    Arena& operator=(const Arena&) = delete; // No copy assignment.
+    Arena& operator=(Arena&&)      = delete; // No move assignment.
+
+private:
+    /** Pointer to the buffer to allocate blocks from. */
+    uint8_t* myBuffer;
+
+    /** The size of the buffer in bytes. */
+    size_t myCapacity;
+
+    /** The number of bytes in use. */
+    size_t myUsed;
+
+    /** The offset of the last allocated block (equal to myUsed if unknown). */
+    size_t myLastBlock;
+};
+
+/**
+ * @brief Scope releasing all blocks allocated in an arena during its lifetime.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Arena::Scope final
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] arena Reference to the arena to release on destruction.
+     */
+    explicit Scope(Arena& arena) noexcept
+        : myArena{arena}
+        , myMarker{arena.mark()}
+    {}
+
+    /**
+     * @brief Destructor, releases all blocks allocated in the scope.
+     */
+    ~Scope() noexcept { myArena.release(myMarker); }
+
+    Scope()                        = delete; // No default constructor.
+    Scope(const Scope&)            = delete; // No copy constructor.
+    Scope(Scope&&)                 = delete; // No move constructor.
+    Scope& operator=(const Scope&) = delete; // No copy assignment.
+    Scope& operator=(Scope&&)      = delete; // No move assignment.
+
+private:
+    /** Reference to the arena to release on destruction. */
+    Arena& myArena;
+
+    /** The position of the arena when the scope was entered. */
+    const Marker myMarker;
+};
+} // namespace allocator
+} // namespace memory
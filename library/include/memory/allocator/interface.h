@@ -0,0 +1,59 @@
+/**
+ * @brief Memory allocator interface.
+ */
+#pragma once
+
+#include <stddef.h>
+
+namespace memory
+{
+namespace allocator
+{
+/** Alignment of allocated blocks in bytes. */
+constexpr size_t Alignment{alignof(max_align_t)};
+
+/**
+ * @brief Memory allocator interface.
+ * 
+ *        Allocators can be selected per container or smart pointer instance instead of the
+ *        heap, see utils::newMemory().
+ */
+class Interface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Interface() noexcept = default;
+
+    /**
+     * @brief Allocate a new block.
+     * 
+     * @param[in] size The size of the block in bytes.
+     * 
+     * @return Pointer to the new block, or nullptr if the allocation failed.
+     */
+    virtual void* allocate(size_t size) noexcept = 0;
+
+    /**
+     * @brief Resize given block.
+     * 
+     *        The content of the block is kept up to the smallest of the old and the new size.
+     * 
+     * @param[in] block Pointer to the block to resize, or nullptr to allocate a new block.
+     * @param[in] newSize The new size of the block in bytes, or 0 to deallocate the block.
+     * 
+     * @return Pointer to the resized block, or nullptr if the reallocation failed, in which
+     *         case the original block is kept (unless the new size is 0).
+     */
+    virtual void* reallocate(void* block, size_t newSize) noexcept = 0;
+
+    /**
+     * @brief Deallocate given block.
+     * 
+     * @param[in] block Pointer to the block to deallocate (ignored if nullptr).
+     */
+    virtual void deallocate(void* block) noexcept = 0;
+};
+} // namespace allocator
+} // namespace memory
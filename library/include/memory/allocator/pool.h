@@ -0,0 +1,133 @@
+/**
+ * @brief Pool allocator, allocating fixed-size blocks from a static buffer.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "memory/allocator/interface.h"
+
+namespace memory
+{
+namespace allocator
+{
+/**
+ * @brief Pool allocator, allocating fixed-size blocks from a static buffer.
+ *
+ *        Free blocks are kept in a linked list stored in the blocks themselves, so allocation
+ *        and deallocation take constant time and cause no fragmentation. A map holding one
+ *        bit per block tracks the free blocks, so blocks that are already free are rejected
+ *        on deallocation. Several pools with
+ *        different block sizes can be combined via allocator::SizeClasses.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Pool final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] buffer Pointer to the buffer holding the blocks.
+     * @param[in] bufferSize The size of the buffer in bytes, including one bit per block for
+     *                       the map of free blocks.
+     * @param[in] blockSize The min size of each block in bytes. The size is rounded up to
+     *                      hold a pointer and to keep the blocks aligned.
+     */
+    explicit Pool(uint8_t* buffer, size_t bufferSize, size_t blockSize) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Pool() noexcept override = default;
+
+    /**
+     * @brief Allocate a new block.
+     *
+     * @param[in] size The size of the block in bytes.
+     *
+     * @return Pointer to the new block, or nullptr if the size exceeds the block size or
+     *         if no blocks are free.
+     */
+    void* allocate(size_t size) noexcept override;
+
+    /**
+     * @brief Resize given block.
+     *
+     *        The block is kept as long as the new size doesn't exceed the block size.
+     *
+     * @param[in] block Pointer to the block to resize, or nullptr to allocate a new block.
+     * @param[in] newSize The new size of the block in bytes, or 0 to deallocate the block.
+     *
+     * @return Pointer to the block, or nullptr if the new size exceeds the block size.
+     */
+    void* reallocate(void* block, size_t newSize) noexcept override;
+
+    /**
+     * @brief Deallocate given block.
+     *
+     * @param[in] block Pointer to the block to deallocate (ignored if not owned by the pool
+     *                  or already free).
+     */
+    void deallocate(void* block) noexcept override;
+
+    /**
+     * @brief Check whether given block is owned by the pool.
+     *
+     * @param[in] block Pointer to the block to check.
+     *
+     * @return True if the block is owned by the pool, false otherwise.
+     */
+    bool owns(const void* block) const noexcept;
+
+    /**
+     * @brief Get the size of each block.
+     *
+     * @return The size of each block in bytes.
+     */
+    size_t blockSize() const noexcept;
+
+    /**
+     * @brief Get the number of blocks.
+     *
+     * @return The number of blocks in the pool.
+     */
+    size_t blockCount() const noexcept;
+
+    /**
+     * @brief Get the number of free blocks.
+     *
+     * @return The number of free blocks in the pool.
+     */
+    size_t freeCount() const noexcept;
+
+    Pool()                       = delete; // No default constructor.
+    Pool(const Pool&)            = delete; // No copy constructor.
+    Pool(Pool&&)                 = delete; // No move constructor.
+    Pool& operator=(const Pool&) = delete; // No copy assignment.
+    Pool& operator=(Pool&&)      = delete; // No move assignment.
+
+private:
+    size_t blockIndex(const void* block) const noexcept;
+
+    /** Pointer to the first block. */
+    uint8_t* myBlocks;
+
+    /** Map of free blocks, one bit per block (1 = free). */
+    uint8_t* myFreeMap;
+
+    /** Pointer to the first free block. */
+    void* myFreeList;
+
+    /** The size of each block in bytes. */
+    const size_t myBlockSize;
+
+    /** The number of blocks. */
+    size_t myBlockCount;
+
+    /** The number of free blocks. */
+    size_t myFreeCount;
+};
+} // namespace allocator
+} // namespace memory
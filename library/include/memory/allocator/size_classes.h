@@ -0,0 +1,87 @@
+/**
+ * @brief Size-class allocator, dispatching allocations to pools of different block sizes.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "memory/allocator/interface.h"
+
+namespace memory
+{
+namespace allocator
+{
+/** Pool allocator, allocating fixed-size blocks from a static buffer. */
+class Pool;
+
+/**
+ * @brief Size-class allocator, dispatching allocations to pools of different block sizes.
+ *
+ *        Each block is allocated from the pool with the smallest block size that fits, falling
+ *        back to pools with larger blocks when that pool is exhausted. Blocks growing beyond
+ *        their block size are moved to a pool with larger blocks.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class SizeClasses final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] pools Pointer to array holding the pools, sorted by strictly ascending block
+     *                  size. If the pools aren't sorted, no pools are used, i.e. all
+     *                  allocations fail.
+     * @param[in] poolCount The number of pools.
+     */
+    explicit SizeClasses(Pool* const* pools, uint8_t poolCount) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~SizeClasses() noexcept override = default;
+
+    /**
+     * @brief Allocate a new block.
+     *
+     * @param[in] size The size of the block in bytes.
+     *
+     * @return Pointer to the new block, or nullptr if no pool has a large enough free block.
+     */
+    void* allocate(size_t size) noexcept override;
+
+    /**
+     * @brief Resize given block.
+     *
+     * @param[in] block Pointer to the block to resize, or nullptr to allocate a new block.
+     * @param[in] newSize The new size of the block in bytes, or 0 to deallocate the block.
+     *
+     * @return Pointer to the resized block, or nullptr if the reallocation failed.
+     */
+    void* reallocate(void* block, size_t newSize) noexcept override;
+
+    /**
+     * @brief Deallocate given block.
+     *
+     * @param[in] block Pointer to the block to deallocate (ignored if not owned by any pool).
+     */
+    void deallocate(void* block) noexcept override;
+
+    SizeClasses()                              = delete; // No default constructor.
+    SizeClasses(const SizeClasses&)            = delete; // No copy constructor.
+    SizeClasses(SizeClasses&&)                 = delete; // No move constructor.
+    SizeClasses& operator=(const SizeClasses&) = delete; // No copy assignment.
+    SizeClasses& operator=(SizeClasses&&)      = delete; // No move assignment.
+
+private:
+    Pool* owner(const void* block) const noexcept;
+
+    /** Pointer to array holding the pools, sorted by ascending block size. */
+    Pool* const* myPools;
+
+    /** The number of pools. */
+    const uint8_t myPoolCount;
+};
+} // namespace allocator
+} // namespace memory
@@ -8,35 +8,74 @@
 
 namespace memory
 {
+/**
+ * @brief Control block holding the reference count.
+ * 
+ * @tparam T The pointer type.
+ */
+template <typename T>
+struct SharedPtr<T>::ControlBlock
+{
+    size_t refCount; // The number of pointers sharing ownership of data.
+    bool fused;      // Indicate whether the data is held by the same block.
+};
+
+/**
+ * @brief Block holding both the control block and the data.
+ * 
+ * @tparam T The pointer type.
+ */
+template <typename T>
+struct SharedPtr<T>::FusedBlock
+{
+    ControlBlock control; // Control block, placed first to share address with the block.
+    T data;               // Shared data.
+};
 
 // -----------------------------------------------------------------------------
 template <typename T>
 SharedPtr<T>::SharedPtr(T* data) noexcept
     : myData{data}
-    , myRefCount{newRefCount()} {}
+    , myControl{nullptr}
+    , myAllocator{nullptr} 
+{
+    adopt();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+SharedPtr<T>::SharedPtr(T* data, allocator::Interface& allocator) noexcept
+    : myData{data}
+    , myControl{nullptr}
+    , myAllocator{&allocator} 
+{
+    adopt();
+}
 
 // -----------------------------------------------------------------------------
 template <typename T>
 SharedPtr<T>::SharedPtr(const SharedPtr<T>& other) noexcept
     : myData{other.myData}
-    , myRefCount{other.myRefCount} 
+    , myControl{other.myControl} 
+    , myAllocator{other.myAllocator}
 {
-    (*myRefCount)++;
+    incrementReferenceCount();
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 SharedPtr<T>::SharedPtr(SharedPtr<T>&& other) noexcept
     : myData{other.myData}
-    , myRefCount{other.myRefCount}
+    , myControl{other.myControl}
+    , myAllocator{other.myAllocator}
 {
-    other.myData     = nullptr;
-    other.myRefCount = nullptr;
+    other.myData    = nullptr;
+    other.myControl = nullptr;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-SharedPtr<T>::~SharedPtr() noexcept { reset(); }
+SharedPtr<T>::~SharedPtr() noexcept { decrementReferenceCount(); }
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -44,10 +83,11 @@ SharedPtr<T>& SharedPtr<T>::operator=(const SharedPtr<T>& other) noexcept
 {
     if (this != &other)
     {
-        release();
-        myData = other.myData;
-        myRefCount = other.myRefCount;
-        (*myRefCount)++;
+        decrementReferenceCount();
+        myData      = other.myData;
+        myControl   = other.myControl;
+        myAllocator = other.myAllocator;
+        incrementReferenceCount();
     }
     return *this;
 }
@@ -58,11 +98,12 @@ SharedPtr<T>& SharedPtr<T>::operator=(SharedPtr<T>&& other) noexcept
 {
     if (this != &other)
     {
-        release();
-        myData           = other.myData;
-        myRefCount       = other.myRefCount;
-        other.myData     = nullptr;
-        other.myRefCount = nullptr;
+        decrementReferenceCount();
+        myData          = other.myData;
+        myControl       = other.myControl;
+        myAllocator     = other.myAllocator;
+        other.myData    = nullptr;
+        other.myControl = nullptr;
     }
     return *this;
 }
@@ -95,58 +136,187 @@ T* SharedPtr<T>::get() noexcept { return myData; }
 template <typename T>
 const T* SharedPtr<T>::get() const noexcept { return myData; }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t SharedPtr<T>::useCount() const noexcept
+{
+    const size_t* count{refCount()};
+    return nullptr != count ? *count : 0U;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 void SharedPtr<T>::reset(T* newData) noexcept
 {
-    release();
-    myData     = newData;
-    myRefCount = newRefCount();
+    decrementReferenceCount();
+    myData = newData;
+    adopt();
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 T* SharedPtr<T>::release() noexcept
 {
-    decrementReferenceCount();
-    myData     = nullptr;
-    myRefCount = nullptr;
-    return nullptr;
+    size_t* count{refCount()};
+
+    // Keep the ownership if this is the last pointer holding data allocated together with its
+    // control block, since the data can't be deallocated separately.
+    if ((nullptr != count) && (1U == *count) && (nullptr != myControl) && myControl->fused) 
+    { 
+        return nullptr; 
+    }
+
+    // Only pass the ownership to the caller if no other pointer shares it.
+    if ((nullptr == count) || (1U < *count))
+    {
+        decrementReferenceCount();
+        return nullptr;
+    }
+    T* data{myData};
+    *count = 0U;
+    utils::deleteMemory(myControl, myAllocator);
+    myData = nullptr;
+    return data;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-size_t* SharedPtr<T>::newRefCount() noexcept { return new size_t{1U}; }
+template <typename... Args>
+SharedPtr<T> SharedPtr<T>::create(allocator::Interface* allocator, Args&&... args) noexcept
+{
+    SharedPtr<T> ptr{};
+    ptr.myAllocator = allocator;
+
+    if constexpr (Intrusive)
+    {
+        // The object holds the count, so no control block is needed.
+        ptr.myData = utils::newMemory<T>(1U, allocator);
+        if (nullptr == ptr.myData) { return ptr; }
+        *ptr.myData = T{utils::forward<Args>(args)...};
+        static_cast<RefCounted*>(ptr.myData)->myRefCount  = 1U;
+        static_cast<RefCounted*>(ptr.myData)->myAllocator = allocator;
+    }
+    else
+    {
+        // Allocate the control block and the object as a single block.
+        auto block{utils::newMemory<FusedBlock>(1U, allocator)};
+        if (nullptr == block) { return ptr; }
+        block->control = ControlBlock{1U, true};
+        block->data    = T{utils::forward<Args>(args)...};
+        ptr.myControl  = &block->control;
+        ptr.myData     = &block->data;
+    }
+    return ptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename SharedPtr<T>::ControlBlock* SharedPtr<T>::newControlBlock(
+    allocator::Interface* allocator) noexcept 
+{ 
+    auto control{utils::newMemory<ControlBlock>(1U, allocator)};
+    if (control) { *control = ControlBlock{1U, false}; }
+    return control;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void SharedPtr<T>::adopt() noexcept
+{
+    if (nullptr == myData) { return; }
+    if constexpr (Intrusive) 
+    { 
+        // Store the allocator in the object when it's first shared, else use the stored one,
+        // since a pointer created from a raw pointer doesn't know the allocator of the object.
+        auto object{static_cast<RefCounted*>(myData)};
+        if (0U == object->myRefCount) { object->myAllocator = myAllocator; }
+        else { myAllocator = object->myAllocator; }
+        incrementReferenceCount(); 
+    }
+    else
+    {
+        myControl = newControlBlock(myAllocator);
+
+        // Release the data if the control block couldn't be allocated.
+        if (nullptr == myControl) { utils::deleteMemory(myData, myAllocator); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t* SharedPtr<T>::refCount() const noexcept
+{
+    if constexpr (Intrusive) 
+    { 
+        return nullptr != myData ? &static_cast<RefCounted*>(myData)->myRefCount : nullptr; 
+    }
+    else { return nullptr != myControl ? &myControl->refCount : nullptr; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void SharedPtr<T>::incrementReferenceCount() noexcept
+{
+    size_t* count{refCount()};
+    if (count) { (*count)++; }
+}
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void SharedPtr<T>::decrementReferenceCount() noexcept
 {
-    if (myRefCount && (--(*myRefCount) == 0U)) { releaseMemory(); }
+    size_t* count{refCount()};
+    if (count && (--(*count) == 0U)) { releaseMemory(); }
+    myData    = nullptr;
+    myControl = nullptr;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void SharedPtr<T>::releaseMemory() noexcept
 {
-    utils::deleteMemory(myData);
-    utils::deleteMemory(myRefCount);
-    myData     = nullptr;
-    myRefCount = nullptr;
+    if ((nullptr != myControl) && myControl->fused)
+    {
+        // The data is held by the same block as the control block.
+        auto block{reinterpret_cast<FusedBlock*>(myControl)};
+        utils::deleteMemory(block, myAllocator);
+    }
+    else
+    {
+        // Objects embedding their count also hold the allocator they were allocated with.
+        allocator::Interface* dataAllocator{myAllocator};
+        if constexpr (Intrusive) 
+        { 
+            dataAllocator = static_cast<RefCounted*>(myData)->myAllocator; 
+        }
+        utils::deleteMemory(myData, dataAllocator);
+        utils::deleteMemory(myControl, myAllocator);
+    }
+    myData    = nullptr;
+    myControl = nullptr;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Args>
 SharedPtr<T> makeShared(Args&&... args) noexcept
 {
-    return SharedPtr<T>{utils::newObject(utils::forward<Args>(args)...)};
+    return SharedPtr<T>::create(nullptr, utils::forward<Args>(args)...);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 SharedPtr<T> makeShared() noexcept
 {
+    static_assert(!type_traits::is_base_of<RefCounted, T>::value, 
+                  "Fields of reference counted objects cannot be shared!");
     return SharedPtr<T>{utils::newMemory<T>(Size)};
 }
 
-} // namespace memory
\ No newline at end of file
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+SharedPtr<T> allocateShared(allocator::Interface& allocator, Args&&... args) noexcept
+{
+    return SharedPtr<T>::create(&allocator, utils::forward<Args>(args)...);
+}
+
+} // namespace memory
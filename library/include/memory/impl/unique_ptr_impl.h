@@ -12,12 +12,20 @@ namespace memory
 // -----------------------------------------------------------------------------
 template <typename T>
 UniquePtr<T>::UniquePtr(T* data) noexcept
-    : myData{data} {}
+    : myData{data}
+    , myAllocator{nullptr} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+UniquePtr<T>::UniquePtr(T* data, allocator::Interface& allocator) noexcept
+    : myData{data}
+    , myAllocator{&allocator} {}
 
 // -----------------------------------------------------------------------------
 template <typename T>
 UniquePtr<T>::UniquePtr(UniquePtr<T>&& other) noexcept
     : myData{other.myData} 
+    , myAllocator{other.myAllocator}
 { 
     other.myData = nullptr; 
 }
@@ -33,6 +41,7 @@ UniquePtr<T>& UniquePtr<T>::operator=(UniquePtr<T>&& other) noexcept
     if (this != &other)
     {
         reset(other.myData);
+        myAllocator  = other.myAllocator;
         other.myData = nullptr;
     }
     return *this;
@@ -70,7 +79,7 @@ const T* UniquePtr<T>::get() const noexcept { return myData; }
 template <typename T>
 void UniquePtr<T>::reset(T* newData) noexcept
 {
-    utils::deleteMemory(myData);
+    utils::deleteMemory(myData, myAllocator);
     myData = newData;
 }
 
@@ -85,16 +94,25 @@ T* UniquePtr<T>::release() noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Args>
-UniquePtr<T> makeUnique(Args&&... args)
+UniquePtr<T> makeUnique(Args&&... args) noexcept
 {
-    return UniquePtr<T>{utils::newObject(utils::forward<Args>(args)...)};
+    return UniquePtr<T>{utils::newObject<T>(utils::forward<Args>(args)...)};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-UniquePtr<T> makeUnique()
+UniquePtr<T> makeUnique() noexcept
 {
     return UniquePtr<T>{utils::newMemory<T>(Size)};
 }
 
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+UniquePtr<T> allocateUnique(allocator::Interface& allocator, Args&&... args) noexcept
+{
+    auto data{utils::newMemory<T>(1U, &allocator)};
+    if (data) { *data = T{utils::forward<Args>(args)...}; }
+    return UniquePtr<T>{data, allocator};
+}
+
 } // namespace memory
\ No newline at end of file
@@ -0,0 +1,103 @@
+/**
+ * @brief Memory instrumentation, measuring stack and heap usage.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace memory
+{
+/**
+ * @brief Structure of heap statistics.
+ */
+struct HeapStats
+{
+    /** The number of bytes currently allocated. */
+    size_t current;
+
+    /** The max number of bytes allocated at once, i.e. the heap high-water mark. */
+    size_t peak;
+
+    /** The total number of allocated blocks, excluding resizes of existing blocks. */
+    uint32_t allocationCount;
+
+    /** The size of the largest block that can currently be allocated (0 when testing). */
+    size_t largestFreeBlock;
+};
+
+/** Byte value used to paint unused stack memory. */
+constexpr uint8_t StackPaint{0xC5U};
+
+/**
+ * @brief Set enablement of heap statistics.
+ *
+ *        Allocations via utils::newMemory(), utils::reallocMemory() and utils::deleteMemory()
+ *        are tracked while enabled. Blocks must be allocated and deallocated while enabled
+ *        to keep the current number of allocated bytes correct.
+ *
+ * @param[in] enable True to enable heap statistics, false otherwise.
+ */
+void setHeapStatsEnabled(bool enable) noexcept;
+
+/**
+ * @brief Check whether heap statistics are enabled.
+ *
+ * @return True if heap statistics are enabled, false otherwise.
+ */
+bool isHeapStatsEnabled() noexcept;
+
+/**
+ * @brief Get the heap statistics.
+ *
+ * @return The heap statistics gathered since heap statistics were enabled or reset.
+ */
+HeapStats heapStats() noexcept;
+
+/**
+ * @brief Reset the peak and the allocation count of the heap statistics.
+ *
+ *        The current number of allocated bytes is kept, since the blocks are still allocated.
+ */
+void resetHeapStats() noexcept;
+
+/**
+ * @brief Paint given memory region with the stack paint.
+ *
+ *        On target, the stack is painted automatically at early boot.
+ *
+ * @param[in] begin Pointer to the beginning of the region.
+ * @param[in] end Pointer to the end of the region.
+ */
+void paintStack(uint8_t* begin, const uint8_t* end) noexcept;
+
+/**
+ * @brief Get the max number of bytes used in a painted stack region.
+ *
+ *        The stack grows downwards from the end of the region, hence the region is scanned
+ *        from the beginning until the first byte not holding the stack paint.
+ *
+ * @param[in] begin Pointer to the beginning of the region.
+ * @param[in] end Pointer to the end of the region.
+ *
+ * @return The number of bytes that have been used, i.e. the stack high-water mark.
+ */
+size_t stackHighWater(const uint8_t* begin, const uint8_t* end) noexcept;
+
+/**
+ * @brief Get the max number of bytes used by the stack since boot.
+ *
+ *        The stack is scanned from the top of the heap, so heap memory allocated after the
+ *        stack has used it may hide part of the stack usage.
+ *
+ * @return The stack high-water mark in bytes (0 when testing).
+ */
+size_t stackHighWater() noexcept;
+
+/**
+ * @brief Get the number of bytes between the top of the heap and the stack.
+ *
+ * @return The number of free bytes between the heap and the stack (0 when testing).
+ */
+size_t stackHeapGap() noexcept;
+} // namespace memory
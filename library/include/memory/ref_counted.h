@@ -0,0 +1,80 @@
+/**
+ * @brief Base class for objects embedding their own reference count.
+ */
+#pragma once
+
+#include <stddef.h>
+
+namespace memory
+{
+namespace allocator
+{
+/** Allocator interface. */
+class Interface;
+} // namespace allocator
+
+/** Shared pointer implementation. */
+template <typename T>
+class SharedPtr;
+
+/**
+ * @brief Base class for objects embedding their own reference count.
+ * 
+ *        Shared pointers holding objects derived from this class use the embedded count
+ *        instead of a control block, so no extra memory is allocated and new shared pointers
+ *        can be created from raw pointers to objects that are already shared. The allocator
+ *        the object was allocated with is stored along with the count, so the object is
+ *        deallocated correctly by whichever pointer happens to be the last one.
+ * 
+ *        The count is initialized by the constructor and by memory::makeShared() and 
+ *        memory::allocateShared(), objects created otherwise must not be shared. Copying an
+ *        object doesn't copy its count.
+ */
+class RefCounted
+{
+public:
+    /**
+     * @brief Get the number of shared pointers sharing ownership of the object.
+     * 
+     * @return The number of shared pointers sharing ownership of the object.
+     */
+    size_t refCount() const noexcept { return myRefCount; }
+
+protected:
+    /** 
+     * @brief Constructor.
+     */
+    RefCounted() noexcept 
+        : myRefCount{}
+        , myAllocator{nullptr} {}
+
+    /** 
+     * @brief Destructor.
+     */
+    ~RefCounted() noexcept = default;
+
+    /** 
+     * @brief Copy constructor, the new object isn't shared by any pointers.
+     */
+    RefCounted(const RefCounted&) noexcept 
+        : myRefCount{}
+        , myAllocator{nullptr} {}
+
+    /** 
+     * @brief Copy assignment, the count and the allocator of the assigned object are kept.
+     * 
+     * @return Reference to this object.
+     */
+    RefCounted& operator=(const RefCounted&) noexcept { return *this; }
+
+private:
+    template <typename T>
+    friend class SharedPtr;
+
+    /** The number of shared pointers sharing ownership of the object. */
+    size_t myRefCount;
+
+    /** Pointer to the allocator holding the object (nullptr = heap). */
+    allocator::Interface* myAllocator;
+};
+} // namespace memory
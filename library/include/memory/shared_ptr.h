@@ -3,6 +3,9 @@
  */
 #pragma once
 
+#include "memory/allocator/interface.h"
+#include "memory/ref_counted.h"
+#include "utils/type_traits.h"
 #include "utils/utils.h"
 
 namespace memory
@@ -10,6 +13,10 @@ namespace memory
 /**
  * @brief Shared pointer implementation.
  * 
+ *        The reference count is held by a control block, which is allocated together with
+ *        the data when created via memory::makeShared() or memory::allocateShared(). Data
+ *        derived from memory::RefCounted embeds its own count, no control block is used.
+ * 
  * @tparam T The pointer type.
  */
 template <typename T>
@@ -23,6 +30,16 @@ public:
      */
     SharedPtr(T* data = nullptr) noexcept;
 
+    /**
+     * @brief Create new shared pointer holding data allocated via given allocator.
+     * 
+     *        The control block is allocated via the same allocator.
+     * 
+     * @param[in] data Pointer to data for which to take ownership.
+     * @param[in] allocator Reference to the allocator the data was allocated with.
+     */
+    explicit SharedPtr(T* data, allocator::Interface& allocator) noexcept;
+
     /**
      * @brief Create new shared pointer, which shares ownership with another pointer.
      * 
@@ -111,9 +128,18 @@ public:
      */
     const T* get() const noexcept;
 
+    /**
+     * @brief Get the number of pointers sharing ownership of held data.
+     * 
+     * @return The number of pointers sharing ownership of held data, or 0 if no data is held.
+     */
+    size_t useCount() const noexcept;
+
     /**
      * @brief Reset shared pointer by releasing currently held data.
      * 
+     *        New data must have been allocated via the same allocator as the held data.
+     * 
      * @param[in] newData Pointer to new data to take ownership over (default = none).
      */
     void reset(T* newData = nullptr) noexcept;
@@ -121,22 +147,47 @@ public:
     /**
      * @brief Release ownership over held data.
      * 
-     * @return Pointer to currently held data.
+     * @return Pointer to currently held data if this was the last pointer sharing ownership
+     *         of it, in which case the ownership is passed to the caller, else nullptr. Data 
+     *         allocated together with its control block is never passed to the caller, the
+     *         last pointer holding it keeps the ownership instead.
      */
     T* release() noexcept;
 
 private:
 
-    static size_t* newRefCount() noexcept;
+    /** Control block holding the reference count. */
+    struct ControlBlock;
+
+    /** Block holding both the control block and the data. */
+    struct FusedBlock;
+
+    /** Indicate whether the data embeds its own reference count. */
+    static constexpr bool Intrusive{type_traits::is_base_of<RefCounted, T>::value};
+
+    template <typename U, typename... Args>
+    friend SharedPtr<U> makeShared(Args&&... args) noexcept;
+    template <typename U, typename... Args>
+    friend SharedPtr<U> allocateShared(allocator::Interface& allocator, Args&&... args) noexcept;
+
+    template <typename... Args>
+    static SharedPtr<T> create(allocator::Interface* allocator, Args&&... args) noexcept;
+    static ControlBlock* newControlBlock(allocator::Interface* allocator) noexcept;
+    void adopt() noexcept;
+    size_t* refCount() const noexcept;
+    void incrementReferenceCount() noexcept;
     void decrementReferenceCount() noexcept;
     void releaseMemory() noexcept;
 
-    T* myData;          // Pointer to shared data/memory.
-    size_t* myRefCount; // The number of pointers sharing ownership of data.
+    T* myData;                         // Pointer to shared data/memory.
+    ControlBlock* myControl;           // Pointer to control block (nullptr if intrusive).
+    allocator::Interface* myAllocator; // Pointer to allocator holding the data (nullptr = heap).
 };
 
 /**
- * @brief Create shared pointer taking ownership of given data.
+ * @brief Create shared pointer holding a new object.
+ * 
+ *        The object and its control block are allocated as a single block.
  * 
  * @tparam T The pointer type.
  * @tparam Args The types of arguments to pass to the constructor of T.
@@ -159,6 +210,22 @@ SharedPtr<T> makeShared(Args&&... args) noexcept;
 template <typename T, size_t Size>
 SharedPtr<T> makeShared() noexcept;
 
+/**
+ * @brief Create shared pointer holding a new object allocated via given allocator.
+ * 
+ *        The object and its control block are allocated as a single block.
+ * 
+ * @tparam T The pointer type.
+ * @tparam Args The types of arguments to pass to the constructor of T.
+ * 
+ * @param[in] allocator Reference to the allocator to allocate the object with.
+ * @param[in] args The arguments to pass to the constructor of T.
+ * 
+ * @return Shared pointer holding ownership over the new object.
+ */
+template <typename T, typename... Args>
+SharedPtr<T> allocateShared(allocator::Interface& allocator, Args&&... args) noexcept;
+
 } // namespace memory
 
 #include "impl/shared_ptr_impl.h"
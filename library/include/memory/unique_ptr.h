@@ -3,6 +3,7 @@
  */
 #pragma once
 
+#include "memory/allocator/interface.h"
 #include "utils/utils.h"
 
 namespace memory
@@ -26,6 +27,14 @@ public:
      */
     explicit UniquePtr(T* data = nullptr) noexcept;
 
+    /**
+     * @brief Create new unique pointer holding data allocated via given allocator.
+     * 
+     * @param[in] data Pointer to data for which to take ownership.
+     * @param[in] allocator Reference to the allocator the data was allocated with.
+     */
+    explicit UniquePtr(T* data, allocator::Interface& allocator) noexcept;
+
     /**
      * @brief Create new unique pointer, which takes ownership over memory owned by other pointer.
      * 
@@ -99,6 +108,8 @@ public:
     /**
      * @brief Reset unique pointer by releasing currently held data.
      * 
+     *        New data must have been allocated via the same allocator as the held data.
+     * 
      * @param[in] newData Pointer to new data to take ownership over (default = none).
      */
     void reset(T* newData = nullptr) noexcept;
@@ -114,7 +125,8 @@ public:
     UniquePtr<T>& operator=(const UniquePtr<T>&) = delete; // No copy assignment.
 
 private:
-    T* myData; // Pointer to unique data.
+    T* myData;                         // Pointer to unique data.
+    allocator::Interface* myAllocator; // Pointer to allocator holding the data (nullptr = heap).
 };
 
 /**
@@ -141,6 +153,20 @@ UniquePtr<T> makeUnique(Args&&... args) noexcept;
 template <typename T, size_t Size>
 UniquePtr<T> makeUnique() noexcept;
 
+/**
+ * @brief Create unique pointer holding a new object allocated via given allocator.
+ * 
+ * @tparam T The pointer type.
+ * @tparam Args The types of arguments to pass to the constructor of T.
+ * 
+ * @param[in] allocator Reference to the allocator to allocate the object with.
+ * @param[in] args The arguments to pass to the constructor of T.
+ * 
+ * @return Unique pointer holding ownership over the new object.
+ */
+template <typename T, typename... Args>
+UniquePtr<T> allocateUnique(allocator::Interface& allocator, Args&&... args) noexcept;
+
 } // namespace memory
 
 #include "impl/unique_ptr_impl.h"
@@ -0,0 +1,225 @@
+/**
+ * @brief Implementation details of class ml::Matrix.
+ * 
+ * @note Don't include this header, use <matrix.h> instead!
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace ml
+{
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+Matrix<RowCount, ColumnCount>::Matrix() noexcept
+    : myData{} {}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+Matrix<RowCount, ColumnCount>::Matrix(const double (&values)[RowCount * ColumnCount]) noexcept
+    : Matrix()
+{
+    for (size_t i{}; i < size(); ++i) { myData[i] = values[i]; }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+constexpr size_t Matrix<RowCount, ColumnCount>::rows() noexcept { return RowCount; }
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+constexpr size_t Matrix<RowCount, ColumnCount>::columns() noexcept { return ColumnCount; }
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+constexpr size_t Matrix<RowCount, ColumnCount>::size() noexcept 
+{ 
+    return RowCount * ColumnCount; 
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+double& Matrix<RowCount, ColumnCount>::operator()(const size_t row, const size_t column) noexcept
+{
+    return myData[row * ColumnCount + column];
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+const double& Matrix<RowCount, ColumnCount>::operator()(const size_t row, 
+                                                        const size_t column) const noexcept
+{
+    return myData[row * ColumnCount + column];
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+double& Matrix<RowCount, ColumnCount>::operator[](const size_t index) noexcept 
+{ 
+    return myData[index]; 
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+const double& Matrix<RowCount, ColumnCount>::operator[](const size_t index) const noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+double* Matrix<RowCount, ColumnCount>::data() noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+const double* Matrix<RowCount, ColumnCount>::data() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+Matrix<ColumnCount, RowCount> Matrix<RowCount, ColumnCount>::transpose() const noexcept
+{
+    Matrix<ColumnCount, RowCount> result{};
+    for (size_t row{}; row < RowCount; ++row)
+    {
+        for (size_t column{}; column < ColumnCount; ++column) 
+        { 
+            result(column, row) = (*this)(row, column); 
+        }
+    }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+template <size_t OtherColumnCount>
+Matrix<RowCount, OtherColumnCount> Matrix<RowCount, ColumnCount>::operator*(
+    const Matrix<ColumnCount, OtherColumnCount>& other) const noexcept
+{
+    // Transpose the other matrix so that each element is the inner product of two rows,
+    // which are both stored contiguously.
+    const auto otherTransposed{other.transpose()};
+    Matrix<RowCount, OtherColumnCount> result{};
+
+    for (size_t row{}; row < RowCount; ++row)
+    {
+        for (size_t column{}; column < OtherColumnCount; ++column)
+        {
+            result(row, column) = dotProduct<ColumnCount>(&(*this)(row, 0U), 
+                                                          &otherTransposed(column, 0U));
+        }
+    }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+Matrix<RowCount, ColumnCount>& 
+    Matrix<RowCount, ColumnCount>::operator+=(const Matrix& other) noexcept
+{
+    for (size_t i{}; i < size(); ++i) { myData[i] += other.myData[i]; }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+Matrix<RowCount, ColumnCount>& 
+    Matrix<RowCount, ColumnCount>::operator*=(const double factor) noexcept
+{
+    for (size_t i{}; i < size(); ++i) { myData[i] *= factor; }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t RowCount, size_t ColumnCount>
+void Matrix<RowCount, ColumnCount>::clear() noexcept
+{
+    for (size_t i{}; i < size(); ++i) { myData[i] = 0.0; }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+constexpr double dotProduct(const double* x, const double* y) noexcept
+{
+    // Use four independent accumulators for the unrolled part.
+    double sum0{}, sum1{}, sum2{}, sum3{};
+    size_t i{};
+
+    for (; i + 4U <= Size; i += 4U)
+    {
+        sum0 += x[i]      * y[i];
+        sum1 += x[i + 1U] * y[i + 1U];
+        sum2 += x[i + 2U] * y[i + 2U];
+        sum3 += x[i + 3U] * y[i + 3U];
+    }
+
+    // Add the remaining elements, if any.
+    for (; i < Size; ++i) { sum0 += x[i] * y[i]; }
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+bool solve(const Matrix<Size, Size>& a, const Matrix<Size>& b, Matrix<Size>& x) noexcept
+{
+    // Work on copies to leave the given system unchanged.
+    Matrix<Size, Size> coefficients{a};
+    Matrix<Size> solution{b};
+
+    // Treat pivots that are negligible compared to the largest coefficient as zero.
+    double maxCoefficient{};
+    for (size_t i{}; i < coefficients.size(); ++i)
+    {
+        const double coefficient{utils::absolute(coefficients[i])};
+        if (maxCoefficient < coefficient) { maxCoefficient = coefficient; }
+    }
+    const double tolerance{maxCoefficient * 1e-12};
+
+    // Eliminate the coefficients below the diagonal, column by column.
+    for (size_t column{}; column < Size; ++column)
+    {
+        // Find the row with the largest pivot, return false if the system is singular.
+        size_t pivotRow{column};
+        for (size_t row{column + 1U}; row < Size; ++row)
+        {
+            if (utils::absolute(coefficients(pivotRow, column)) 
+                < utils::absolute(coefficients(row, column))) { pivotRow = row; }
+        }
+        if (tolerance >= utils::absolute(coefficients(pivotRow, column))) { return false; }
+
+        // Swap the pivot row into place.
+        if (pivotRow != column)
+        {
+            for (size_t i{column}; i < Size; ++i)
+            {
+                const double temp{coefficients(column, i)};
+                coefficients(column, i)   = coefficients(pivotRow, i);
+                coefficients(pivotRow, i) = temp;
+            }
+            const double temp{solution[column]};
+            solution[column]   = solution[pivotRow];
+            solution[pivotRow] = temp;
+        }
+
+        // Subtract the pivot row from the rows below.
+        for (size_t row{column + 1U}; row < Size; ++row)
+        {
+            const double factor{coefficients(row, column) / coefficients(column, column)};
+            for (size_t i{column}; i < Size; ++i) 
+            { 
+                coefficients(row, i) -= factor * coefficients(column, i); 
+            }
+            solution[row] -= factor * solution[column];
+        }
+    }
+
+    // Solve the upper triangular system by back substitution.
+    for (size_t row{Size}; 0U < row--;)
+    {
+        double sum{solution[row]};
+        for (size_t i{row + 1U}; i < Size; ++i) { sum -= coefficients(row, i) * solution[i]; }
+        solution[row] = sum / coefficients(row, row);
+    }
+    x = solution;
+    return true;
+}
+} // namespace ml
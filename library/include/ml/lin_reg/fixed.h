@@ -3,9 +3,17 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 #include "ml/lin_reg/interface.h"
 #include "ml/types.h"
 
+namespace driver
+{
+/** EEPROM (Electrically Erasable Programmable ROM) stream interface. */
+namespace eeprom { class Interface; }
+} // namespace driver
+
 namespace ml
 {
 namespace lin_reg
@@ -13,15 +21,26 @@ namespace lin_reg
 /**
  * @brief Linear regression implementation.
  * 
+ *        Besides batch training, the model supports online recursive least-squares (RLS) 
+ *        updates, see update(). A forgetting factor below 1.0 gives older samples exponentially 
+ *        less weight, so the model can track slow drift of the modeled relation.
+ * 
  *        This class is non-copyable and non-movable.
  */
 class Fixed final : public Interface
 {
 public:
+    /** The number of bytes required to store the model in EEPROM. */
+    static constexpr uint16_t StorageSize{1U + 2U * sizeof(double) + sizeof(uint16_t)};
+
     /**
      * @brief Constructor.
+     * 
+     * @param[in] forgettingFactor Weight of earlier samples for each online update 
+     *                             (default = 1.0, i.e. no forgetting). Must be greater than 0.0
+     *                             and less than or equal to 1.0, else 1.0 is used.
      */
-    Fixed() noexcept;
+    explicit Fixed(double forgettingFactor = 1.0) noexcept;
 
     /**
      * @brief Destructor.
@@ -44,6 +63,24 @@ public:
      */
     double predict(double input) const noexcept override;
 
+    /**
+     * @brief Update the model with a new reference sample.
+     * 
+     *        The weight and bias are updated to the (exponentially weighted) least-squares 
+     *        solution of all samples seen so far in O(1) time and memory. The statistics of the
+     *        last closed-form training are included. If the model is trained but holds no 
+     *        statistics (after gradient descent training or loading), the statistics are seeded
+     *        with a prior of pseudo-samples on the current line centered at the new input, so
+     *        the current parameters are refined rather than replaced. An untrained model keeps
+     *        its weight until samples with different input values have been seen.
+     * 
+     * @param[in] input Input value of the reference sample.
+     * @param[in] output Expected output value of the reference sample.
+     * 
+     * @return True if the model is trained after the update, false otherwise.
+     */
+    bool update(double input, double output) noexcept override;
+
     /**
      * @brief Train the model.
      * 
@@ -58,6 +95,79 @@ public:
     bool train(const Matrix1d& trainIn, const Matrix2d& trainOut, size_t epochCount, 
                double learningRate = 0.01) noexcept;
 
+    /**
+     * @brief Train the model with the closed-form least-squares solution.
+     * 
+     *        The means and co-moments of the training data are accumulated in a single pass
+     *        with numerically stable (Welford) updates, then the weight and bias minimizing the
+     *        squared error are computed directly. No epochs or learning rate are required.
+     * 
+     *        If all input values are equal, the weight is set to 0 and the bias to the mean 
+     *        output value. The accumulated statistics are kept for subsequent online updates.
+     * 
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * 
+     * @return True on success, false on failure.
+     */
+    bool trainClosedForm(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept;
+
+    /**
+     * @brief Predict based on given inputs.
+     * 
+     *        The inputs are processed in SIMD registers on hosts supporting SSE2 or AVX2, 
+     *        one at a time otherwise (e.g. on AVR).
+     * 
+     * @param[in] input Pointer to the contiguous inputs for which to predict.
+     * @param[out] output Pointer to the contiguous outputs to store the predictions in.
+     * @param[in] count The number of inputs.
+     */
+    void predictBatch(const double* input, double* output, size_t count) const noexcept;
+
+    /**
+     * @brief Train the model with the closed-form least-squares solution.
+     * 
+     *        Contiguous training data is used in two passes, where the means are computed in 
+     *        the first pass and the deviation sums in the second pass. Both passes are processed
+     *        in SIMD registers on hosts supporting SSE2 or AVX2, one value at a time otherwise.
+     *        The accumulated statistics are kept for subsequent online updates.
+     * 
+     * @param[in] trainIn Pointer to the contiguous training data input values.
+     * @param[in] trainOut Pointer to the contiguous training data output values.
+     * @param[in] count The number of training sets.
+     * 
+     * @return True on success, false on failure.
+     */
+    bool trainBatch(const double* trainIn, const double* trainOut, size_t count) noexcept;
+
+    /**
+     * @brief Store the model parameters in EEPROM.
+     * 
+     *        The format version, the weight, the bias and a CRC-16 checksum are stored in 
+     *        StorageSize consecutive bytes. Bytes already holding the intended value aren't 
+     *        rewritten to reduce the EEPROM wear.
+     * 
+     * @param[in] eeprom The EEPROM stream to write to. Must be enabled.
+     * @param[in] address The start address of the region reserved for the model.
+     * 
+     * @return True on success, false if the model is untrained or the write failed.
+     */
+    bool save(driver::eeprom::Interface& eeprom, uint16_t address) const noexcept;
+
+    /**
+     * @brief Load the model parameters from EEPROM.
+     * 
+     *        The model is only updated if the stored format version and checksum are valid. 
+     *        The statistics of earlier training aren't stored, instead the first subsequent
+     *        online update seeds them from the loaded parameters, see update().
+     * 
+     * @param[in] eeprom The EEPROM stream to read from. Must be enabled.
+     * @param[in] address The start address of the region reserved for the model.
+     * 
+     * @return True on success, false if the stored model is missing or invalid.
+     */
+    bool load(const driver::eeprom::Interface& eeprom, uint16_t address) noexcept;
+
     Fixed(const Fixed&)            = delete; // No copy constructor.
     Fixed(Fixed&&)                 = delete; // No move constructor.
     Fixed& operator=(const Fixed&) = delete; // No copy assignment.
@@ -65,6 +175,9 @@ public:
 
 private:
     void optimize(double input, double output, double learningRate) noexcept;
+    void accumulate(double input, double output, double forgettingFactor) noexcept;
+    void clearStatistics() noexcept;
+    void seedStatistics(double input) noexcept;
 
     /** Model weight (k-value). */
     double myWeight;
@@ -72,6 +185,24 @@ private:
     /** Model bias (m-value.) */
     double myBias;
 
+    /** Weight of earlier samples for each online update. */
+    const double myForgettingFactor;
+
+    /** Sum of the (decayed) sample weights. */
+    double mySampleWeight;
+
+    /** Weighted mean of the input values. */
+    double myInputMean;
+
+    /** Weighted mean of the output values. */
+    double myOutputMean;
+
+    /** Weighted sum of squared input deviations. */
+    double mySquaredDeviationSum;
+
+    /** Weighted sum of input-output co-deviations. */
+    double myCoDeviationSum;
+
     /** Indicate whether the model is trained. */
     bool myTrained;
 };
@@ -0,0 +1,179 @@
+/**
+ * @brief Fixed-point linear regression implementation.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "ml/lin_reg/interface.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Linear regression implementation using fixed-point arithmetic.
+ *
+ *        The parameters are stored as signed 32-bit Q-format numbers with the given number of
+ *        fraction bits, i.e. Q15.16 by default. All arithmetic saturates instead of wrapping
+ *        around, so training and prediction only use integer operations, which is
+ *        considerably faster than floating-point operations on MCUs without an FPU.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam FractionBits The number of fraction bits (default = 16). Must be between 1 - 30.
+ */
+template <uint8_t FractionBits = 16U>
+class FixedPoint final : public Interface
+{
+    // Generate a compiler error if the number of fraction bits is invalid.
+    static_assert((0U < FractionBits) && (31U > FractionBits),
+        "The number of fraction bits must be between 1 - 30!");
+
+public:
+    /** The fixed-point value corresponding to 1.0. */
+    static constexpr int32_t One{static_cast<int32_t>(1L << FractionBits)};
+
+    /**
+     * @brief Constructor.
+     */
+    FixedPoint() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~FixedPoint() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     *
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     *
+     * @param[in] input Input for which to predict.
+     *
+     * @return The predicted value.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on given fixed-point input.
+     *
+     * @param[in] input Fixed-point input for which to predict.
+     *
+     * @return The predicted value in fixed-point format.
+     */
+    int32_t predictFixed(int32_t input) const noexcept;
+
+    /**
+     * @brief Update the model with a new reference sample.
+     * 
+     *        A single gradient descent step is performed with the learning rate of the last 
+     *        training (0.01 if untrained), which requires O(1) time and memory. Recursive 
+     *        least-squares isn't used, since its statistics would overflow in fixed-point format.
+     * 
+     * @param[in] input Input value of the reference sample.
+     * @param[in] output Expected output value of the reference sample.
+     * 
+     * @return True if the model is trained after the update, false otherwise.
+     */
+    bool update(double input, double output) noexcept override;
+
+    /**
+     * @brief Train the model.
+     *
+     *        The training data is converted to fixed-point format once before training.
+     *
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * @param[in] epochCount Number of epochs to perform training. Must be greater than 0.
+     * @param[in] learningRate Learning rate to use for updating the parameters (default = 0.01).
+     *                         Must be greater than 0.0 and less than or equal to 1.0.
+     *
+     * @return True on success, false on failure.
+     */
+    bool train(const Matrix1d& trainIn, const Matrix2d& trainOut, size_t epochCount,
+               double learningRate = 0.01) noexcept;
+
+    /**
+     * @brief Convert given number to fixed-point format.
+     *
+     *        The result is saturated if the number is out of range.
+     *
+     * @param[in] number The number to convert.
+     *
+     * @return The corresponding fixed-point number.
+     */
+    static constexpr int32_t toFixed(double number) noexcept;
+
+    /**
+     * @brief Convert given fixed-point number to floating-point format.
+     *
+     * @param[in] number The fixed-point number to convert.
+     *
+     * @return The corresponding floating-point number.
+     */
+    static constexpr double toDouble(int32_t number) noexcept;
+
+    /**
+     * @brief Add two fixed-point numbers with saturation.
+     *
+     * @param[in] x The first number.
+     * @param[in] y The second number.
+     *
+     * @return The saturated sum of the numbers.
+     */
+    static constexpr int32_t add(int32_t x, int32_t y) noexcept;
+
+    /**
+     * @brief Subtract two fixed-point numbers with saturation.
+     *
+     * @param[in] x The number to subtract from.
+     * @param[in] y The number to subtract.
+     *
+     * @return The saturated difference of the numbers.
+     */
+    static constexpr int32_t subtract(int32_t x, int32_t y) noexcept;
+
+    /**
+     * @brief Multiply two fixed-point numbers with saturation.
+     *
+     *        The product is rounded to the nearest representable value.
+     *
+     * @param[in] x The first number.
+     * @param[in] y The second number.
+     *
+     * @return The saturated product of the numbers.
+     */
+    static constexpr int32_t multiply(int32_t x, int32_t y) noexcept;
+
+    FixedPoint(const FixedPoint&)            = delete; // No copy constructor.
+    FixedPoint(FixedPoint&&)                 = delete; // No move constructor.
+    FixedPoint& operator=(const FixedPoint&) = delete; // No copy assignment.
+    FixedPoint& operator=(FixedPoint&&)      = delete; // No move assignment.
+
+private:
+    void optimize(int32_t input, int32_t output, int32_t learningRate) noexcept;
+    static constexpr int32_t saturate(int64_t number) noexcept;
+
+    /** Model weight (k-value) in fixed-point format. */
+    int32_t myWeight;
+
+    /** Model bias (m-value) in fixed-point format. */
+    int32_t myBias;
+
+    /** Learning rate used for online updates in fixed-point format. */
+    int32_t myLearningRate;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/fixed_point_impl.h"
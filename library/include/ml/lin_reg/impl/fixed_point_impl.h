@@ -0,0 +1,163 @@
+/**
+ * @brief Implementation details of class ml::lin_reg::FixedPoint.
+ *
+ * @note Don't include this header, use <fixed_point.h> instead!
+ */
+#pragma once
+
+#include "container/vector.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+FixedPoint<FractionBits>::FixedPoint() noexcept
+    : myWeight{}
+    , myBias{}
+    , myLearningRate{toFixed(0.01)}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+bool FixedPoint<FractionBits>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+double FixedPoint<FractionBits>::predict(const double input) const noexcept
+{
+    return toDouble(predictFixed(toFixed(input)));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+int32_t FixedPoint<FractionBits>::predictFixed(const int32_t input) const noexcept
+{
+    return add(multiply(myWeight, input), myBias);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+bool FixedPoint<FractionBits>::update(const double input, const double output) noexcept
+{
+    // Perform a single gradient descent step with the last learning rate.
+    optimize(toFixed(input), toFixed(output), myLearningRate);
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+bool FixedPoint<FractionBits>::train(const Matrix1d& trainIn, const Matrix2d& trainOut,
+                                     const size_t epochCount, const double learningRate) noexcept
+{
+    // Check the epoch count and learning rate, return false if invalid.
+    if ((0U == epochCount) || (0.0 >= learningRate) || (1.0 < learningRate)) { return false; }
+
+    // Check the training set count, return false if invalid.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    if (0U == setCount) { return false; }
+
+    // Convert the training data to fixed-point format once, return false on failure.
+    container::Vector<int32_t> fixedIn(setCount);
+    container::Vector<int32_t> fixedOut(setCount);
+    if ((setCount != fixedIn.size()) || (setCount != fixedOut.size())) { return false; }
+
+    for (size_t i{}; i < setCount; ++i)
+    {
+        fixedIn[i]  = toFixed(trainIn[i]);
+        fixedOut[i] = toFixed(trainOut[i]);
+    }
+
+    // Use a learning rate of at least one LSB to ensure that the parameters are updated.
+    const int32_t fixedLearningRate{toFixed(learningRate) > 0 ? toFixed(learningRate) : 1};
+    myLearningRate = fixedLearningRate;
+
+    // Clear the trainable parameters before starting training.
+    myWeight = 0;
+    myBias   = 0;
+
+    // Train the model the specified number of epochs.
+    for (size_t epoch{}; epoch < epochCount; ++epoch)
+    {
+        // Iterate through all training sets, skip randomization for simplicity.
+        for (size_t i{}; i < setCount; ++i)
+        {
+            optimize(fixedIn[i], fixedOut[i], fixedLearningRate);
+        }
+    }
+    // Return true to indicate success.
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+constexpr int32_t FixedPoint<FractionBits>::toFixed(const double number) noexcept
+{
+    // Scale the number, saturate if out of range, otherwise round to the nearest integer.
+    const double scaled{number * One};
+    if (2147483647.0 <= scaled) { return INT32_MAX; }
+    if (-2147483648.0 >= scaled) { return INT32_MIN; }
+    return static_cast<int32_t>(0.0 <= scaled ? scaled + 0.5 : scaled - 0.5);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+constexpr double FixedPoint<FractionBits>::toDouble(const int32_t number) noexcept
+{
+    return static_cast<double>(number) / One;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+constexpr int32_t FixedPoint<FractionBits>::add(const int32_t x, const int32_t y) noexcept
+{
+    return saturate(static_cast<int64_t>(x) + y);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+constexpr int32_t FixedPoint<FractionBits>::subtract(const int32_t x, const int32_t y) noexcept
+{
+    return saturate(static_cast<int64_t>(x) - y);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+constexpr int32_t FixedPoint<FractionBits>::multiply(const int32_t x, const int32_t y) noexcept
+{
+    // Add half an LSB before shifting to round the product to the nearest value.
+    constexpr int64_t half{1LL << (FractionBits - 1U)};
+    return saturate((static_cast<int64_t>(x) * y + half) >> FractionBits);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+void FixedPoint<FractionBits>::optimize(const int32_t input, const int32_t output,
+                                        const int32_t learningRate) noexcept
+{
+    // Check the input, directly set bias to output if 0 (special case).
+    // Otherwise, apply gradient descent to update both weight and bias.
+    if (0 == input) { myBias = output; }
+    else
+    {
+        const int32_t error{subtract(output, predictFixed(input))};
+        const int32_t step{multiply(error, learningRate)};
+        myBias   = add(myBias, step);
+        myWeight = add(myWeight, multiply(step, input));
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FractionBits>
+constexpr int32_t FixedPoint<FractionBits>::saturate(const int64_t number) noexcept
+{
+    if (INT32_MAX < number) { return INT32_MAX; }
+    if (INT32_MIN > number) { return INT32_MIN; }
+    return static_cast<int32_t>(number);
+}
+} // namespace lin_reg
+} // namespace ml
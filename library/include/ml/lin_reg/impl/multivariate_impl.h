@@ -0,0 +1,201 @@
+/**
+ * @brief Implementation details of class ml::lin_reg::Multivariate.
+ *
+ * @note Don't include this header, use <multivariate.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+Multivariate<FeatureCount>::Multivariate() noexcept
+    : myWeights{}
+    , myBias{}
+    , myGramMatrix{}
+    , myMomentVector{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+bool Multivariate<FeatureCount>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+double Multivariate<FeatureCount>::predict(const Features& input) const noexcept
+{
+    return dotProduct<FeatureCount>(myWeights.data(), input.data()) + myBias;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+const typename Multivariate<FeatureCount>::Features& 
+    Multivariate<FeatureCount>::weights() const noexcept
+{
+    return myWeights;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+double Multivariate<FeatureCount>::bias() const noexcept { return myBias; }
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+bool Multivariate<FeatureCount>::train(const container::Vector<Features>& trainIn, 
+                                       const Matrix2d& trainOut, const size_t epochCount, 
+                                       const double learningRate, 
+                                       const size_t batchSize) noexcept
+{
+    // Check the epoch count, learning rate and batch size, return false if invalid.
+    if ((0U == epochCount) || (0.0 >= learningRate) || (1.0 < learningRate) 
+        || (0U == batchSize)) { return false; }
+
+    // Check the training set count, return false if invalid.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    if (0U == setCount) { return false; }
+
+    // Clear the trainable parameters and the normal equations before starting training.
+    myWeights.clear();
+    myBias = 0.0;
+    myGramMatrix.clear();
+    myMomentVector.clear();
+
+    // Train the model the specified number of epochs.
+    for (size_t epoch{}; epoch < epochCount; ++epoch)
+    {
+        // Iterate through the training sets batch by batch, skip randomization for simplicity.
+        for (size_t batchStart{}; batchStart < setCount; batchStart += batchSize)
+        {
+            const size_t batchEnd{setCount - batchStart < batchSize ? 
+                setCount : batchStart + batchSize};
+
+            // Accumulate the gradient of the squared error over the batch.
+            Features weightStep{};
+            double biasStep{};
+
+            for (size_t i{batchStart}; i < batchEnd; ++i)
+            {
+                const double error{trainOut[i] - predict(trainIn[i])};
+                for (size_t j{}; j < FeatureCount; ++j) { weightStep[j] += error * trainIn[i][j]; }
+                biasStep += error;
+            }
+
+            // Update the parameters with the average gradient of the batch.
+            const double scale{learningRate / (batchEnd - batchStart)};
+            weightStep *= scale;
+            myWeights  += weightStep;
+            myBias     += biasStep * scale;
+        }
+    }
+    // Return true to indicate success.
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+bool Multivariate<FeatureCount>::trainClosedForm(const container::Vector<Features>& trainIn, 
+                                                 const Matrix2d& trainOut) noexcept
+{
+    // Check the training set count, return false if invalid.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    if (0U == setCount) { return false; }
+
+    // Accumulate the normal equations in a single pass, then solve them.
+    myGramMatrix.clear();
+    myMomentVector.clear();
+    for (size_t i{}; i < setCount; ++i) { accumulate(trainIn[i], trainOut[i]); }
+    return solveNormalEquations();
+}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+bool Multivariate<FeatureCount>::update(const Features& input, const double output) noexcept
+{
+    // Seed the normal equations from the current parameters if the model is trained without
+    // them, i.e. with gradient descent. The first diagonal element holds the sample count.
+    if (myTrained && (0.0 == myGramMatrix(0U, 0U))) { seedNormalEquations(input); }
+
+    // Add the sample to the normal equations, keep the current parameters if unsolvable.
+    accumulate(input, output);
+    solveNormalEquations();
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+void Multivariate<FeatureCount>::accumulate(const Features& input, const double output) noexcept
+{
+    // Augment the input with a constant 1 for the bias.
+    Matrix<ParameterCount> augmented{};
+    augmented[0U] = 1.0;
+    for (size_t i{}; i < FeatureCount; ++i) { augmented[i + 1U] = input[i]; }
+
+    // Add the outer product of the augmented input and the corresponding moment.
+    for (size_t row{}; row < ParameterCount; ++row)
+    {
+        for (size_t column{}; column < ParameterCount; ++column)
+        {
+            myGramMatrix(row, column) += augmented[row] * augmented[column];
+        }
+        myMomentVector[row] += augmented[row] * output;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+bool Multivariate<FeatureCount>::solveNormalEquations() noexcept
+{
+    // Solve the normal equations, return false if the parameters aren't determined uniquely.
+    Matrix<ParameterCount> parameters{};
+    if (!solve(myGramMatrix, myMomentVector, parameters)) { return false; }
+
+    // Store the parameters, the bias is the first element.
+    myBias = parameters[0U];
+    for (size_t i{}; i < FeatureCount; ++i) { myWeights[i] = parameters[i + 1U]; }
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t FeatureCount>
+void Multivariate<FeatureCount>::seedNormalEquations(const Features& input) noexcept
+{
+    // Use pseudo-samples on the current model, centered at the given input, as prior.
+    Matrix<ParameterCount> augmented{};
+    Matrix<ParameterCount> parameters{};
+    augmented[0U]  = 1.0;
+    parameters[0U] = myBias;
+
+    for (size_t i{}; i < FeatureCount; ++i) 
+    { 
+        augmented[i + 1U]  = input[i]; 
+        parameters[i + 1U] = myWeights[i];
+    }
+
+    // The pseudo-samples spread around the center with the prior variance for each feature.
+    for (size_t row{}; row < ParameterCount; ++row)
+    {
+        for (size_t column{}; column < ParameterCount; ++column)
+        {
+            myGramMatrix(row, column) = PriorSampleWeight * augmented[row] * augmented[column];
+        }
+        if (0U < row) { myGramMatrix(row, row) += PriorSampleWeight * PriorInputVariance; }
+    }
+
+    // The outputs of the pseudo-samples lie on the current model, hence the moment vector is
+    // the product of the Gram matrix and the current parameters.
+    for (size_t row{}; row < ParameterCount; ++row)
+    {
+        myMomentVector[row] = 0.0;
+        for (size_t column{}; column < ParameterCount; ++column)
+        {
+            myMomentVector[row] += myGramMatrix(row, column) * parameters[column];
+        }
+    }
+}
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,105 @@
+/**
+ * @brief Implementation details of class ml::lin_reg::Polynomial.
+ *
+ * @note Don't include this header, use <polynomial.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+Polynomial<Degree>::Polynomial() noexcept
+    : myModel{}
+{}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+bool Polynomial<Degree>::isTrained() const noexcept { return myModel.isTrained(); }
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+double Polynomial<Degree>::predict(const double input) const noexcept
+{
+    return myModel.predict(createFeatures(input));
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+bool Polynomial<Degree>::update(const double input, const double output) noexcept
+{
+    return myModel.update(createFeatures(input), output);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+bool Polynomial<Degree>::train(const Matrix1d& trainIn, const Matrix2d& trainOut, 
+                               const size_t epochCount, const double learningRate, 
+                               const size_t batchSize) noexcept
+{
+    // Create the features of each training set, return false on failure.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    container::Vector<Features> features{};
+    if (!createFeatures(trainIn, features, setCount)) { return false; }
+
+    // Train the multivariate model with the features.
+    return myModel.train(features, trainOut, epochCount, learningRate, batchSize);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+bool Polynomial<Degree>::trainClosedForm(const Matrix1d& trainIn, 
+                                         const Matrix2d& trainOut) noexcept
+{
+    // Create the features of each training set, return false on failure.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    container::Vector<Features> features{};
+    if (!createFeatures(trainIn, features, setCount)) { return false; }
+
+    // Train the multivariate model with the features.
+    return myModel.trainClosedForm(features, trainOut);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+const Matrix<Degree>& Polynomial<Degree>::coefficients() const noexcept 
+{ 
+    return myModel.weights(); 
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+double Polynomial<Degree>::constant() const noexcept { return myModel.bias(); }
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+typename Polynomial<Degree>::Features 
+    Polynomial<Degree>::createFeatures(const double input) noexcept
+{
+    // Compute x, x^2 ... x^Degree by repeated multiplication.
+    Features features{};
+    double power{input};
+
+    for (size_t i{}; i < Degree; ++i)
+    {
+        features[i] = power;
+        power *= input;
+    }
+    return features;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Degree>
+bool Polynomial<Degree>::createFeatures(const Matrix1d& input, 
+                                        container::Vector<Features>& features, 
+                                        const size_t setCount) noexcept
+{
+    // Return false if there are no training sets or the memory allocation fails.
+    if ((0U == setCount) || !features.resize(setCount)) { return false; }
+    for (size_t i{}; i < setCount; ++i) { features[i] = createFeatures(input[i]); }
+    return true;
+}
+} // namespace lin_reg
+} // namespace ml
@@ -33,6 +33,19 @@ public:
      * @return The predicted value.
      */
     virtual double predict(double input) const noexcept = 0;
+
+    /**
+     * @brief Update the model with a new reference sample.
+     * 
+     *        The update is performed in constant time and memory, i.e. the model can be 
+     *        recalibrated continuously without storing or retraining on the full training set.
+     * 
+     * @param[in] input Input value of the reference sample.
+     * @param[in] output Expected output value of the reference sample.
+     * 
+     * @return True if the model is trained after the update, false otherwise.
+     */
+    virtual bool update(double input, double output) noexcept = 0;
 };
 } // namespace lin_reg
 } // namespace ml
\ No newline at end of file
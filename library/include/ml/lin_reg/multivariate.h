@@ -0,0 +1,163 @@
+/**
+ * @brief Multivariate linear regression implementation.
+ */
+#pragma once
+
+#include "container/vector.h"
+#include "ml/matrix.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Multivariate linear regression implementation.
+ * 
+ *        The model predicts y = w0 * x0 + w1 * x1 + ... + b, where the input features can be
+ *        any measured or derived quantities, such as the supply voltage or powers of the input
+ *        (see class Polynomial). The model can be trained with the normal equations or with
+ *        mini-batch gradient descent, and updated online with new samples.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam FeatureCount The number of input features. Must be greater than 0.
+ */
+template <size_t FeatureCount>
+class Multivariate final
+{
+    // Generate a compiler error if the feature count is set to 0.
+    static_assert(0U < FeatureCount, "The feature count must be greater than 0!");
+
+public:
+    /** Input features of a single sample. */
+    using Features = Matrix<FeatureCount>;
+
+    /**
+     * @brief Constructor.
+     */
+    Multivariate() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Multivariate() noexcept = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept;
+
+    /**
+     * @brief Predict based on given input features.
+     * 
+     * @param[in] input Input features for which to predict.
+     * 
+     * @return The predicted value.
+     */
+    double predict(const Features& input) const noexcept;
+
+    /**
+     * @brief Get the model weights.
+     * 
+     * @return Reference to the weights, one for each input feature.
+     */
+    const Features& weights() const noexcept;
+
+    /**
+     * @brief Get the model bias.
+     * 
+     * @return The model bias.
+     */
+    double bias() const noexcept;
+
+    /**
+     * @brief Train the model with gradient descent.
+     * 
+     *        The gradient is averaged over each mini-batch before the parameters are updated.
+     * 
+     * @param[in] trainIn Training data input features.
+     * @param[in] trainOut Training data output values.
+     * @param[in] epochCount Number of epochs to perform training. Must be greater than 0.
+     * @param[in] learningRate Learning rate to use for updating the parameters (default = 0.01).
+     *                         Must be greater than 0.0 and less than or equal to 1.0.
+     * @param[in] batchSize Number of training sets per parameter update (default = 1).
+     *                      Must be greater than 0.
+     * 
+     * @return True on success, false on failure.
+     */
+    bool train(const container::Vector<Features>& trainIn, const Matrix2d& trainOut, 
+               size_t epochCount, double learningRate = 0.01, size_t batchSize = 1U) noexcept;
+
+    /**
+     * @brief Train the model with the normal equations (closed-form least-squares solution).
+     * 
+     *        The normal equations are accumulated in a single pass over the training data and
+     *        kept for subsequent online updates.
+     * 
+     * @param[in] trainIn Training data input features.
+     * @param[in] trainOut Training data output values.
+     * 
+     * @return True on success, false if the training sets are missing or don't determine the 
+     *         parameters uniquely (e.g. fewer sets than parameters).
+     */
+    bool trainClosedForm(const container::Vector<Features>& trainIn, 
+                         const Matrix2d& trainOut) noexcept;
+
+    /**
+     * @brief Update the model with a new reference sample.
+     * 
+     *        The sample is added to the normal equations, which are solved again. The time and 
+     *        memory required are independent of the number of samples seen so far. The current
+     *        parameters are kept until the parameters are determined uniquely. After training
+     *        with gradient descent, the normal equations are first seeded with pseudo-samples
+     *        on the trained model, so the update refines the trained parameters instead of
+     *        replacing them with a fit to the new samples only.
+     * 
+     * @param[in] input Input features of the reference sample.
+     * @param[in] output Expected output value of the reference sample.
+     * 
+     * @return True if the model is trained after the update, false otherwise.
+     */
+    bool update(const Features& input, double output) noexcept;
+
+    Multivariate(const Multivariate&)            = delete; // No copy constructor.
+    Multivariate(Multivariate&&)                 = delete; // No move constructor.
+    Multivariate& operator=(const Multivariate&) = delete; // No copy assignment.
+    Multivariate& operator=(Multivariate&&)      = delete; // No move assignment.
+
+private:
+    /** The number of parameters, i.e. the weights and the bias. */
+    static constexpr size_t ParameterCount{FeatureCount + 1U};
+
+    /** Sample weight of the prior, i.e. the number of pseudo-samples it corresponds to. */
+    static constexpr double PriorSampleWeight{8.0};
+
+    /** Variance of each input feature of the prior pseudo-samples. */
+    static constexpr double PriorInputVariance{1.0};
+
+    void accumulate(const Features& input, double output) noexcept;
+    bool solveNormalEquations() noexcept;
+    void seedNormalEquations(const Features& input) noexcept;
+
+    /** Model weights (one for each input feature). */
+    Features myWeights;
+
+    /** Model bias. */
+    double myBias;
+
+    /** Sum of the outer products of the augmented inputs [1, x0, x1, ...]. */
+    Matrix<ParameterCount, ParameterCount> myGramMatrix;
+
+    /** Sum of the augmented inputs multiplied with the corresponding outputs. */
+    Matrix<ParameterCount> myMomentVector;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/multivariate_impl.h"
@@ -0,0 +1,123 @@
+/**
+ * @brief Polynomial regression implementation.
+ */
+#pragma once
+
+#include "ml/lin_reg/interface.h"
+#include "ml/lin_reg/multivariate.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Polynomial regression implementation.
+ * 
+ *        The model predicts y = w1 * x + w2 * x^2 + ... + b by means of a multivariate model,
+ *        whose features are the powers of the input. This allows non-linear relations, such as
+ *        the curvature of a sensor characteristic, to be modeled.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam Degree The degree of the polynomial. Must be greater than 0.
+ */
+template <size_t Degree>
+class Polynomial final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    Polynomial() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Polynomial() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     * 
+     * @param[in] input Input for which to predict.
+     * 
+     * @return The predicted value.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Update the model with a new reference sample.
+     * 
+     * @param[in] input Input value of the reference sample.
+     * @param[in] output Expected output value of the reference sample.
+     * 
+     * @return True if the model is trained after the update, false otherwise.
+     */
+    bool update(double input, double output) noexcept override;
+
+    /**
+     * @brief Train the model with gradient descent.
+     * 
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * @param[in] epochCount Number of epochs to perform training. Must be greater than 0.
+     * @param[in] learningRate Learning rate to use for updating the parameters (default = 0.01).
+     *                         Must be greater than 0.0 and less than or equal to 1.0.
+     * @param[in] batchSize Number of training sets per parameter update (default = 1).
+     *                      Must be greater than 0.
+     * 
+     * @return True on success, false on failure.
+     */
+    bool train(const Matrix1d& trainIn, const Matrix2d& trainOut, size_t epochCount, 
+               double learningRate = 0.01, size_t batchSize = 1U) noexcept;
+
+    /**
+     * @brief Train the model with the normal equations (closed-form least-squares solution).
+     * 
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * 
+     * @return True on success, false on failure.
+     */
+    bool trainClosedForm(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept;
+
+    /**
+     * @brief Get the coefficients of the polynomial.
+     * 
+     * @return Reference to the coefficients of x, x^2 ... x^Degree.
+     */
+    const Matrix<Degree>& coefficients() const noexcept;
+
+    /**
+     * @brief Get the constant term of the polynomial.
+     * 
+     * @return The constant term.
+     */
+    double constant() const noexcept;
+
+    Polynomial(const Polynomial&)            = delete; // No copy constructor.
+    Polynomial(Polynomial&&)                 = delete; // No move constructor.
+    Polynomial& operator=(const Polynomial&) = delete; // No copy assignment.
+    Polynomial& operator=(Polynomial&&)      = delete; // No move assignment.
+
+private:
+    using Features = typename Multivariate<Degree>::Features;
+
+    static Features createFeatures(double input) noexcept;
+    static bool createFeatures(const Matrix1d& input, container::Vector<Features>& features, 
+                               size_t setCount) noexcept;
+
+    /** Multivariate model using the powers of the input as features. */
+    Multivariate<Degree> myModel;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/polynomial_impl.h"
@@ -0,0 +1,202 @@
+/**
+ * @brief Implementation of small matrices with compile-time dimensions.
+ */
+#pragma once
+
+#include <stddef.h>
+
+namespace ml
+{
+/**
+ * @brief Class for implementation of small matrices.
+ * 
+ *        The elements are stored contiguously in row-major order, i.e. element (r, c) is 
+ *        located at index r * ColumnCount + c. Since the dimensions are known at compile time,
+ *        no dynamic memory is used and all loops can be fully unrolled by the compiler.
+ * 
+ * @tparam RowCount    The number of rows. Must be greater than 0.
+ * @tparam ColumnCount The number of columns (default = 1, i.e. a column vector). 
+ *                     Must be greater than 0.
+ */
+template <size_t RowCount, size_t ColumnCount = 1U>
+class Matrix
+{
+    // Generate a compiler error if any dimension is set to 0.
+    static_assert((0U < RowCount) && (0U < ColumnCount), "Matrix dimensions must be greater than 0!");
+
+public:
+    /**
+     * @brief Create matrix with all elements set to 0.
+     */
+    Matrix() noexcept;
+
+    /**
+     * @brief Create matrix containing given values.
+     * 
+     * @param[in] values Reference to the values to store, given in row-major order.
+     */
+    explicit Matrix(const double (&values)[RowCount * ColumnCount]) noexcept;
+
+    /**
+     * @brief Delete matrix.
+     */
+    ~Matrix() noexcept = default;
+
+    Matrix(const Matrix&)            = default; // Copy constructor.
+    Matrix& operator=(const Matrix&) = default; // Copy assignment.
+
+    /**
+     * @brief Get the number of rows.
+     * 
+     * @return The number of rows.
+     */
+    static constexpr size_t rows() noexcept;
+
+    /**
+     * @brief Get the number of columns.
+     * 
+     * @return The number of columns.
+     */
+    static constexpr size_t columns() noexcept;
+
+    /**
+     * @brief Get the number of elements.
+     * 
+     * @return The number of elements.
+     */
+    static constexpr size_t size() noexcept;
+
+    /**
+     * @brief Get element at given position.
+     * 
+     * @param[in] row Row of the requested element.
+     * @param[in] column Column of the requested element.
+     * 
+     * @return Reference to the element at given position.
+     */
+    double& operator()(size_t row, size_t column) noexcept;
+
+    /**
+     * @brief Get element at given position.
+     * 
+     * @param[in] row Row of the requested element.
+     * @param[in] column Column of the requested element.
+     * 
+     * @return Reference to the element at given position.
+     */
+    const double& operator()(size_t row, size_t column) const noexcept;
+
+    /**
+     * @brief Get element at given index in the underlying row-major storage.
+     * 
+     * @param[in] index Index of the requested element.
+     * 
+     * @return Reference to the element at given index.
+     */
+    double& operator[](size_t index) noexcept;
+
+    /**
+     * @brief Get element at given index in the underlying row-major storage.
+     * 
+     * @param[in] index Index of the requested element.
+     * 
+     * @return Reference to the element at given index.
+     */
+    const double& operator[](size_t index) const noexcept;
+
+    /**
+     * @brief Get data held by the matrix.
+     * 
+     * @return Pointer to the data held by the matrix.
+     */
+    double* data() noexcept;
+
+    /**
+     * @brief Get data held by the matrix.
+     * 
+     * @return Pointer to the data held by the matrix.
+     */
+    const double* data() const noexcept;
+
+    /**
+     * @brief Get the transpose of the matrix.
+     * 
+     * @return The transposed matrix.
+     */
+    Matrix<ColumnCount, RowCount> transpose() const noexcept;
+
+    /**
+     * @brief Multiply the matrix with another matrix.
+     * 
+     * @tparam OtherColumnCount The number of columns of the other matrix.
+     * 
+     * @param[in] other The matrix to multiply with.
+     * 
+     * @return The matrix product.
+     */
+    template <size_t OtherColumnCount>
+    Matrix<RowCount, OtherColumnCount> 
+        operator*(const Matrix<ColumnCount, OtherColumnCount>& other) const noexcept;
+
+    /**
+     * @brief Add the elements of another matrix.
+     * 
+     * @param[in] other The matrix to add.
+     * 
+     * @return Reference to this matrix.
+     */
+    Matrix& operator+=(const Matrix& other) noexcept;
+
+    /**
+     * @brief Multiply all elements with given factor.
+     * 
+     * @param[in] factor The factor to multiply with.
+     * 
+     * @return Reference to this matrix.
+     */
+    Matrix& operator*=(double factor) noexcept;
+
+    /**
+     * @brief Set all elements to 0.
+     */
+    void clear() noexcept;
+
+private:
+    /** Statically-sized data field in row-major order. */
+    double myData[RowCount * ColumnCount];
+};
+
+/**
+ * @brief Calculate the inner product of two contiguous vectors.
+ * 
+ *        The loop is unrolled by four with independent accumulators, which shortens the 
+ *        dependency chain of the additions.
+ * 
+ * @tparam Size The number of elements in each vector.
+ * 
+ * @param[in] x Pointer to the first vector.
+ * @param[in] y Pointer to the second vector.
+ * 
+ * @return The inner product of the vectors.
+ */
+template <size_t Size>
+constexpr double dotProduct(const double* x, const double* y) noexcept;
+
+/**
+ * @brief Solve the linear equation system a * x = b.
+ * 
+ *        Gaussian elimination with partial pivoting is used.
+ * 
+ * @tparam Size The number of equations.
+ * 
+ * @param[in] a The coefficient matrix.
+ * @param[in] b The right-hand side.
+ * @param[out] x The solution. Left unchanged if the system is singular.
+ * 
+ * @return True if the system was solved, false if the coefficient matrix is singular.
+ */
+template <size_t Size>
+bool solve(const Matrix<Size, Size>& a, const Matrix<Size>& b, Matrix<Size>& x) noexcept;
+} // namespace ml
+
+#include "impl/matrix_impl.h"
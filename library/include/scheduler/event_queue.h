@@ -0,0 +1,105 @@
+/**
+ * @brief Event queue for cooperative run-to-completion scheduling.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace scheduler
+{
+/** Sleep-mode power manager. */
+class PowerManager;
+
+/**
+ * @brief Event queue for cooperative run-to-completion scheduling.
+ * 
+ *        Events are posted from interrupt or main context and handled one at a time in main
+ *        context. Each event is represented by a pending bit, so posting and popping events take 
+ *        constant time and no memory is allocated. The event number doubles as priority, i.e.
+ *        event 0 is always popped first. An event posted again before being handled is only 
+ *        handled once.
+ * 
+ *        When no events are pending, the CPU can be put to sleep until the next interrupt 
+ *        occurs via waitForEvent().
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class EventQueue final
+{
+public:
+    /** The max number of events. */
+    static constexpr uint8_t MaxEventCount{16U};
+
+    /**
+     * @brief Constructor.
+     */
+    EventQueue() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~EventQueue() noexcept = default;
+
+    /**
+     * @brief Check whether the queue is empty.
+     * 
+     * @return True if no events are pending, false otherwise.
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * @brief Check whether given event is pending.
+     * 
+     * @param[in] event The event to check.
+     * 
+     * @return True if the event is pending, false otherwise.
+     */
+    bool isPending(uint8_t event) const noexcept;
+
+    /**
+     * @brief Post event to the queue.
+     * 
+     *        This method can be called from both main and interrupt context.
+     * 
+     * @param[in] event The event to post. Must be less than MaxEventCount.
+     * 
+     * @return True if the event was posted, false if the event is invalid.
+     */
+    bool post(uint8_t event) noexcept;
+
+    /**
+     * @brief Pop the pending event with the highest priority, i.e. the lowest number.
+     * 
+     * @param[out] event Reference to variable to store the popped event.
+     * 
+     * @return True if an event was popped, false if the queue is empty.
+     */
+    bool pop(uint8_t& event) noexcept;
+
+    /**
+     * @brief Clear all pending events.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Put the CPU to sleep until the next interrupt if the queue is empty.
+     * 
+     *        Return immediately if any event is pending. Events posted by an interrupt just 
+     *        before entering sleep mode aren't missed, since the check and the sleep instruction
+     *        are performed atomically. Interrupts are always enabled afterwards.
+     * 
+     * @param[in] powerManager Pointer to power manager selecting the deepest safe sleep mode,
+     *                         or nullptr to use idle sleep mode (default = nullptr).
+     */
+    void waitForEvent(PowerManager* powerManager = nullptr) noexcept;
+
+    EventQueue(const EventQueue&)            = delete; // No copy constructor.
+    EventQueue(EventQueue&&)                 = delete; // No move constructor.
+    EventQueue& operator=(const EventQueue&) = delete; // No copy assignment.
+    EventQueue& operator=(EventQueue&&)      = delete; // No move assignment.
+
+private:
+    /** Pending events, one bit per event. */
+    volatile uint16_t myPending;
+};
+} // namespace scheduler
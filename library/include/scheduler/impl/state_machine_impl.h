@@ -0,0 +1,61 @@
+/**
+ * @brief Implementation details of scheduler::StateMachine class.
+ *
+ * @note Don't include this header, use <state_machine.h> instead!
+ */
+#pragma once
+
+namespace scheduler
+{
+// -----------------------------------------------------------------------------
+template <typename Context, typename State, typename Event>
+StateMachine<Context, State, Event>::StateMachine(const Table& table, Context& context,
+                                                  const State initialState) noexcept
+    : myTable{table}
+    , myContext{context}
+    , myState{StateCount > static_cast<uint8_t>(initialState) ? initialState : State{}}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename Context, typename State, typename Event>
+State StateMachine<Context, State, Event>::state() const noexcept { return myState; }
+
+// -----------------------------------------------------------------------------
+template <typename Context, typename State, typename Event>
+void StateMachine<Context, State, Event>::setState(const State state) noexcept
+{
+    if (StateCount > static_cast<uint8_t>(state)) { myState = state; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context, typename State, typename Event>
+bool StateMachine<Context, State, Event>::dispatch(const Event event) noexcept
+{
+    // Ignore invalid events.
+    const uint8_t eventIndex{static_cast<uint8_t>(event)};
+    if (EventCount <= eventIndex) { return false; }
+
+    // Look up the transition, return false if the event is ignored in the current state.
+    const Transition& transition{myTable[static_cast<uint8_t>(myState)][eventIndex]};
+    if ((myState == transition.next) && (nullptr == transition.action)) { return false; }
+
+    // Update the state before performing the action, so the action can dispatch new events.
+    myState = transition.next;
+    if (nullptr != transition.action) { transition.action(myContext); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context, typename State, typename Event>
+constexpr bool StateMachine<Context, State, Event>::isValid(const Table& table) noexcept
+{
+    for (uint8_t i{}; i < StateCount; ++i)
+    {
+        for (uint8_t j{}; j < EventCount; ++j)
+        {
+            if (StateCount <= static_cast<uint8_t>(table[i][j].next)) { return false; }
+        }
+    }
+    return true;
+}
+} // namespace scheduler
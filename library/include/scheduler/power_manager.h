@@ -0,0 +1,149 @@
+/**
+ * @brief Sleep-mode power management for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace timer
+{
+/** System time service, used to measure the time spent in each power state. */
+class SystemTime;
+} // namespace timer
+} // namespace driver
+
+namespace scheduler
+{
+/**
+ * @brief Enumeration of power states, from the most to the least power consuming.
+ */
+enum class PowerState : uint8_t
+{
+    Active,            // CPU running.
+    Idle,              // CPU halted, peripherals running.
+    AdcNoiseReduction, // I/O clock halted, ADC and asynchronous Timer 2 running.
+    PowerSave,         // All clocks halted except the clock of asynchronous Timer 2.
+    PowerDown,         // All clocks halted, wake-up on external interrupts or the watchdog only.
+    Count,             // Number of power states.
+};
+
+/**
+ * @brief Sleep-mode power manager for ATmega328P.
+ *
+ *        The deepest safe sleep mode is selected from the state of the peripherals each time the
+ *        CPU is put to sleep, i.e. a peripheral that is enabled and needs a clock that would be
+ *        halted in a deeper sleep mode limits the sleep depth:
+ *            - The USART requires idle mode while receiving is enabled or a transmission is
+ *              in progress.
+ *            - The SPI, synchronously clocked timers and edge-triggered external interrupts
+ *              require idle mode.
+ *            - An ongoing ADC conversion requires ADC noise reduction mode.
+ *            - Timer 2 clocked asynchronously requires power-save mode.
+ *
+ *        Peripherals that are disabled are powered down via the power reduction register
+ *        while sleeping and powered up again directly after wake-up, so drivers can enable
+ *        them in main context as usual. The interrupt waking the CPU up is handled before the
+ *        power is restored, hence interrupt handlers must not enable powered down peripherals,
+ *        since their registers can't be written until the power is restored.
+ *
+ *        The number of transitions to each power state is counted. If a system time service is
+ *        used, the time spent in each state is measured as well. The system time service keeps
+ *        a timer running, hence the CPU never sleeps deeper than idle mode in this case.
+ *        Standby modes aren't used, since they require an external crystal oscillator.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class PowerManager final
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] systemTime Pointer to system time service used to measure the time spent in
+     *                       each power state, or nullptr to only count the state transitions
+     *                       (default = nullptr).
+     */
+    explicit PowerManager(const driver::timer::SystemTime* systemTime = nullptr) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~PowerManager() noexcept = default;
+
+    /**
+     * @brief Get the deepest sleep mode that is safe given the current state of the peripherals.
+     *
+     * @return The deepest safe sleep mode.
+     */
+    PowerState deepestSleepMode() const noexcept;
+
+    /**
+     * @brief Get the power reduction bits of the peripherals that are currently disabled.
+     *
+     * @return Bits to set in the power reduction register to power down unused peripherals.
+     */
+    uint8_t unusedPeripherals() const noexcept;
+
+    /**
+     * @brief Put the CPU to sleep in the deepest safe sleep mode until the next interrupt.
+     *
+     *        Unused peripherals are powered down while sleeping. This method must be called
+     *        with interrupts disabled, which makes it possible to check for pending work before
+     *        sleeping without the risk of missing an interrupt. Interrupts are enabled when
+     *        entering sleep mode and remain enabled afterwards.
+     */
+    void sleep() noexcept;
+
+    /**
+     * @brief Get the number of transitions to given power state.
+     *
+     * @param[in] state The power state.
+     *
+     * @return The number of transitions to the power state.
+     */
+    uint32_t entryCount(PowerState state) const noexcept;
+
+    /**
+     * @brief Get the time spent in given power state.
+     *
+     *        The time spent in the active state is updated each time the CPU enters sleep mode.
+     *
+     * @param[in] state The power state.
+     *
+     * @return The time spent in the power state in microseconds, or 0 if no system time
+     *         service is used.
+     */
+    uint64_t timeInState_us(PowerState state) const noexcept;
+
+    /**
+     * @brief Reset the power state statistics.
+     */
+    void resetStatistics() noexcept;
+
+    PowerManager(const PowerManager&)            = delete; // No copy constructor.
+    PowerManager(PowerManager&&)                 = delete; // No move constructor.
+    PowerManager& operator=(const PowerManager&) = delete; // No copy assignment.
+    PowerManager& operator=(PowerManager&&)      = delete; // No move assignment.
+
+private:
+    /** The number of power states. */
+    static constexpr uint8_t StateCount{static_cast<uint8_t>(PowerState::Count)};
+
+    uint64_t now() const noexcept;
+    void addTime(PowerState state, uint64_t start_us, uint64_t end_us) noexcept;
+
+    /** System time service used to measure time (nullptr if unused). */
+    const driver::timer::SystemTime* mySystemTime;
+
+    /** The number of transitions to each power state. */
+    uint32_t myEntryCount[StateCount];
+
+    /** The time spent in each power state in microseconds. */
+    uint64_t myTime_us[StateCount];
+
+    /** The time of the last wake-up in microseconds. */
+    uint64_t myWakeUpTime_us;
+};
+} // namespace scheduler
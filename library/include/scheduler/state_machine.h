@@ -0,0 +1,129 @@
+/**
+ * @brief Table-driven finite state machine.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace scheduler
+{
+/**
+ * @brief Table-driven finite state machine.
+ *
+ *        The behavior is specified by a transition table holding one transition for each
+ *        combination of state and event, which can be verified at compile time. Since the
+ *        table is read directly rather than from program memory, it's still copied to and held
+ *        in SRAM on AVR, so keep the number of states and events small. Dispatching an
+ *        event is a single table lookup followed by at most one action call, so the cost of
+ *        handling an event doesn't depend on the number of states or events.
+ *
+ *        An entry that keeps the current state and has no action means that the event is
+ *        ignored in that state. The state is updated before the action is invoked, so an action
+ *        can dispatch further events to the state machine.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam Context The type of the context passed to the actions.
+ * @tparam State   Enumeration of states. Must end with enumerator Count.
+ * @tparam Event   Enumeration of events. Must end with enumerator Count.
+ */
+template <typename Context, typename State, typename Event>
+class StateMachine final
+{
+public:
+    /** The number of states. */
+    static constexpr uint8_t StateCount{static_cast<uint8_t>(State::Count)};
+
+    /** The number of events. */
+    static constexpr uint8_t EventCount{static_cast<uint8_t>(Event::Count)};
+
+    // Generate a compiler error if the number of states or events is 0.
+    static_assert((0U < StateCount) && (0U < EventCount),
+        "A state machine must have at least one state and one event!");
+
+    /** Action to perform on a transition. */
+    using Action = void (*)(Context& context) noexcept;
+
+    /**
+     * @brief Structure of a state transition.
+     */
+    struct Transition
+    {
+        /** The next state. */
+        State next;
+
+        /** The action to perform on the transition (nullptr if none). */
+        Action action;
+    };
+
+    /** Transition table, indexed by the current state and the event. */
+    using Table = Transition[StateCount][EventCount];
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] table Transition table. Use isValid() to verify the table at compile time.
+     * @param[in] context Reference to the context passed to the actions.
+     * @param[in] initialState The initial state.
+     */
+    StateMachine(const Table& table, Context& context, State initialState) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~StateMachine() noexcept = default;
+
+    /**
+     * @brief Get the current state.
+     *
+     * @return The current state.
+     */
+    State state() const noexcept;
+
+    /**
+     * @brief Set the current state without performing any action.
+     *
+     *        This is intended for initialization, for instance when a state is restored.
+     *
+     * @param[in] state The new state. Invalid states are ignored.
+     */
+    void setState(State state) noexcept;
+
+    /**
+     * @brief Dispatch event to the state machine.
+     *
+     * @param[in] event The event to dispatch.
+     *
+     * @return True if the event was handled, false if the event is invalid or ignored in the
+     *         current state.
+     */
+    bool dispatch(Event event) noexcept;
+
+    /**
+     * @brief Check whether given transition table is valid, i.e. only contains valid states.
+     *
+     * @param[in] table The transition table to check.
+     *
+     * @return True if the transition table is valid, false otherwise.
+     */
+    static constexpr bool isValid(const Table& table) noexcept;
+
+    StateMachine()                               = delete; // No default constructor.
+    StateMachine(const StateMachine&)            = delete; // No copy constructor.
+    StateMachine(StateMachine&&)                 = delete; // No move constructor.
+    StateMachine& operator=(const StateMachine&) = delete; // No copy assignment.
+    StateMachine& operator=(StateMachine&&)      = delete; // No move assignment.
+
+private:
+    /** Reference to the transition table. */
+    const Table& myTable;
+
+    /** Reference to the context passed to the actions. */
+    Context& myContext;
+
+    /** The current state. */
+    State myState;
+};
+} // namespace scheduler
+
+#include "impl/state_machine_impl.h"
@@ -0,0 +1,199 @@
+/**
+ * @brief Watchdog supervisor monitoring the liveness of individual tasks.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace eeprom
+{
+/** EEPROM stream interface, used to store the failure record. */
+class Interface;
+} // namespace eeprom
+
+namespace timer
+{
+/** System time service, used to measure the time since each check-in. */
+class SystemTime;
+} // namespace timer
+
+namespace watchdog
+{
+/** Watchdog timer interface. */
+class Interface;
+} // namespace watchdog
+} // namespace driver
+
+namespace scheduler
+{
+/**
+ * @brief Watchdog supervisor monitoring the liveness of individual tasks.
+ *
+ *        Each task, such as the main loop or a periodic interrupt handler, is registered with
+ *        its own deadline and must check in before the deadline has passed. The hardware
+ *        watchdog is only reset by service() while all tasks are healthy, so a stuck handler
+ *        or a hung interrupt source leads to a system reset even if the main loop still runs.
+ *
+ *        The watchdog is operated in interrupt-then-reset mode. On the first watchdog timeout,
+ *        a failure record holding the ID of the first overdue task and the uptime is written to
+ *        EEPROM, before the system is reset on the next timeout. The record can be read after
+ *        the restart via readRecord(). If all tasks recover and the watchdog is serviced before
+ *        the system is reset, the record is cleared again, so only failures leading to a reset
+ *        are reported.
+ *
+ *        Only one supervisor can be used at a time, since the watchdog timeout callback is
+ *        dispatched to a single instance.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Supervisor final
+{
+public:
+    /** The max number of tasks. */
+    static constexpr uint8_t MaxTaskCount{8U};
+
+    /** Task ID stored when no task was overdue on watchdog timeout. */
+    static constexpr uint8_t NoTask{0xFEU};
+
+    /** The size of the failure record in EEPROM in bytes (task ID and uptime). */
+    static constexpr uint8_t RecordSize{5U};
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] watchdog Reference to the watchdog timer to supervise.
+     * @param[in] systemTime Reference to the system time service.
+     * @param[in] eeprom Pointer to EEPROM stream to store the failure record in, or nullptr
+     *                   to not store any failure record (default = nullptr).
+     * @param[in] recordAddr The EEPROM address of the failure record (default = 0).
+     */
+    explicit Supervisor(driver::watchdog::Interface& watchdog,
+                        const driver::timer::SystemTime& systemTime,
+                        driver::eeprom::Interface* eeprom = nullptr,
+                        uint16_t recordAddr = 0U) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Supervisor() noexcept;
+
+    /**
+     * @brief Check if the supervisor is initialized.
+     *
+     *        An uninitialized supervisor indicates that another supervisor is already in use.
+     *
+     * @return True if the supervisor is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept;
+
+    /**
+     * @brief Register task to supervise.
+     *
+     *        The task is considered to have checked in on registration.
+     *
+     * @param[in] deadline_ms The max time between two check-ins of the task in milliseconds.
+     *
+     * @return The ID of the task, or -1 if no more tasks can be registered or the supervisor
+     *         is uninitialized.
+     */
+    int8_t addTask(uint32_t deadline_ms) noexcept;
+
+    /**
+     * @brief Get the number of registered tasks.
+     *
+     * @return The number of registered tasks.
+     */
+    uint8_t taskCount() const noexcept;
+
+    /**
+     * @brief Check in given task, i.e. indicate that it's alive.
+     *
+     *        This method can be called from interrupt context.
+     *
+     * @param[in] task The ID of the task.
+     */
+    void checkIn(uint8_t task) noexcept;
+
+    /**
+     * @brief Get the first task that has missed its deadline.
+     *
+     * @return The ID of the first overdue task, or -1 if all tasks are healthy.
+     */
+    int8_t overdueTask() const noexcept;
+
+    /**
+     * @brief Reset the watchdog timer if all tasks are healthy.
+     *
+     *        The failure record written on a preceding watchdog timeout is cleared, since the
+     *        system recovered before being reset.
+     *
+     * @return True if the watchdog timer was reset, false if any task is overdue.
+     */
+    bool service() noexcept;
+
+    /**
+     * @brief Handle watchdog timeout by writing the failure record to EEPROM.
+     *
+     *        This method is invoked by the watchdog timer before the system is reset.
+     */
+    void handleWatchdogTimeout() noexcept;
+
+    /**
+     * @brief Read the failure record stored on the last watchdog timeout.
+     *
+     * @param[out] task Reference to variable to store the ID of the overdue task (NoTask if
+     *                  the watchdog timed out without any overdue task).
+     * @param[out] uptime_ms Reference to variable to store the uptime at the timeout.
+     *
+     * @return True if a failure record was read, false if none is stored.
+     */
+    bool readRecord(uint8_t& task, uint32_t& uptime_ms) const noexcept;
+
+    /**
+     * @brief Clear the failure record.
+     */
+    void clearRecord() noexcept;
+
+    Supervisor()                             = delete; // No default constructor.
+    Supervisor(const Supervisor&)            = delete; // No copy constructor.
+    Supervisor(Supervisor&&)                 = delete; // No move constructor.
+    Supervisor& operator=(const Supervisor&) = delete; // No copy assignment.
+    Supervisor& operator=(Supervisor&&)      = delete; // No move assignment.
+
+private:
+    /**
+     * @brief Structure of a supervised task.
+     */
+    struct Task
+    {
+        /** The max time between two check-ins in milliseconds. */
+        uint32_t deadline_ms;
+
+        /** The uptime of the last check-in in milliseconds. */
+        uint32_t lastCheckIn_ms;
+    };
+
+    /** The supervised tasks. */
+    Task myTasks[MaxTaskCount];
+
+    /** Reference to the supervised watchdog timer. */
+    driver::watchdog::Interface& myWatchdog;
+
+    /** Reference to the system time service. */
+    const driver::timer::SystemTime& mySystemTime;
+
+    /** Pointer to EEPROM stream storing the failure record (nullptr if unused). */
+    driver::eeprom::Interface* myEeprom;
+
+    /** The EEPROM address of the failure record. */
+    const uint16_t myRecordAddr;
+
+    /** The number of registered tasks. */
+    uint8_t myTaskCount;
+
+    /** Indicate if a failure record was written since the watchdog was last reset. */
+    volatile bool myRecordPending;
+};
+} // namespace scheduler
@@ -0,0 +1,256 @@
+/**
+ * @brief Command line tokenizer and command parser.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "arch/avr/hw_platform.h"
+
+namespace utils
+{
+/**
+ * @brief Tokens of a command line.
+ *
+ *        The command line is split into whitespace-separated tokens in place, i.e. the
+ *        whitespace following each token is replaced by a null character and the tokens point
+ *        into the original line. Hence no memory is allocated, but the line must outlive
+ *        the tokens.
+ */
+class Tokens final
+{
+public:
+    /** The max number of tokens. */
+    static constexpr uint8_t MaxCount{8U};
+
+    /**
+     * @brief Constructor, create empty token list.
+     */
+    Tokens() noexcept;
+
+    /**
+     * @brief Constructor, split given command line into tokens.
+     *
+     * @param[in] line The null-terminated command line to split. The line is modified.
+     */
+    explicit Tokens(char* line) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Tokens() noexcept = default;
+
+    /**
+     * @brief Get the number of tokens.
+     *
+     * @return The number of tokens.
+     */
+    uint8_t count() const noexcept;
+
+    /**
+     * @brief Check whether the line contained more tokens than could be stored.
+     *
+     * @return True if tokens were dropped, false otherwise.
+     */
+    bool isTruncated() const noexcept;
+
+    /**
+     * @brief Get token at given index.
+     *
+     * @param[in] index Index of the token.
+     *
+     * @return Pointer to the null-terminated token, or nullptr if the index is out of range.
+     */
+    const char* operator[](uint8_t index) const noexcept;
+
+    /**
+     * @brief Get the tokens starting at given index.
+     *
+     * @param[in] first Index of the first token to include.
+     *
+     * @return The tokens starting at given index.
+     */
+    Tokens tail(uint8_t first) const noexcept;
+
+    /**
+     * @brief Convert token at given index to an unsigned integer.
+     *
+     * @param[in] index Index of the token.
+     * @param[out] value Reference to variable to store the value.
+     *
+     * @return True if the token is a decimal number that fits in 32 bits, false otherwise.
+     */
+    bool toUint32(uint8_t index, uint32_t& value) const noexcept;
+
+    Tokens(const Tokens&)            = default; // Copy constructor.
+    Tokens(Tokens&&)                 = default; // Move constructor.
+    Tokens& operator=(const Tokens&) = default; // Copy assignment.
+    Tokens& operator=(Tokens&&)      = default; // Move assignment.
+
+private:
+    /** Pointers to the tokens. */
+    const char* myTokens[MaxCount];
+
+    /** The number of tokens. */
+    uint8_t myCount;
+
+    /** Indicate whether tokens were dropped. */
+    bool myTruncated;
+};
+
+/**
+ * @brief Enumeration of command parser results.
+ */
+enum class CommandResult : uint8_t
+{
+    Success,          // Command executed successfully.
+    Empty,            // The command line was empty.
+    UnknownCommand,   // No command matched the command line.
+    InvalidArguments, // Wrong number of arguments.
+    Failed,           // The command handler failed.
+};
+
+/**
+ * @brief Command parser dispatching command lines to handlers via a sorted command table.
+ *
+ *        Command names consist of one or more words separated by single spaces, such as
+ *        "dump eeprom" or "set toggle", and may be followed by a fixed number of arguments.
+ *        The table must be sorted by name and no name may be the leading words of another name,
+ *        which can be verified at compile time via isValid(). Commands are looked up via
+ *        binary search, so the lookup cost only grows logarithmically with the number of
+ *        commands, and nothing is allocated.
+ *
+ *        The command table, including the names and descriptions, must be placed in program
+ *        memory via PROGMEM to save SRAM, which is scarce on AVR. Hence the strings are held
+ *        in fixed-size arrays within the commands, and commands are copied to RAM on access.
+ *
+ * @tparam Context The type of the context passed to the handlers.
+ */
+template <typename Context>
+class CommandParser final
+{
+public:
+    /** Command handler, receiving the arguments following the command name. */
+    using Handler = bool (*)(Context& context, const Tokens& args) noexcept;
+
+    /** The max length of command names, including the null character. */
+    static constexpr uint8_t NameSize{16U};
+
+    /** The max length of argument descriptions, including the null character. */
+    static constexpr uint8_t ArgsSize{8U};
+
+    /** The max length of command descriptions, including the null character. */
+    static constexpr uint8_t DescriptionSize{40U};
+
+    /**
+     * @brief Structure of a command.
+     */
+    struct Command
+    {
+        /** The command name. */
+        char name[NameSize];
+
+        /** Description of the arguments (empty if none). */
+        char args[ArgsSize];
+
+        /** Description of the command. */
+        char description[DescriptionSize];
+
+        /** The number of arguments. */
+        uint8_t argCount;
+
+        /** The command handler. */
+        Handler handler;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @tparam CommandCount The number of commands.
+     *
+     * @param[in] commands Command table sorted by name, placed in program memory.
+     * @param[in] context Reference to the context passed to the handlers.
+     */
+    template <uint8_t CommandCount>
+    CommandParser(const Command (&commands)[CommandCount], Context& context) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~CommandParser() noexcept = default;
+
+    /**
+     * @brief Get the number of commands.
+     *
+     * @return The number of commands.
+     */
+    uint8_t commandCount() const noexcept;
+
+    /**
+     * @brief Copy command at given index from program memory.
+     *
+     * @param[in] index Index of the command.
+     * @param[out] command Reference to variable to store the command.
+     *
+     * @return True if the command was copied, false if the index is out of range.
+     */
+    bool command(uint8_t index, Command& command) const noexcept;
+
+    /**
+     * @brief Find the command matching given tokens and copy it from program memory.
+     *
+     * @param[in] tokens The tokens of the command line.
+     * @param[out] wordCount Reference to variable to store the number of words of the name.
+     * @param[out] command Reference to variable to store the matching command.
+     *
+     * @return True if a matching command was found, false otherwise.
+     */
+    bool find(const Tokens& tokens, uint8_t& wordCount, Command& command) const noexcept;
+
+    /**
+     * @brief Parse and execute given command line.
+     *
+     * @param[in] line The null-terminated command line. The line is modified.
+     *
+     * @return The result of the execution.
+     */
+    CommandResult execute(char* line) const noexcept;
+
+    /**
+     * @brief Check whether given command table is valid.
+     *
+     *        A valid table is sorted by name without duplicates, no name is empty and no name
+     *        consists of the leading words of another name.
+     *
+     * @tparam CommandCount The number of commands.
+     *
+     * @param[in] commands The command table to check.
+     *
+     * @return True if the command table is valid, false otherwise.
+     */
+    template <uint8_t CommandCount>
+    static constexpr bool isValid(const Command (&commands)[CommandCount]) noexcept;
+
+    CommandParser()                                = delete; // No default constructor.
+    CommandParser(const CommandParser&)            = delete; // No copy constructor.
+    CommandParser(CommandParser&&)                 = delete; // No move constructor.
+    CommandParser& operator=(const CommandParser&) = delete; // No copy assignment.
+    CommandParser& operator=(CommandParser&&)      = delete; // No move assignment.
+
+private:
+    static int8_t compare(const char* name, const Tokens& tokens, uint8_t& wordCount) noexcept;
+    static constexpr int8_t compareNames(const char* x, const char* y) noexcept;
+    static constexpr bool isLeadingWords(const char* words, const char* name) noexcept;
+
+    /** Pointer to the command table in program memory. */
+    const Command* myCommands;
+
+    /** The number of commands. */
+    uint8_t myCommandCount;
+
+    /** Reference to the context passed to the handlers. */
+    Context& myContext;
+};
+} // namespace utils
+
+#include "impl/command_parser_impl.h"
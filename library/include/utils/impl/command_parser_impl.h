@@ -0,0 +1,166 @@
+/**
+ * @brief Implementation details of utils::CommandParser class.
+ *
+ * @note Don't include this header, use <command_parser.h> instead!
+ */
+#pragma once
+
+namespace utils
+{
+// -----------------------------------------------------------------------------
+template <typename Context>
+template <uint8_t CommandCount>
+CommandParser<Context>::CommandParser(const Command (&commands)[CommandCount],
+                                      Context& context) noexcept
+    : myCommands{commands}
+    , myCommandCount{CommandCount}
+    , myContext{context}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+uint8_t CommandParser<Context>::commandCount() const noexcept { return myCommandCount; }
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+bool CommandParser<Context>::command(const uint8_t index, Command& command) const noexcept
+{
+    if (index >= myCommandCount) { return false; }
+    memcpy_P(&command, &myCommands[index], sizeof(Command));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+bool CommandParser<Context>::find(const Tokens& tokens, uint8_t& wordCount,
+                                  Command& command) const noexcept
+{
+    // Perform binary search in the sorted command table, only copy the names to compare.
+    uint8_t first{};
+    uint8_t last{myCommandCount};
+
+    while (first < last)
+    {
+        const uint8_t middle{static_cast<uint8_t>(first + (last - first) / 2U)};
+        char name[NameSize]{};
+        memcpy_P(name, myCommands[middle].name, NameSize);
+        const int8_t result{compare(name, tokens, wordCount)};
+
+        if (0 == result) { return this->command(middle, command); }
+        else if (0 > result) { first = middle + 1U; }
+        else { last = middle; }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+CommandResult CommandParser<Context>::execute(char* line) const noexcept
+{
+    // Split the line into tokens, ignore empty lines.
+    const Tokens tokens{line};
+    if (0U == tokens.count()) { return CommandResult::Empty; }
+
+    // Find the command, check the number of arguments.
+    uint8_t wordCount{};
+    Command command{};
+    if (!find(tokens, wordCount, command)) { return CommandResult::UnknownCommand; }
+
+    if (tokens.isTruncated() || (command.argCount != tokens.count() - wordCount))
+    {
+        return CommandResult::InvalidArguments;
+    }
+
+    // Invoke the command handler with the arguments.
+    return command.handler(myContext, tokens.tail(wordCount)) ?
+        CommandResult::Success : CommandResult::Failed;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+template <uint8_t CommandCount>
+constexpr bool CommandParser<Context>::isValid(const Command (&commands)[CommandCount]) noexcept
+{
+    for (uint8_t i{}; i < CommandCount; ++i)
+    {
+        // Check that the name and the handler are present.
+        if (('\0' == commands[i].name[0U]) || (nullptr == commands[i].handler))
+        {
+            return false;
+        }
+
+        // Check that the names are sorted. Since the space precedes all printable characters,
+        // names consisting of the leading words of another name are always adjacent.
+        if (0U < i)
+        {
+            const char* previous{commands[i - 1U].name};
+            if ((0 <= compareNames(previous, commands[i].name))
+                || isLeadingWords(previous, commands[i].name))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+int8_t CommandParser<Context>::compare(const char* name, const Tokens& tokens,
+                                       uint8_t& wordCount) noexcept
+{
+    // Compare the name with the tokens word by word.
+    for (uint8_t i{}; i < tokens.count(); ++i)
+    {
+        const char* token{tokens[i]};
+
+        while (('\0' != *name) && (' ' != *name) && (*name == *token))
+        {
+            ++name;
+            ++token;
+        }
+
+        // Treat the end of a word as the lowest character.
+        const char nameChar{' ' == *name ? '\0' : *name};
+        if (nameChar != *token)
+        {
+            return static_cast<uint8_t>(nameChar) < static_cast<uint8_t>(*token) ? -1 : 1;
+        }
+
+        // Return 0 if all words of the name match, otherwise skip the space.
+        if ('\0' == *name)
+        {
+            wordCount = i + 1U;
+            return 0;
+        }
+        ++name;
+    }
+    // The name is longer than the command line.
+    return 1;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+constexpr int8_t CommandParser<Context>::compareNames(const char* x, const char* y) noexcept
+{
+    while (('\0' != *x) && (*x == *y))
+    {
+        ++x;
+        ++y;
+    }
+    return *x == *y ? 0 : (static_cast<uint8_t>(*x) < static_cast<uint8_t>(*y) ? -1 : 1);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+constexpr bool CommandParser<Context>::isLeadingWords(const char* words,
+                                                      const char* name) noexcept
+{
+    while (('\0' != *words) && (*words == *name))
+    {
+        ++words;
+        ++name;
+    }
+    return ('\0' == *words) && (' ' == *name);
+}
+} // namespace utils
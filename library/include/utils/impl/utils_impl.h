@@ -5,6 +5,8 @@
  */
 #pragma once
 
+#include "memory/allocator/interface.h"
+
 namespace utils
 {
 // -----------------------------------------------------------------------------
@@ -111,6 +113,15 @@ constexpr T1 round(const T2 number) noexcept
     return static_cast<T1>(0.0 <= number ? number + 0.5 : number - 0.5);
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T absolute(const T number) noexcept
+{
+    static_assert(type_traits::is_arithmetic<T>::value, 
+        "Absolute values are only supported for arithmetic types!");
+    return 0 <= number ? number : -number;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 constexpr bool inRange(const T number, const T min, const T max) noexcept
@@ -131,23 +142,50 @@ inline T* newObject(Args&&... args) noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T>
-inline T* newMemory(const size_t size) noexcept
+inline T* newMemory(const size_t size, memory::allocator::Interface* allocator) noexcept
 {
-    return static_cast<T*>(malloc(sizeof(T) * size));
+    if (nullptr != allocator) { return static_cast<T*>(allocator->allocate(sizeof(T) * size)); }
+    auto block{static_cast<T*>(malloc(sizeof(T) * size))};
+    const MemoryHooks* hooks{memoryHooks()};
+    if ((nullptr != block) && (nullptr != hooks)) { hooks->onAllocate(block); }
+    return block;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-inline T* reallocMemory(T* block, const size_t newSize) noexcept
+inline T* reallocMemory(T* block, const size_t newSize, 
+                        memory::allocator::Interface* allocator) noexcept
 {
-    return static_cast<T*>(realloc(block, sizeof(T) * newSize));
+    if (nullptr != allocator) 
+    { 
+        return static_cast<T*>(allocator->reallocate(block, sizeof(T) * newSize)); 
+    }
+    const MemoryHooks* hooks{memoryHooks()};
+    if ((nullptr != block) && (nullptr != hooks)) { hooks->onDeallocate(block); }
+    auto newBlock{static_cast<T*>(realloc(block, sizeof(T) * newSize))};
+
+    // The original block is kept if the reallocation fails, unless it was freed (new size 0).
+    // Only count a new block if no block was passed, else the existing block was resized.
+    const T* allocated{nullptr != newBlock ? newBlock : (0U < newSize ? block : nullptr)};
+    if ((nullptr != allocated) && (nullptr != hooks)) 
+    { 
+        if (nullptr == block) { hooks->onAllocate(allocated); }
+        else { hooks->onReallocate(allocated); }
+    }
+    return newBlock;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-inline void deleteMemory(T* &block) noexcept
+inline void deleteMemory(T* &block, memory::allocator::Interface* allocator) noexcept
 {
-    free(block);
+    if (nullptr != allocator) { allocator->deallocate(block); }
+    else
+    {
+        const MemoryHooks* hooks{memoryHooks()};
+        if ((nullptr != block) && (nullptr != hooks)) { hooks->onDeallocate(block); }
+        free(block);
+    }
     block = nullptr;
 }
 
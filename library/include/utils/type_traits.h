@@ -242,4 +242,26 @@ struct is_reference<T&>
 {
     static const bool value{true};
 };
+
+namespace detail
+{
+/** Overloads selecting whether a pointer converts to a base class pointer. */
+template <typename Base>
+constexpr bool convertsToBase(const volatile Base*) noexcept { return true; }
+template <typename Base>
+constexpr bool convertsToBase(const volatile void*) noexcept { return false; }
+} // namespace detail
+
+/**
+ * @brief Check if given type is derived from (or the same as) given base class.
+ * 
+ * @tparam Base The base class.
+ * @tparam Derived The type to check.
+ */
+template <typename Base, typename Derived>
+struct is_base_of
+{
+    // True for types publicly derived from the base class only.
+    static const bool value{detail::convertsToBase<Base>(static_cast<Derived*>(nullptr))};
+};
 } // namespace type_traits
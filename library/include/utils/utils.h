@@ -10,6 +10,15 @@
 
 #include "utils/type_traits.h"
 
+namespace memory
+{
+namespace allocator
+{
+/** Memory allocator interface. */
+class Interface;
+} // namespace allocator
+} // namespace memory
+
 namespace utils 
 {
 /**
@@ -190,6 +199,18 @@ constexpr bool read(const volatile T& reg, uint8_t bit, Bits&&... bits) noexcept
 template <typename T1 = double, typename T2 = double, typename T3 = double> 
 T3 power(T1 base, T2 exponent) noexcept;
 
+/**
+ * @brief Calculate the CRC-16 checksum of given data.
+ * 
+ *        The CRC-16/CCITT-FALSE variant is used (polynomial 0x1021, initial value 0xFFFF).
+ * 
+ * @param[in] data Pointer to the data to calculate the checksum of.
+ * @param[in] size The size of the data in bytes.
+ * 
+ * @return The calculated checksum.
+ */
+uint16_t crc16(const uint8_t* data, size_t size) noexcept;
+
 /**
  * @brief Round given number to nearest integer.
  *
@@ -203,6 +224,18 @@ T3 power(T1 base, T2 exponent) noexcept;
 template <typename T1 = int32_t, typename T2 = double>
 constexpr T1 round(T2 value) noexcept;
 
+/**
+ * @brief Get the absolute value of given number.
+ * 
+ * @tparam T The numeric type. Must be of arithmetic type.
+ * 
+ * @param[in] number The number whose absolute value to get.
+ * 
+ * @return The absolute value of the number.
+ */
+template <typename T>
+constexpr T absolute(T number) noexcept;
+
 /**
  * @brief Check if the given number is within the given range [min, max].
  * 
@@ -217,6 +250,41 @@ constexpr T1 round(T2 value) noexcept;
 template <typename T>
 constexpr bool inRange(T number, T min, T max) noexcept;
 
+/**
+ * @brief Structure of hooks invoked on heap allocation, e.g. to gather heap statistics.
+ */
+struct MemoryHooks
+{
+    /** Hook invoked after a new heap block is allocated via newMemory() or reallocMemory(). */
+    void (*onAllocate)(const void* block);
+
+    /** Hook invoked before a heap block is deallocated via deleteMemory() or reallocMemory(). */
+    void (*onDeallocate)(const void* block);
+
+    /** 
+     * Hook invoked after an existing heap block is resized via reallocMemory(). The original
+     * block is passed to onDeallocate() before resizing.
+     */
+    void (*onReallocate)(const void* block);
+};
+
+/**
+ * @brief Set hooks invoked on heap allocation.
+ * 
+ *        The hooks aren't invoked for blocks allocated via a custom allocator.
+ * 
+ * @param[in] hooks Pointer to the hooks to use, or nullptr to remove the hooks. All hooks
+ *                  must be set, else the hooks are removed.
+ */
+void setMemoryHooks(const MemoryHooks* hooks) noexcept;
+
+/**
+ * @brief Get the hooks invoked on heap allocation.
+ * 
+ * @return Pointer to the hooks in use, or nullptr if none are set.
+ */
+const MemoryHooks* memoryHooks() noexcept;
+
 /**
  * @brief Allocate a new object on the heap.
  *
@@ -233,18 +301,20 @@ template <typename T, typename... Args>
 inline T* newObject(Args&&... args) noexcept;
 
 /**
- * @brief Allocate a new field on the heap.
+ * @brief Allocate a new field on the heap or via given allocator.
  *
  * @tparam T The field type.
  * 
  * @param[in] size The size of field in number of elements it can hold (default = 1).
+ * @param[in] allocator Pointer to the allocator to use, or nullptr to allocate the field on
+ *                      the heap (default = nullptr).
  *
  * @return A pointer to the new object.
  * 
  *         If the memory allocation fails, a nullptr is returned. 
  */
 template <typename T>
-inline T* newMemory(size_t size = 1U) noexcept;
+inline T* newMemory(size_t size = 1U, memory::allocator::Interface* allocator = nullptr) noexcept;
 
 /**
  * @brief Resize referenced heap allocated block via reallocation.
@@ -254,11 +324,14 @@ inline T* newMemory(size_t size = 1U) noexcept;
  * @param[in] block The block to resize.
  * @param[in] newSize The new size of allocated block, i.e. the number of elements it can hold 
  *                    after reallocation.
+ * @param[in] allocator Pointer to the allocator the block was allocated with, or nullptr if
+ *                      the block was allocated on the heap (default = nullptr).
  *
  * @return A pointer to the resized block at success, else a nullptr.
  */
 template <typename T>
-inline T* reallocMemory(T* block, size_t newSize) noexcept;
+inline T* reallocMemory(T* block, size_t newSize, 
+                        memory::allocator::Interface* allocator = nullptr) noexcept;
 
 /**
  * @brief Delete heap allocated block via deallocation. 
@@ -268,9 +341,11 @@ inline T* reallocMemory(T* block, size_t newSize) noexcept;
  * @tparam T The block type.
  *
  * @param[in] block Reference to the block to delete.
+ * @param[in] allocator Pointer to the allocator the block was allocated with, or nullptr if
+ *                      the block was allocated on the heap (default = nullptr).
  */
 template <typename T>
-inline void deleteMemory(T* &block) noexcept;
+inline void deleteMemory(T* &block, memory::allocator::Interface* allocator = nullptr) noexcept;
 
 /**
  * @brief Move memory from given source to a copy. 
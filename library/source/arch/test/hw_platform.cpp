@@ -31,6 +31,8 @@ void executeAssemblyCmd(const std::string& cmd) noexcept
     else if ("CLI" == cmd) { CLR(SREG, I_FLAG); }
     // No-op: watchdog counter reset not needed in unit tests.
     else if ("WDR" == cmd) {}
+    // No-op: sleep returns immediately in unit tests, as if woken up by an interrupt.
+    else if ("SLEEP" == cmd) {}
 }
 
 // -----------------------------------------------------------------------------
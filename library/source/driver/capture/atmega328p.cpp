@@ -0,0 +1,207 @@
+/**
+ * @brief Input capture driver implementation details for ATmega328P.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/capture/atmega328p.h"
+#include "driver/timer/atmega328p.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace capture
+{
+namespace
+{
+/**
+ * @brief Structure of input capture parameters.
+ */
+struct CaptureParam
+{
+    /** Index of the timer circuit used for input capture (Timer 1). */
+    static constexpr uint8_t Circuit{1U};
+
+    /** Input capture pin ICP1 (PB0). */
+    static constexpr uint8_t Pin{0U};
+
+    /** Captured values below this value may have been captured after a pending overflow. */
+    static constexpr uint16_t OverflowThreshold{0x8000U};
+};
+
+/** Index of the last rising edge. */
+constexpr uint8_t RisingIndex{1U};
+
+/** Index of the last falling edge. */
+constexpr uint8_t FallingIndex{0U};
+
+/** Pointer to the input capture unit driven by the capture interrupt. */
+Atmega328p* myInstance{nullptr};
+
+// -----------------------------------------------------------------------------
+constexpr bool isEdgeValid(const Atmega328p::Edge edge) noexcept
+{
+    return (Atmega328p::Edge::Rising == edge) || (Atmega328p::Edge::Falling == edge) 
+        || (Atmega328p::Edge::Both == edge);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Atmega328p::Atmega328p(const Edge edge, const bool enable) noexcept
+    : myEvents{}
+    , myLastEdge{}
+    , myLastEdgeValid{}
+    , myOverflowCount{}
+    , myLostEventCount{}
+    , myEdge{edge}
+    , myEnabled{false}
+{
+    // Reserve Timer 1, which also ensures that only one input capture unit is used.
+    if (!isEdgeValid(edge) || !timer::Atmega328p::reserveCircuit(CaptureParam::Circuit)) 
+    { 
+        return; 
+    }
+    myInstance = this;
+
+    // Set the capture pin to input without pull-up.
+    utils::clear(DDRB, CaptureParam::Pin);
+    utils::clear(PORTB, CaptureParam::Pin);
+
+    // Run the timer in normal mode without prescaler, enable the noise canceler.
+    // Capture rising edges first unless only falling edges are to be captured.
+    TCCR1A = 0U;
+    TCCR1B = (1U << ICNC1) | (1U << CS10);
+    if (Edge::Falling != myEdge) { utils::set(TCCR1B, ICES1); }
+    setEnabled(enable);
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::~Atmega328p() noexcept
+{
+    // Skip cleanup if the input capture unit is uninitialized.
+    if (!isInitialized()) { return; }
+    setEnabled(false);
+    TCCR1B = 0U;
+    myInstance = nullptr;
+    timer::Atmega328p::releaseCircuit(CaptureParam::Circuit);
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isInitialized() const noexcept { return this == myInstance; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isEnabled() const noexcept { return myEnabled; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::setEnabled(const bool enable) noexcept
+{
+    if (!isInitialized()) { return; }
+
+    if (enable)
+    {
+        // Clear stale interrupt flags (by writing ones) before enabling the interrupts.
+        TIFR1 = (1U << ICF1) | (1U << TOV1);
+        utils::globalInterruptEnable();
+        TIMSK1 = (1U << ICIE1) | (1U << TOIE1);
+    }
+    else { TIMSK1 = 0U; }
+    myEnabled = enable;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Atmega328p::eventCount() const noexcept { return myEvents.size(); }
+
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::lostEventCount() const noexcept { return myLostEventCount; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::readEvent(Event& event) noexcept { return myEvents.pop(event); }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::measure(Measurement& measurement) noexcept
+{
+    uint64_t periodSum{};
+    uint64_t highTimeSum{};
+    uint16_t periodCount{};
+    uint16_t highTimeCount{};
+    Event event{};
+
+    // Consume the captured events, measure the time between edges of the same polarity.
+    while (myEvents.pop(event))
+    {
+        const uint8_t index{event.rising ? RisingIndex : FallingIndex};
+
+        if (myLastEdgeValid[index])
+        {
+            periodSum += event.timestamp - myLastEdge[index];
+            periodCount++;
+        }
+
+        // Measure the high time from the last rising edge to each falling edge.
+        if (!event.rising && myLastEdgeValid[RisingIndex])
+        {
+            highTimeSum += event.timestamp - myLastEdge[RisingIndex];
+            highTimeCount++;
+        }
+        myLastEdge[index]      = event.timestamp;
+        myLastEdgeValid[index] = true;
+    }
+
+    // Return false if no complete period has been captured.
+    if (0U == periodCount) { return false; }
+
+    // Calculate the averages, convert timer counts to microseconds.
+    measurement.period_us    = CountInterval_us * periodSum / periodCount;
+    measurement.highTime_us  = 0U < highTimeCount ? 
+        CountInterval_us * highTimeSum / highTimeCount : 0.0;
+    measurement.frequency_Hz = 0.0 < measurement.period_us ? 
+        1000000.0 / measurement.period_us : 0.0;
+    measurement.dutyCycle    = 0.0 < measurement.period_us ? 
+        measurement.highTime_us / measurement.period_us : 0.0;
+    measurement.periodCount  = periodCount;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::handleCapture() noexcept
+{
+    // Read the captured value and the edge it was captured on.
+    const uint16_t capture{ICR1};
+    const bool rising{utils::read(TCCR1B, ICES1)};
+    uint16_t overflowCount{myOverflowCount};
+
+    // A pending overflow along with a low captured value indicates that the counter wrapped 
+    // before the capture, i.e. the overflow count is one too low.
+    if (utils::read(TIFR1, TOV1) && (CaptureParam::OverflowThreshold > capture)) 
+    { 
+        overflowCount++; 
+    }
+
+    // Capture the opposite edge next if both edges are to be captured. Changing the edge may 
+    // set the capture flag, so clear it (by writing a one) afterwards.
+    if (Edge::Both == myEdge)
+    {
+        if (rising) { utils::clear(TCCR1B, ICES1); }
+        else { utils::set(TCCR1B, ICES1); }
+        TIFR1 = (1U << ICF1);
+    }
+
+    // Store the event, count it as lost if the buffer is full.
+    const Event event{(static_cast<uint32_t>(overflowCount) << 16U) | capture, rising};
+    if (!myEvents.push(event)) { myLostEventCount = myLostEventCount + 1U; }
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::handleOverflow() noexcept { myOverflowCount = myOverflowCount + 1U; }
+
+// -----------------------------------------------------------------------------
+ISR (TIMER1_CAPT_vect) 
+{ 
+    if (nullptr != myInstance) { myInstance->handleCapture(); }
+}
+
+// -----------------------------------------------------------------------------
+ISR (TIMER1_OVF_vect) 
+{ 
+    if (nullptr != myInstance) { myInstance->handleOverflow(); }
+}
+} // namespace capture
+} // namespace driver
@@ -22,6 +22,22 @@ struct EepromParam
     /** Highest EEPROM address. */
     static constexpr uint16_t MaxAddress{Size - 1U};
 };
+
+// -----------------------------------------------------------------------------
+uint8_t disableInterruptsWhenReady() noexcept
+{
+    const uint8_t status{SREG};
+
+    // Wait until the EEPROM is ready with interrupts in their current state, then check again 
+    // with interrupts disabled, since an interrupt handler may start a write in between.
+    while (true)
+    {
+        while (utils::read(EECR, EEPE));
+        utils::globalInterruptDisable();
+        if (!utils::read(EECR, EEPE)) { return status; }
+        SREG = status;
+    }
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -60,34 +76,34 @@ bool Atmega328p::isAddressValid(const uint16_t address, const uint8_t dataSize)
 // -----------------------------------------------------------------------------
 void Atmega328p::writeByte(const uint16_t address, const uint8_t data) noexcept
 {
-    // Wait until EEPROM is ready to send the next byte.
-    while (utils::read(EECR, EEPE));
+    // Wait until EEPROM is ready to send the next byte, then disable interrupts, so that an
+    // interrupt handler writing to EEPROM can't change the address or data in between.
+    const uint8_t status{disableInterruptsWhenReady()};
 
-    // Set the address and data to write.
+    // Set the address and data to write, then perform the write.
     EEAR = address;
     EEDR = data;
-
-    // Perform write, disable interrupts during the write sequence.
-    utils::globalInterruptDisable();
     utils::set(EECR, EEMPE);
     utils::set(EECR, EEPE);
 
-    // Re-enable interrupts once the write sequence is complete.
-    utils::globalInterruptEnable();
+    // Restore the interrupt state once the write sequence is complete, this method may be 
+    // called from interrupt context.
+    SREG = status;
 }
 
 // -----------------------------------------------------------------------------
 uint8_t Atmega328p::readByte(const uint16_t address) const noexcept
 {
-    // Wait until EEPROM is ready to read the next byte.
-    while (utils::read(EECR, EEPE));
+    // Wait until EEPROM is ready to read the next byte, then disable interrupts, so that an
+    // interrupt handler writing to EEPROM can't change the address in between.
+    const uint8_t status{disableInterruptsWhenReady()};
 
-    // Set the address from which to read.
+    // Set the address from which to read, then read the value of the given address.
     EEAR = address;
-
-    // Read and return the value of the given address.
     utils::set(EECR, EERE);
-    return EEDR;
+    const uint8_t data{EEDR};
+    SREG = status;
+    return data;
 }
 } // namespace eeprom
 } // namespace driver
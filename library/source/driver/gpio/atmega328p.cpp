@@ -3,7 +3,6 @@
  */
 #include "arch/avr/hw_platform.h"
 #include "driver/gpio/atmega328p.h"
-#include "utils/callback_array.h"
 #include "utils/utils.h"
 
 namespace driver 
@@ -13,18 +12,15 @@ namespace gpio
 namespace
 {
 /**
- * @brief Structure of indexes for callbacks associated with the I/O ports.
+ * @brief Structure of callbacks associated with a pin.
  */
-struct CbIndex
+struct PinCallback
 {
-    /** Index for callback associated with I/O port B. */
-    static constexpr uint8_t PortB{0U};
+    /** Callback invoked on any edge. */
+    void (*onChange)();
 
-    /** Index for callback associated with I/O port C. */
-    static constexpr uint8_t PortC{1U};
-
-    /** Index for callback associated with I/O port D. */
-    static constexpr uint8_t PortD{2U};
+    /** Callback invoked with the edge. */
+    Atmega328p::EdgeCallback onEdge;
 };
 
 /**
@@ -43,14 +39,11 @@ struct PinOffset
     static constexpr uint8_t PortD{0U};
 };
 
-/** The number of available I/O ports. */
-constexpr uint8_t IoPortCount{3U};
-
 /** The number of available GPIO pins. */
 constexpr uint8_t PinCount{20U};
 
-/** Pointers to callbacks. */
-container::CallbackArray<IoPortCount> myCallbacks{};
+/** Callbacks associated with each pin. */
+PinCallback myCallbacks[PinCount]{};
 
 /** Pin registry (1 = reserved, 0 = free). */
 uint32_t myPinRegistry{};
@@ -58,6 +51,7 @@ uint32_t myPinRegistry{};
 constexpr bool isPinFree(const uint8_t id) noexcept;
 constexpr bool isDirectionValid(const Direction direction) noexcept;
 Hardware* findHw(const Atmega328p::IoPort ioPort) noexcept;
+void handlePinChange(Hardware& hw) noexcept;
 
 } // namespace
 
@@ -80,40 +74,61 @@ struct Hardware
 
     /** Control bit in the pin change interrupt control register (PCIEx). */
     const uint8_t pcix;
+
+    /** Pin offset, i.e. the ID of the GPIO connected to pin 0. */
+    const uint8_t pinOffset;
+
+    /** Input latched on the previous pin change interrupt. */
+    uint8_t pinState;
 };
 
 /** Hardware structure for I/O port B. */
 struct Hardware myHwPortB
 {
-    .ddrx   = DDRB,
-    .portx  = PORTB,
-    .pinx   = PINB,
-    .pcmskx = PCMSK0,
-    .pcix   = PCIE0,
+    .ddrx      = DDRB,
+    .portx     = PORTB,
+    .pinx      = PINB,
+    .pcmskx    = PCMSK0,
+    .pcix      = PCIE0,
+    .pinOffset = PinOffset::PortB,
+    .pinState  = 0U,
 };
 
 /** Hardware structure for I/O port C. */
 struct Hardware myHwPortC
 {
-    .ddrx   = DDRC,
-    .portx  = PORTC,
-    .pinx   = PINC,
-    .pcmskx = PCMSK1,
-    .pcix   = PCIE1,
+    .ddrx      = DDRC,
+    .portx     = PORTC,
+    .pinx      = PINC,
+    .pcmskx    = PCMSK1,
+    .pcix      = PCIE1,
+    .pinOffset = PinOffset::PortC,
+    .pinState  = 0U,
 };
 
 /** Hardware structure for I/O port D. */
 struct Hardware myHwPortD
 {
-    .ddrx   = DDRD,
-    .portx  = PORTD,
-    .pinx   = PIND,
-    .pcmskx = PCMSK2,
-    .pcix   = PCIE2,
+    .ddrx      = DDRD,
+    .portx     = PORTD,
+    .pinx      = PIND,
+    .pcmskx    = PCMSK2,
+    .pcix      = PCIE2,
+    .pinOffset = PinOffset::PortD,
+    .pinState  = 0U,
 };
 
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p(const uint8_t pin, const Direction direction, void (*callback)()) noexcept
+    : Atmega328p{pin, direction, static_cast<EdgeCallback>(nullptr)}
+{ 
+    // Register the given callback for the pin if the GPIO was initialized.
+    if (isInitialized()) { myCallbacks[myId].onChange = callback; }
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::Atmega328p(const uint8_t pin, const Direction direction, 
+                       const EdgeCallback callback) noexcept
     : myHw{nullptr}
     , myDirection{direction}
     , myIoPort{getIoPort(pin)}
@@ -124,13 +139,8 @@ Atmega328p::Atmega328p(const uint8_t pin, const Direction direction, void (*call
     // Put the GPIO in safe sstate on failure.
     if (isPinFree(myId) && isDirectionValid(myDirection))
     {
-        // Register the given callback for the associated I/O port if specified.
-        if (initHw() && (nullptr != callback))
-        {
-            if (PORTB == myHw->portx) { myCallbacks.add(callback, CbIndex::PortB); }
-            else if (PORTC == myHw->portx) { myCallbacks.add(callback, CbIndex::PortC); } 
-            else if (PORTD == myHw->portx) { myCallbacks.add(callback, CbIndex::PortD); }
-        }
+        // Register the given callback for the pin on success.
+        if (initHw()) { myCallbacks[myId] = PinCallback{nullptr, callback}; }
     }
 }
 
@@ -142,6 +152,7 @@ Atmega328p::~Atmega328p() noexcept
     
     // Free resources used for the GPIO before deletion.
     enableInterrupt(false);
+    myCallbacks[myId] = PinCallback{nullptr, nullptr};
     utils::clear(myHw->ddrx, myPin);
     utils::clear(myHw->portx, myPin);
     utils::clear(myPinRegistry, myId);
@@ -202,9 +213,15 @@ void Atmega328p::enableInterrupt(const bool enable) noexcept
     // Enable/disable interrupts on the associated pin as specified.
     if (enable)
     {
-        utils::globalInterruptEnable();
+        // Latch the current input before enabling the interrupt, so that only subsequent
+        // changes are detected. Interrupts are disabled, since the ISR updates the latch too.
+        utils::globalInterruptDisable();
+        if (utils::read(myHw->pinx, myPin)) { utils::set(myHw->pinState, myPin); }
+        else { utils::clear(myHw->pinState, myPin); }
+
         utils::set(PCICR, myHw->pcix);
         utils::set(myHw->pcmskx, myPin);
+        utils::globalInterruptEnable();
     }
     else { utils::clear(myHw->pcmskx, myPin); }
 }
@@ -216,6 +233,21 @@ void Atmega328p::blink(const uint16_t& blinkSpeed_ms) noexcept
     utils::delay_ms(blinkSpeed_ms);
 }
 
+// -----------------------------------------------------------------------------
+bool Atmega328p::reservePin(const uint8_t pin) noexcept
+{
+    // Only reserve the pin if it's valid and neither used by a GPIO nor reserved.
+    if (!isPinFree(pin)) { return false; }
+    utils::set(myPinRegistry, pin);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::releasePin(const uint8_t pin) noexcept
+{
+    if (PinCount > pin) { utils::clear(myPinRegistry, pin); }
+}
+
 // -----------------------------------------------------------------------------
 Atmega328p::IoPort Atmega328p::getIoPort(const uint8_t id) const noexcept
 {
@@ -272,13 +304,13 @@ bool Atmega328p::initHw() noexcept
 }
 
 // -----------------------------------------------------------------------------
-ISR(PCINT0_vect) { myCallbacks.invoke(CbIndex::PortB); }
+ISR(PCINT0_vect) { handlePinChange(myHwPortB); }
 
 // -----------------------------------------------------------------------------
-ISR(PCINT1_vect) { myCallbacks.invoke(CbIndex::PortC); }
+ISR(PCINT1_vect) { handlePinChange(myHwPortC); }
 
 // -----------------------------------------------------------------------------
-ISR(PCINT2_vect) { myCallbacks.invoke(CbIndex::PortD); }
+ISR(PCINT2_vect) { handlePinChange(myHwPortD); }
 
 namespace
 {
@@ -310,6 +342,29 @@ Hardware* findHw(const Atmega328p::IoPort ioPort) noexcept
             return nullptr;
     }
 }
+
+// -----------------------------------------------------------------------------
+void handlePinChange(Hardware& hw) noexcept
+{
+    // Latch the input, only consider changes on pins with pin change interrupt enabled.
+    const uint8_t state{hw.pinx};
+    uint8_t changes{static_cast<uint8_t>((state ^ hw.pinState) & hw.pcmskx)};
+    hw.pinState = state;
+
+    // Invoke the callbacks of the changed pins with the associated edges.
+    for (uint8_t pin{}; 0U != changes; ++pin, changes >>= 1U)
+    {
+        const uint8_t id{static_cast<uint8_t>(hw.pinOffset + pin)};
+        if (!utils::read(changes, 0U) || (PinCount <= id)) { continue; }
+
+        const PinCallback& callback{myCallbacks[id]};
+        if (nullptr != callback.onChange) { callback.onChange(); }
+        if (nullptr != callback.onEdge) 
+        { 
+            callback.onEdge(utils::read(state, pin) ? Edge::Rising : Edge::Falling); 
+        }
+    }
+}
 } // namespace
 } // namespace gpio
 } // namespace driver
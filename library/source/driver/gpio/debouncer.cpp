@@ -0,0 +1,85 @@
+/**
+ * @brief Implementation details of the debounced input service.
+ */
+#include "driver/gpio/debouncer.h"
+
+namespace driver
+{
+namespace gpio
+{
+// -----------------------------------------------------------------------------
+Debouncer::Debouncer(const Callback callback, const uint8_t integratorLimit,
+                     const uint16_t longPressTicks) noexcept
+    : myInputs{}
+    , myCallback{callback}
+    , myIntegratorLimit{0U < integratorLimit ? integratorLimit : static_cast<uint8_t>(1U)}
+    , myLongPressTicks{longPressTicks}
+    , myInputCount{}
+{}
+
+// -----------------------------------------------------------------------------
+int8_t Debouncer::add(const Interface& input, const bool activeLow) noexcept
+{
+    if (MaxInputCount <= myInputCount) { return -1; }
+
+    // Start from the current state of the input to avoid spurious events.
+    const bool active{input.read() != activeLow};
+    myInputs[myInputCount] = Input{&input, active ? myIntegratorLimit : static_cast<uint8_t>(0U),
+                                   activeLow, active, 0U};
+    return static_cast<int8_t>(myInputCount++);
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Debouncer::inputCount() const noexcept { return myInputCount; }
+
+// -----------------------------------------------------------------------------
+bool Debouncer::isActive(const uint8_t input) const noexcept
+{
+    return input < myInputCount ? myInputs[input].active : false;
+}
+
+// -----------------------------------------------------------------------------
+void Debouncer::tick() noexcept
+{
+    for (uint8_t i{}; i < myInputCount; ++i)
+    {
+        const Input& input{myInputs[i]};
+        update(i, input.gpio->read() != input.activeLow);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Debouncer::update(const uint8_t index, const bool sample) noexcept
+{
+    Input& input{myInputs[index]};
+
+    // Integrate the sample, change the debounced state when the integrator reaches its limits.
+    if (sample && (myIntegratorLimit > input.integrator))
+    {
+        if ((myIntegratorLimit == ++input.integrator) && !input.active)
+        {
+            input.active      = true;
+            input.activeTicks = 0U;
+            if (nullptr != myCallback) { myCallback(index, InputEvent::Press); }
+        }
+    }
+    else if (!sample && (0U < input.integrator))
+    {
+        if ((0U == --input.integrator) && input.active)
+        {
+            input.active = false;
+            if (nullptr != myCallback) { myCallback(index, InputEvent::Release); }
+        }
+    }
+
+    // Generate a single long press event when the input has been active long enough.
+    if (input.active && (0U < myLongPressTicks) && (myLongPressTicks > input.activeTicks))
+    {
+        if ((myLongPressTicks == ++input.activeTicks) && (nullptr != myCallback))
+        {
+            myCallback(index, InputEvent::LongPress);
+        }
+    }
+}
+} // namespace gpio
+} // namespace driver
@@ -0,0 +1,221 @@
+/**
+ * @brief Implementation details of GPIO pin groups for ATmega328P.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/gpio/port_group.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace gpio
+{
+namespace
+{
+Atmega328p::IoPort getIoPort(uint8_t pin) noexcept;
+PortRegisters* findRegs(Atmega328p::IoPort ioPort) noexcept;
+
+} // namespace
+
+/**
+ * @brief Structure of I/O port registers.
+ */
+struct PortRegisters
+{
+    /** Reference to data direction register (DDRx). */
+    volatile uint8_t& ddrx;
+
+    /** Reference to port (output) register (PORTx). */
+    volatile uint8_t& portx;
+
+    /** Reference to pin (input) register (PINx). */
+    volatile uint8_t& pinx;
+};
+
+/** Registers of I/O port B. */
+PortRegisters myRegsPortB{DDRB, PORTB, PINB};
+
+/** Registers of I/O port C. */
+PortRegisters myRegsPortC{DDRC, PORTC, PINC};
+
+/** Registers of I/O port D. */
+PortRegisters myRegsPortD{DDRD, PORTD, PIND};
+
+// -----------------------------------------------------------------------------
+PortGroup::PortGroup(const uint8_t* pins, const uint8_t pinCount,
+                     const Direction direction) noexcept
+    : myRegs{nullptr}
+    , myDirection{direction}
+    , myIoPort{Atmega328p::IoPort::Count}
+    , myMask{}
+{
+    // Reserve the pins, put the group in safe state on failure.
+    if ((static_cast<uint8_t>(Direction::Count) <= static_cast<uint8_t>(myDirection))
+        || !reservePins(pins, pinCount))
+    {
+        return;
+    }
+    myRegs = findRegs(myIoPort);
+
+    // Set the data direction of all pins at once.
+    switch (myDirection)
+    {
+        case Direction::InputPullup:
+            myRegs->portx |= myMask;
+            break;
+        case Direction::Output:
+            myRegs->ddrx |= myMask;
+            break;
+        default:
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+PortGroup::~PortGroup() noexcept
+{
+    // Skip cleanup if the group is uninitialized.
+    if (!isInitialized()) { return; }
+
+    // Free resources used for the group before deletion.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    myRegs->ddrx &= static_cast<uint8_t>(~myMask);
+    myRegs->portx &= static_cast<uint8_t>(~myMask);
+    SREG = status;
+    releasePins();
+    myRegs = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+bool PortGroup::isInitialized() const noexcept { return nullptr != myRegs; }
+
+// -----------------------------------------------------------------------------
+Direction PortGroup::direction() const noexcept { return myDirection; }
+
+// -----------------------------------------------------------------------------
+uint8_t PortGroup::mask() const noexcept { return isInitialized() ? myMask : 0U; }
+
+// -----------------------------------------------------------------------------
+uint8_t PortGroup::read() const noexcept
+{
+    // Only read input if the group is initialized.
+    return isInitialized() ? (myRegs->pinx & myMask) : 0U;
+}
+
+// -----------------------------------------------------------------------------
+void PortGroup::write(uint8_t mask, const uint8_t value) noexcept
+{
+    // Only write output if the group is initialized and configured as output.
+    if (!isInitialized() || (Direction::Output != myDirection)) { return; }
+
+    // Update the pins with a single write, disable interrupts so that no ISR can modify the
+    // other pins of the port in between.
+    mask &= myMask;
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    myRegs->portx = (myRegs->portx & static_cast<uint8_t>(~mask)) | (value & mask);
+    SREG = status;
+}
+
+// -----------------------------------------------------------------------------
+void PortGroup::toggle(const uint8_t mask) noexcept
+{
+    // Only toggle output if the group is initialized and configured as output.
+    if (!isInitialized() || (Direction::Output != myDirection)) { return; }
+
+    // The hardware will toggle the outputs of the pins written to the pin register,
+    // the other pins are unaffected.
+    myRegs->pinx = mask & myMask;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t PortGroup::pinMask(const uint8_t pin) noexcept
+{
+    // Return the mask of the physical pin on the associated port, or 0 on failure.
+    switch (getIoPort(pin))
+    {
+        case Atmega328p::IoPort::B:
+            return static_cast<uint8_t>(1U << (pin - Atmega328p::Port::B0));
+        case Atmega328p::IoPort::C:
+            return static_cast<uint8_t>(1U << (pin - Atmega328p::Port::C0));
+        case Atmega328p::IoPort::D:
+            return static_cast<uint8_t>(1U << (pin - Atmega328p::Port::D0));
+        default:
+            return 0U;
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool PortGroup::reservePins(const uint8_t* pins, const uint8_t pinCount) noexcept
+{
+    if ((nullptr == pins) || (0U == pinCount)) { return false; }
+    myIoPort = getIoPort(pins[0U]);
+
+    // Reserve the pins one by one, release the reserved pins if any pin is invalid,
+    // associated with another port or already in use (including duplicates).
+    for (uint8_t i{}; i < pinCount; ++i)
+    {
+        if ((myIoPort != getIoPort(pins[i])) || !Atmega328p::reservePin(pins[i]))
+        {
+            releasePins();
+            return false;
+        }
+        myMask |= pinMask(pins[i]);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void PortGroup::releasePins() noexcept
+{
+    // Release the pins of the group, which are identified by the mask.
+    for (uint8_t pin{}; pin <= Atmega328p::Port::C5; ++pin)
+    {
+        if ((myIoPort == getIoPort(pin)) && (0U != (myMask & pinMask(pin))))
+        {
+            Atmega328p::releasePin(pin);
+        }
+    }
+    myMask = 0U;
+}
+
+namespace
+{
+// -----------------------------------------------------------------------------
+Atmega328p::IoPort getIoPort(const uint8_t pin) noexcept
+{
+    // Return the port associated with the given pin, or an invalid enum on failure.
+    if (utils::inRange(pin, Atmega328p::Port::B0, Atmega328p::Port::B5))
+    {
+        return Atmega328p::IoPort::B;
+    }
+    else if (utils::inRange(pin, Atmega328p::Port::C0, Atmega328p::Port::C5))
+    {
+        return Atmega328p::IoPort::C;
+    }
+    else if (utils::inRange(pin, Atmega328p::Port::D0, Atmega328p::Port::D7))
+    {
+        return Atmega328p::IoPort::D;
+    }
+    return Atmega328p::IoPort::Count;
+}
+
+// -----------------------------------------------------------------------------
+PortRegisters* findRegs(const Atmega328p::IoPort ioPort) noexcept
+{
+    // Return the registers associated with the port, or a nullptr on failure.
+    switch (ioPort)
+    {
+        case Atmega328p::IoPort::B:
+            return &myRegsPortB;
+        case Atmega328p::IoPort::C:
+            return &myRegsPortC;
+        case Atmega328p::IoPort::D:
+            return &myRegsPortD;
+        default:
+            return nullptr;
+    }
+}
+} // namespace
+} // namespace gpio
+} // namespace driver
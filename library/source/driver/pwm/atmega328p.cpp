@@ -0,0 +1,430 @@
+/**
+ * @brief PWM driver implementation details for ATmega328P.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/pwm/atmega328p.h"
+#include "driver/timer/atmega328p.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace pwm
+{
+/**
+ * @brief PWM channel structure.
+ */
+struct Channel
+{
+    /** The pin number of the output. */
+    uint8_t pin;
+
+    /** Index of the timer circuit generating the waveform. */
+    uint8_t circuit;
+
+    /** Indicate whether output compare unit B is used (otherwise unit A is used). */
+    bool unitB;
+};
+
+namespace
+{
+/**
+ * @brief Structure containing indexes for available timer circuits.
+ */
+struct Index
+{
+	/** Index for Timer 0. */
+	static constexpr uint8_t Timer0{0U};
+
+	/** Index for Timer 1. */
+	static constexpr uint8_t Timer1{1U};
+
+	/** Index for Timer 2. */
+	static constexpr uint8_t Timer2{2U};
+};
+
+/**
+ * @brief Structure of PWM parameters.
+ */
+struct PwmParam
+{
+    /** CPU frequency in Hz. */
+    static constexpr double CpuFrequency_Hz{16000000.0};
+
+    /** The number of counts per period for the 8-bit timers Timer 0 and Timer 2. */
+    static constexpr uint32_t PeriodCount8bit{256U};
+
+    /** Min number of counts per period, which results in a square wave at best. */
+    static constexpr uint32_t MinPeriodCount{2U};
+
+    /** Max number of counts per period for the 16-bit timer Timer 1. */
+    static constexpr uint32_t MaxPeriodCount{65536UL};
+};
+
+/**
+ * @brief Structure of timer circuit configuration.
+ */
+struct Circuit
+{
+    /** The number of PWM outputs using the circuit. */
+    uint8_t userCount;
+
+    /** Top value, i.e. the number of counts per period - 1. */
+    uint16_t top;
+
+    /** Prescaler of the timer clock. */
+    uint16_t prescaler;
+
+    /** Clock select bits corresponding to the prescaler. */
+    uint8_t clockBits;
+};
+
+/** The number of timer circuits available. */
+constexpr uint8_t CircuitCount{3U};
+
+/** The number of PWM channels available. */
+constexpr uint8_t ChannelCount{6U};
+
+/** Prescalers available for Timer 0 and Timer 1, the clock select bits are index + 1. */
+constexpr uint16_t Prescalers[]{1U, 8U, 64U, 256U, 1024U};
+
+/** Prescalers available for Timer 2, the clock select bits are index + 1. */
+constexpr uint16_t PrescalersTimer2[]{1U, 8U, 32U, 64U, 128U, 256U, 1024U};
+
+/** Available PWM channels. */
+constexpr Channel Channels[ChannelCount]
+{
+    {6U, Index::Timer0, false},  // OC0A.
+    {5U, Index::Timer0, true},   // OC0B.
+    {9U, Index::Timer1, false},  // OC1A.
+    {10U, Index::Timer1, true},  // OC1B.
+    {11U, Index::Timer2, false}, // OC2A.
+    {3U, Index::Timer2, true},   // OC2B.
+};
+
+/** Configuration of each timer circuit. */
+Circuit myCircuits[CircuitCount]{};
+
+/** Channel registry (1 = reserved, 0 = free). */
+uint8_t myChannelRegistry{};
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t channelIndex(const Channel& channel) noexcept
+{
+    return static_cast<uint8_t>(&channel - Channels);
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t portBit(const uint8_t pin) noexcept { return 8U > pin ? pin : pin - 8U; }
+
+// -----------------------------------------------------------------------------
+volatile uint8_t& dataDirectionReg(const uint8_t pin) noexcept { return 8U > pin ? DDRD : DDRB; }
+
+// -----------------------------------------------------------------------------
+volatile uint8_t& portReg(const uint8_t pin) noexcept { return 8U > pin ? PORTD : PORTB; }
+
+// -----------------------------------------------------------------------------
+volatile uint8_t& controlRegA(const uint8_t circuit) noexcept
+{
+    switch (circuit)
+    {
+        case Index::Timer0:
+            return TCCR0A;
+        case Index::Timer1:
+            return TCCR1A;
+        default:
+            return TCCR2A;
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint8_t compareOutputBit(const Channel& channel) noexcept
+{
+    // Use non-inverting mode, i.e. the output is set at bottom and cleared on compare match.
+    switch (channel.circuit)
+    {
+        case Index::Timer0:
+            return channel.unitB ? COM0B1 : COM0A1;
+        case Index::Timer1:
+            return channel.unitB ? COM1B1 : COM1A1;
+        default:
+            return channel.unitB ? COM2B1 : COM2A1;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void setCompareValue(const Channel& channel, const uint16_t value) noexcept
+{
+    switch (channel.circuit)
+    {
+        case Index::Timer0:
+            if (channel.unitB) { OCR0B = static_cast<uint8_t>(value); }
+            else { OCR0A = static_cast<uint8_t>(value); }
+            break;
+        case Index::Timer1:
+            if (channel.unitB) { OCR1B = value; }
+            else { OCR1A = value; }
+            break;
+        default:
+            if (channel.unitB) { OCR2B = static_cast<uint8_t>(value); }
+            else { OCR2A = static_cast<uint8_t>(value); }
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool selectClock8bit(const uint32_t frequency_Hz, const uint16_t* prescalers, 
+                     const uint8_t prescalerCount, Circuit& config) noexcept
+{
+    // Select the prescaler resulting in the frequency closest to the requested one.
+    double minDeviation{};
+
+    for (uint8_t i{}; i < prescalerCount; ++i)
+    {
+        const double frequency{PwmParam::CpuFrequency_Hz 
+            / (static_cast<double>(prescalers[i]) * PwmParam::PeriodCount8bit)};
+        const double deviation{utils::absolute(frequency - frequency_Hz)};
+
+        if ((0U == i) || (deviation < minDeviation))
+        {
+            minDeviation     = deviation;
+            config.prescaler = prescalers[i];
+            config.clockBits = i + 1U;
+        }
+    }
+    config.top = PwmParam::PeriodCount8bit - 1U;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool selectClock16bit(const uint32_t frequency_Hz, Circuit& config) noexcept
+{
+    // Select the lowest prescaler for which the period fits, which gives the best resolution.
+    for (uint8_t i{}; i < sizeof(Prescalers) / sizeof(Prescalers[0U]); ++i)
+    {
+        const uint32_t periodCount{utils::round<uint32_t>(PwmParam::CpuFrequency_Hz 
+            / (static_cast<double>(Prescalers[i]) * frequency_Hz))};
+
+        // Return false if the frequency is too high.
+        if (PwmParam::MinPeriodCount > periodCount) { return false; }
+
+        if (PwmParam::MaxPeriodCount >= periodCount)
+        {
+            config.top       = static_cast<uint16_t>(periodCount - 1U);
+            config.prescaler = Prescalers[i];
+            config.clockBits = i + 1U;
+            return true;
+        }
+    }
+    // Return false if the frequency is too low.
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+bool selectClock(const uint8_t circuit, const uint32_t frequency_Hz, Circuit& config) noexcept
+{
+    if (0U == frequency_Hz) { return false; }
+
+    switch (circuit)
+    {
+        case Index::Timer0:
+            return selectClock8bit(frequency_Hz, Prescalers, 
+                sizeof(Prescalers) / sizeof(Prescalers[0U]), config);
+        case Index::Timer1:
+            return selectClock16bit(frequency_Hz, config);
+        default:
+            return selectClock8bit(frequency_Hz, PrescalersTimer2, 
+                sizeof(PrescalersTimer2) / sizeof(PrescalersTimer2[0U]), config);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void configureCircuit(const uint8_t circuit, const Circuit& config) noexcept
+{
+    // Use fast PWM mode, with ICR1 as top value for Timer 1 and fixed top value 0xFF otherwise.
+    switch (circuit)
+    {
+        case Index::Timer0:
+            TCCR0A = (1U << WGM01) | (1U << WGM00);
+            TCCR0B = config.clockBits;
+            break;
+        case Index::Timer1:
+            ICR1   = config.top;
+            TCCR1A = (1U << WGM11);
+            TCCR1B = (1U << WGM13) | (1U << WGM12) | config.clockBits;
+            break;
+        default:
+            TCCR2A = (1U << WGM21) | (1U << WGM20);
+            TCCR2B = config.clockBits;
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void resetCircuit(const uint8_t circuit) noexcept
+{
+    switch (circuit)
+    {
+        case Index::Timer0:
+            TCCR0A = 0U;
+            TCCR0B = 0U;
+            OCR0A  = 0U;
+            OCR0B  = 0U;
+            break;
+        case Index::Timer1:
+            TCCR1A = 0U;
+            TCCR1B = 0U;
+            OCR1A  = 0U;
+            OCR1B  = 0U;
+            ICR1   = 0U;
+            break;
+        default:
+            TCCR2A = 0U;
+            TCCR2B = 0U;
+            OCR2A  = 0U;
+            OCR2B  = 0U;
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+const Channel* reserve(const uint8_t pin, const uint32_t frequency_Hz) noexcept
+{
+    // Find the channel associated with the pin, return a nullptr if the pin is invalid.
+    const Channel* channel{nullptr};
+
+    for (const auto& ch : Channels)
+    {
+        if (pin == ch.pin) { channel = &ch; }
+    }
+    if ((nullptr == channel) || utils::read(myChannelRegistry, channelIndex(*channel))) 
+    { 
+        return nullptr; 
+    }
+
+    // Calculate the circuit configuration, return a nullptr if the frequency is invalid.
+    Circuit config{};
+    if (!selectClock(channel->circuit, frequency_Hz, config)) { return nullptr; }
+    Circuit& circuit{myCircuits[channel->circuit]};
+
+    // Reserve and configure the circuit if unused, otherwise require the same configuration.
+    if (0U == circuit.userCount)
+    {
+        if (!timer::Atmega328p::reserveCircuit(channel->circuit)) { return nullptr; }
+        circuit = config;
+        configureCircuit(channel->circuit, circuit);
+    }
+    else if ((config.top != circuit.top) || (config.clockBits != circuit.clockBits)) 
+    { 
+        return nullptr; 
+    }
+    circuit.userCount++;
+    utils::set(myChannelRegistry, channelIndex(*channel));
+    return channel;
+}
+
+// -----------------------------------------------------------------------------
+void release(const Channel& channel) noexcept
+{
+    utils::clear(myChannelRegistry, channelIndex(channel));
+    Circuit& circuit{myCircuits[channel.circuit]};
+
+    // Reset and release the circuit when the last channel using it is released.
+    if (0U == --circuit.userCount)
+    {
+        resetCircuit(channel.circuit);
+        timer::Atmega328p::releaseCircuit(channel.circuit);
+    }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Atmega328p::Atmega328p(const uint8_t pin, const uint32_t frequency_Hz, const double dutyCycle, 
+                       const bool enable) noexcept
+    : myChannel{reserve(pin, frequency_Hz)}
+    , myHighCount{}
+    , myEnabled{false}
+{
+    if (!isInitialized()) { return; }
+
+    // Set the pin to output, held low until the PWM output is enabled.
+    utils::set(dataDirectionReg(pin), portBit(pin));
+    utils::clear(portReg(pin), portBit(pin));
+    setDutyCycle(dutyCycle);
+    setEnabled(enable);
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::~Atmega328p() noexcept
+{
+    // Skip cleanup if the PWM output is uninitialized.
+    if (!isInitialized()) { return; }
+    disconnect();
+    utils::clear(dataDirectionReg(myChannel->pin), portBit(myChannel->pin));
+    release(*myChannel);
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isInitialized() const noexcept { return nullptr != myChannel; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isEnabled() const noexcept { return myEnabled; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::setEnabled(const bool enable) noexcept
+{
+    if (!isInitialized()) { return; }
+    myEnabled = enable;
+
+    // Only connect the output to the timer if the duty cycle exceeds 0, since the output 
+    // would otherwise be high during one count each period.
+    if (myEnabled && (0U < myHighCount)) { connect(); }
+    else { disconnect(); }
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Atmega328p::frequency_Hz() const noexcept
+{
+    if (!isInitialized()) { return 0U; }
+    const Circuit& circuit{myCircuits[myChannel->circuit]};
+    return utils::round<uint32_t>(PwmParam::CpuFrequency_Hz 
+        / (static_cast<double>(circuit.prescaler) * (circuit.top + 1UL)));
+}
+
+// -----------------------------------------------------------------------------
+double Atmega328p::dutyCycle() const noexcept
+{
+    if (!isInitialized()) { return 0.0; }
+    return myHighCount / (myCircuits[myChannel->circuit].top + 1.0);
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::setDutyCycle(const double dutyCycle) noexcept
+{
+    if (!isInitialized() || (0.0 > dutyCycle) || (1.0 < dutyCycle)) { return false; }
+
+    // Convert the duty cycle to the number of counts the output is high each period.
+    const uint32_t periodCount{static_cast<uint32_t>(myCircuits[myChannel->circuit].top) + 1U};
+    myHighCount = utils::round<uint32_t>(dutyCycle * periodCount);
+
+    // The output is high until compare match, i.e. the compare value + 1 counts.
+    if (0U < myHighCount) 
+    { 
+        setCompareValue(*myChannel, static_cast<uint16_t>(myHighCount - 1U)); 
+    }
+    setEnabled(myEnabled);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::connect() noexcept
+{
+    utils::set(controlRegA(myChannel->circuit), compareOutputBit(*myChannel));
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::disconnect() noexcept
+{
+    utils::clear(controlRegA(myChannel->circuit), compareOutputBit(*myChannel));
+}
+} // namespace pwm
+} // namespace driver
@@ -0,0 +1,134 @@
+/**
+ * @brief Reset cause driver implementation details for ATmega328P.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/reset/atmega328p.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace reset
+{
+namespace
+{
+/** Magic number indicating that the crash record in no-init RAM is valid. */
+constexpr uint16_t RecordMagic{0xC4A5U};
+
+/**
+ * @brief Structure of the crash record kept in no-init RAM.
+ */
+struct Record
+{
+    /** Magic number, only equal to RecordMagic if the record is valid. */
+    uint16_t magic;
+
+    /** The crash record. */
+    CrashRecord data;
+};
+
+// The variables below are written before the static data is initialized on target, hence
+// all of them are placed in no-init RAM.
+
+/** Crash record of the current run, preserved over warm resets. */
+Record myRecord NOINIT;
+
+/** Crash record of the previous run. */
+CrashRecord myPreviousRecord NOINIT;
+
+/** Reset flags captured at boot. */
+uint8_t myResetFlags NOINIT;
+
+/** Indicate whether the crash record of the previous run is valid. */
+bool myHasPreviousRecord NOINIT;
+
+// -----------------------------------------------------------------------------
+void updateStackHighWater() noexcept
+{
+    // The stack grows downwards from the end of the RAM.
+    const uint16_t stackUsage{static_cast<uint16_t>(RAMEND - SP)};
+    if (stackUsage > myRecord.data.stackHighWater) { myRecord.data.stackHighWater = stackUsage; }
+}
+
+#ifndef TESTSUITE
+// -----------------------------------------------------------------------------
+// Capture the reset cause right after the stack pointer has been set up, before the static
+// data is initialized and before the watchdog timer can reset the system again.
+void captureAtBoot() noexcept __attribute__((naked, used, section(".init3")));
+void captureAtBoot() noexcept { Atmega328p::captureResetCause(); }
+#endif /** TESTSUITE */
+} // namespace
+
+// -----------------------------------------------------------------------------
+Interface& Atmega328p::getInstance() noexcept
+{
+    // Create and initialize the singleton reset cause driver instance (once only).
+    static Atmega328p myInstance{};
+
+    // Return a reference to the singleton instance, cast to the corresponding interface.
+    return myInstance;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::captureResetCause() noexcept
+{
+    // Save and clear the reset flags, since they are otherwise kept over the next reset.
+    myResetFlags = MCUSR;
+    MCUSR        = 0U;
+
+    // Disable the watchdog timer, which remains enabled with the shortest timeout after a
+    // watchdog reset.
+    utils::set(WDTCSR, WDCE, WDE);
+    WDTCSR = 0U;
+
+    // Keep the crash record of the previous run if it survived the reset, the RAM content is
+    // undefined after power-on and brown-out resets.
+    myHasPreviousRecord = (RecordMagic == myRecord.magic)
+        && !utils::read(myResetFlags, PORF) && !utils::read(myResetFlags, BORF);
+    if (myHasPreviousRecord) { myPreviousRecord = myRecord.data; }
+
+    // Start a new crash record for the current run.
+    myRecord = Record{RecordMagic, CrashRecord{0U, 0U, 0U}};
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::recordWatchdogTimeout(const uint16_t programCounter) noexcept
+{
+    myRecord.data.programCounter = programCounter;
+    updateStackHighWater();
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isInitialized() const noexcept { return true; }
+
+// -----------------------------------------------------------------------------
+Cause Atmega328p::cause() const noexcept
+{
+    // Several flags may be set, report the flag that invalidates the most state first.
+    if (utils::read(myResetFlags, PORF)) { return Cause::PowerOn; }
+    if (utils::read(myResetFlags, BORF)) { return Cause::BrownOut; }
+    if (utils::read(myResetFlags, WDRF)) { return Cause::Watchdog; }
+    if (utils::read(myResetFlags, EXTRF)) { return Cause::External; }
+    return Cause::Unknown;
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::crashRecord(CrashRecord& record) const noexcept
+{
+    if (!myHasPreviousRecord) { return false; }
+    record = myPreviousRecord;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::recordEvent(const uint8_t event) noexcept
+{
+    // Disable interrupts, since the stack high-water mark is also updated from the watchdog
+    // timeout interrupt.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    myRecord.data.lastEvent = event;
+    updateStackHighWater();
+    SREG = status;
+}
+} // namespace reset
+} // namespace driver
@@ -2,6 +2,7 @@
  * @brief Implementation details of serial driver.
  */
 #include "arch/avr/hw_platform.h"
+#include "container/ring_buffer.h"
 #include "driver/serial/atmega328p.h"
 #include "utils/utils.h"
 
@@ -20,15 +21,39 @@ constexpr char NewLine{'\n'};
 /** Carriage return character. */
 constexpr char CarriageReturn{'\r'};
 
+/** Size of the receive buffer in bytes. */
+constexpr uint8_t ReceiveBufferSize{32U};
+
+/** Buffer holding bytes received by the receive interrupt. */
+container::RingBuffer<uint8_t, ReceiveBufferSize> myReceiveBuffer{};
+
+/** Callback to invoke when data is received. */
+void (*myReceiveCallback)(){nullptr};
+
 // -----------------------------------------------------------------------------
 void transmitChar(const char character) noexcept
 {
     // Wait until the previous character has been sent.
     while (!utils::read(UCSR0A, UDRE0));
 
+    // Clear the transmit complete flag (by writing one), so it indicates when the character
+    // has been shifted out. Keep the writable settings, but write zeros to the error flags
+    // as required, hence a read-modify-write of the whole register can't be used.
+    UCSR0A = (UCSR0A & ((1U << U2X0) | (1U << MPCM0))) | (1U << TXC0);
+
     // Put the new character in the transmission register.
     UDR0 = character;
 }
+
+// -----------------------------------------------------------------------------
+bool receiveByte(uint8_t& byte) noexcept
+{
+    // Read buffered bytes first, then check the data register in case interrupts are disabled.
+    if (myReceiveBuffer.pop(byte)) { return true; }
+    if (!utils::read(UCSR0A, RXC0)) { return false; }
+    byte = UDR0;
+    return true;
+}
 } // namespace 
 
 // -----------------------------------------------------------------------------
@@ -68,8 +93,8 @@ int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size,
         while (bytesRead < size)
         {
             // Wait until a byte has been received.
-            while (!utils::read(UCSR0A, RXC0));
-            buffer[bytesRead++] = UDR0;
+            while (!receiveByte(buffer[bytesRead]));
+            bytesRead++;
         }
     }
     else
@@ -78,10 +103,7 @@ int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size,
         for (uint16_t i{}; i < timeout_ms; ++i)
         {
             // Read all available bytes.
-            while ((size > bytesRead) && utils::read(UCSR0A, RXC0))
-            {
-                buffer[bytesRead++] = UDR0;
-            }
+            while ((size > bytesRead) && receiveByte(buffer[bytesRead])) { bytesRead++; }
 
             // Stop reading if the read buffer is full.
             if (size == bytesRead) { break; }
@@ -101,8 +123,8 @@ Atmega328p::Atmega328p() noexcept
     // Baud rate value corresponding to 9600 kbps.
     constexpr uint16_t baudRateValue{103U};
 
-    // Enable UART transmission.
-    utils::set(UCSR0B, TXEN0, RXEN0);
+    // Enable UART transmission and the receive interrupt.
+    utils::set(UCSR0B, TXEN0, RXEN0, RXCIE0);
 
     // Set the data size to eight bits per byte.
     utils::set(UCSR0C, UCSZ00, UCSZ01);
@@ -114,6 +136,12 @@ Atmega328p::Atmega328p() noexcept
     UDR0 = CarriageReturn;
 }
 
+// -----------------------------------------------------------------------------
+void Atmega328p::setReceiveCallback(void (*callback)()) noexcept 
+{ 
+    myReceiveCallback = callback; 
+}
+
 // -----------------------------------------------------------------------------
 void Atmega328p::print(const char* message) const noexcept
 {
@@ -132,5 +160,14 @@ void Atmega328p::print(const char* message) const noexcept
         else { transmitChar(*it); }
     }
 }
+
+// -----------------------------------------------------------------------------
+ISR (USART_RX_vect)
+{
+    // Buffer the received byte (dropped if the buffer is full), then invoke the callback.
+    const uint8_t byte{UDR0};
+    (void) (myReceiveBuffer.push(byte));
+    if (nullptr != myReceiveCallback) { myReceiveCallback(); }
+}
 } // namespace serial
 } // namespace driver
@@ -47,5 +47,16 @@ int16_t Smart::read() const noexcept
     // Return 0 if the temp sensor isn't initialized.
     return 0;
 }
+
+//------------------------------------------------------------------------------
+bool Smart::recalibrate(const int16_t referenceTemp) noexcept
+{
+    // Return false if the input voltage can't be read.
+    if (!myAdc.isInitialized() || !myAdc.isChannelValid(myPin)) { return false; }
+
+    // Update the model with the current input voltage and the reference temperature.
+    myLinReg.update(myAdc.inputVoltage(myPin), static_cast<double>(referenceTemp));
+    return isInitialized();
+}
 } // namespace tempsensor
 } // namespace driver
\ No newline at end of file
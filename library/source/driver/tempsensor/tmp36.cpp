@@ -3,6 +3,7 @@
  */
 #include <stdint.h>
 
+#include "arch/avr/hw_platform.h"
 #include "driver/adc/interface.h"
 #include "driver/tempsensor/tmp36.h"
 #include "utils/utils.h"
@@ -11,20 +12,89 @@ namespace driver
 {
 namespace tempsensor
 {
+namespace
+{
+/**
+ * @brief Structure of ADC parameters the lookup table is generated for.
+ */
+struct LookupParam
+{
+    /** Max value of the ADC. */
+    static constexpr uint16_t MaxValue{1023U};
+
+    /** Supply voltage of the ADC in Volts. */
+    static constexpr double SupplyVoltage{5.0};
+
+    /** Supply voltage of the ADC in millivolts. */
+    static constexpr int32_t SupplyVoltage_mV{5000};
+
+    /** Sensor output voltage at 0 degrees Celsius in millivolts. */
+    static constexpr int32_t Offset_mV{500};
+};
+
+/**
+ * @brief Lookup table for converting raw ADC counts to temperature.
+ */
+struct LookupTable
+{
+    /** The number of entries, one for each ADC count. */
+    static constexpr uint16_t Size{LookupParam::MaxValue + 1U};
+
+    /** Temperature in tenths of degrees Celsius for each ADC count. */
+    int16_t data[Size];
+};
+
+// -----------------------------------------------------------------------------
+constexpr int16_t computeTenths(const uint16_t adcVal) noexcept
+{
+    // T(°C) = 100 * Uin - 50 corresponds to T(0.1 °C) = Uin(mV) - 500.
+    // Integer division truncates toward zero, which keeps rounding to whole degrees exact.
+    const int32_t scaledVoltage{static_cast<int32_t>(adcVal) * LookupParam::SupplyVoltage_mV};
+    return static_cast<int16_t>((scaledVoltage - LookupParam::Offset_mV * LookupParam::MaxValue)
+        / static_cast<int32_t>(LookupParam::MaxValue));
+}
+
+// -----------------------------------------------------------------------------
+constexpr LookupTable createLookupTable() noexcept
+{
+    LookupTable table{};
+    for (uint16_t i{}; i < LookupTable::Size; ++i) { table.data[i] = computeTenths(i); }
+    return table;
+}
+
+/** Lookup table placed in program memory. */
+constexpr LookupTable myLookupTable PROGMEM{createLookupTable()};
+
+// -----------------------------------------------------------------------------
+constexpr int16_t roundTenths(const int16_t tenths) noexcept
+{
+    // Round to the nearest integer, halfway cases away from zero (like utils::round).
+    return 0 <= tenths ? (tenths + 5) / 10 : (tenths - 5) / 10;
+}
+
+// -----------------------------------------------------------------------------
+bool isLookupTableCompatible(const adc::Interface& adc) noexcept
+{
+    return (LookupParam::MaxValue == adc.maxValue())
+        && (LookupParam::SupplyVoltage == adc.supplyVoltage());
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 Tmp36::Tmp36(const uint8_t pin, adc::Interface& adc) noexcept
     : myAdc{adc}
     , myPin{pin}
+    , myUseLookupTable{isLookupTableCompatible(adc)}
 {
     // Enable the ADC if the initialization succeeded.
     if (isInitialized()) { myAdc.setEnabled(true); }
 }
 
 // -----------------------------------------------------------------------------
-bool Tmp36::isInitialized() const noexcept 
-{ 
+bool Tmp36::isInitialized() const noexcept
+{
     // Return true if the temperature sensor pin is valid and the ADC is initialized.
-    return myAdc.isChannelValid(myPin) && myAdc.isInitialized(); 
+    return myAdc.isChannelValid(myPin) && myAdc.isInitialized();
 }
 
 // -----------------------------------------------------------------------------
@@ -33,9 +103,30 @@ int16_t Tmp36::read() const noexcept
     // Return 0 if initialization failed.
     if (!isInitialized()) { return 0; }
 
+    // Use the lookup table if possible, the tenths are truncated so the rounding is exact.
+    if (myUseLookupTable) { return roundTenths(readTenths()); }
+
     // Return the temperature, rounded to the nearest integer.
     const double temperature{100.0 * myAdc.inputVoltage(myPin) - 50.0};
     return utils::round<int16_t>(temperature);
 }
+
+// -----------------------------------------------------------------------------
+int16_t Tmp36::readTenths() const noexcept
+{
+    // Return 0 if initialization failed.
+    if (!isInitialized()) { return 0; }
+
+    // Look up the temperature corresponding to the raw ADC count if possible.
+    if (myUseLookupTable)
+    {
+        const uint16_t adcVal{myAdc.read(myPin)};
+        const uint16_t index{LookupParam::MaxValue < adcVal ? LookupParam::MaxValue : adcVal};
+        return static_cast<int16_t>(pgm_read_word(&myLookupTable.data[index]));
+    }
+
+    // Otherwise calculate the temperature, truncated toward zero.
+    return static_cast<int16_t>(1000.0 * myAdc.inputVoltage(myPin) - 500.0);
+}
 } // namespace tempsensor
 } // namespace driver
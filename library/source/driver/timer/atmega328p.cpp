@@ -28,11 +28,17 @@ struct Atmega328p::Hardware
     /** Timer index. */
 	uint8_t index;  
 
-    static Hardware* reserve() noexcept;
+    /** Counts remaining until the deadline in tickless mode. */
+    volatile uint32_t remaining;
+
+    /** Timer mode. */
+    Mode mode;
+
+    static Hardware* reserve(Mode mode) noexcept;
 	static void release(Hardware* hw) noexcept;
 
 private:
-    static Hardware* init(const uint8_t timerIndex) noexcept;
+    static Hardware* init(const uint8_t timerIndex, Mode mode) noexcept;
 }; 
 
 namespace
@@ -60,12 +66,54 @@ constexpr uint8_t CircuitCount{3U};
 /** Time between each timer interrupt in ms. */
 constexpr double InterruptIntervalMs{0.128};
 
+/**
+ * @brief Structure of periodic mode parameters.
+ */
+struct PeriodicParam
+{
+    /** Time between each interrupt in us. */
+    static constexpr uint32_t InterruptInterval_us{128U};
+
+    /** Timer counts per us (0.5 us per count, prescaler 8). */
+    static constexpr uint32_t CountsPerUs{2U};
+
+    /** Timer counts per interrupt. */
+    static constexpr uint32_t CountsPerInterrupt{InterruptInterval_us * CountsPerUs};
+};
+
+/**
+ * @brief Structure of tickless mode parameters.
+ */
+struct TicklessParam
+{
+    /** Timer counts per periodic interrupt interval (64 us per count, prescaler 1024). */
+    static constexpr uint32_t CountsPerInterval{2U};
+
+    /** Max counts between two interrupts for the 8-bit timers Timer 0 and Timer 2. */
+    static constexpr uint32_t MaxCounts8bit{256U};
+
+    /** Max counts between two interrupts for the 16-bit timer Timer 1. */
+    static constexpr uint32_t MaxCounts16bit{65536UL};
+
+    /** Time per timer count in us. */
+    static constexpr uint32_t CountInterval_us{64U};
+};
+
 /** Array holding pointers to timers. */
 Atmega328p* myTimers[CircuitCount]{};  
 
 /** Array holding pointers to callbacks. */
 CallbackArray<CircuitCount> myCallbacks{};
 
+/** Circuits reserved for other purposes than timers (1 = reserved, 0 = free). */
+uint8_t myCircuitRegistry{};
+
+// -----------------------------------------------------------------------------
+bool isCircuitFree(const uint8_t circuit) noexcept
+{
+    return (nullptr == myTimers[circuit]) && !utils::read(myCircuitRegistry, circuit);
+}
+
 // -----------------------------------------------------------------------------
 constexpr uint32_t maxCount(const uint32_t timeout_ms) noexcept
 {
@@ -73,6 +121,104 @@ constexpr uint32_t maxCount(const uint32_t timeout_ms) noexcept
         utils::round<uint32_t>(timeout_ms / InterruptIntervalMs) : 0U;
 }
 
+// -----------------------------------------------------------------------------
+constexpr uint32_t maxCounts(const uint8_t timerIndex) noexcept
+{
+    return Index::Timer1 == timerIndex ? 
+        TicklessParam::MaxCounts16bit : TicklessParam::MaxCounts8bit;
+}
+
+// -----------------------------------------------------------------------------
+void setCompareValue(const uint8_t timerIndex, const uint16_t value) noexcept
+{
+	switch (timerIndex)
+	{
+		case Index::Timer0:
+		    OCR0A = static_cast<uint8_t>(value);
+			break;
+		case Index::Timer1:
+		    OCR1A = value;
+			break;
+		case Index::Timer2:
+		    OCR2A = static_cast<uint8_t>(value);
+			break;
+		default:
+		    break;
+	}
+}
+
+// -----------------------------------------------------------------------------
+void clearCounter(const uint8_t timerIndex) noexcept
+{
+	// Also clear any stale compare match flag (by writing a one), since the flag is set while
+	// the timer is stopped and would otherwise trigger an interrupt once the mask bit is set.
+	switch (timerIndex)
+	{
+		case Index::Timer0:
+		    TCNT0 = 0U;
+		    TIFR0 = (1U << OCF0A);
+			break;
+		case Index::Timer1:
+		    TCNT1 = 0U;
+		    TIFR1 = (1U << OCF1A);
+			break;
+		case Index::Timer2:
+		    TCNT2 = 0U;
+		    TIFR2 = (1U << OCF2A);
+			break;
+		default:
+		    break;
+	}
+}
+
+// -----------------------------------------------------------------------------
+uint16_t readCounter(const uint8_t timerIndex) noexcept
+{
+	switch (timerIndex)
+	{
+		case Index::Timer0:
+		    return TCNT0;
+		case Index::Timer1:
+		    return TCNT1;
+		case Index::Timer2:
+		    return TCNT2;
+		default:
+		    return 0U;
+	}
+}
+
+// -----------------------------------------------------------------------------
+uint16_t readCompareValue(const uint8_t timerIndex) noexcept
+{
+	switch (timerIndex)
+	{
+		case Index::Timer0:
+		    return OCR0A;
+		case Index::Timer1:
+		    return OCR1A;
+		case Index::Timer2:
+		    return OCR2A;
+		default:
+		    return 0U;
+	}
+}
+
+// -----------------------------------------------------------------------------
+bool isInterruptPending(const uint8_t timerIndex, const bool tickless) noexcept
+{
+	switch (timerIndex)
+	{
+		case Index::Timer0:
+		    return utils::read(TIFR0, tickless ? OCF0A : TOV0);
+		case Index::Timer1:
+		    return utils::read(TIFR1, OCF1A);
+		case Index::Timer2:
+		    return utils::read(TIFR2, tickless ? OCF2A : TOV2);
+		default:
+		    return false;
+	}
+}
+
 // -----------------------------------------------------------------------------
 void invokeCallback(const uint8_t timerIndex) noexcept
 {
@@ -87,9 +233,9 @@ void invokeCallback(const uint8_t timerIndex) noexcept
 
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p(const uint32_t timeout_ms, void (*callback)(), 
-                       const bool startTimer) noexcept
+                       const bool startTimer, const Mode mode) noexcept
 	// Only attempt to reserve a circuit if the timeout is greater than 0 ms.
-    : myHw{0U < timeout_ms ? Hardware::reserve() : nullptr}
+    : myHw{0U < timeout_ms ? Hardware::reserve(mode) : nullptr}
 	, myMaxCount{maxCount(timeout_ms)}
 	, myEnabled{false}
 {
@@ -135,10 +281,58 @@ void Atmega328p::setTimeout_ms(const uint32_t timeout_ms) noexcept
     myMaxCount = maxCount(timeout_ms);
 }
 
+// -----------------------------------------------------------------------------
+Atmega328p::Mode Atmega328p::mode() const noexcept 
+{ 
+    return isInitialized() ? myHw->mode : Mode::Periodic; 
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Atmega328p::elapsedTime_us() const noexcept
+{
+    if (!isInitialized()) { return 0U; }
+
+    // Disable interrupts while reading, since the counters are updated by the timer interrupt.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    const uint16_t count{readCounter(myHw->index)};
+    const bool pending{isInterruptPending(myHw->index, Mode::Tickless == myHw->mode)};
+    uint32_t elapsedTime_us{};
+
+    if (Mode::Tickless == myHw->mode)
+    {
+        // The counts of the current part of the period haven't been added yet.
+        const uint32_t partCount{static_cast<uint32_t>(readCompareValue(myHw->index)) + 1U};
+        uint32_t elapsedCount{myMaxCount * TicklessParam::CountsPerInterval 
+            - myHw->remaining - partCount + count};
+
+        // A pending interrupt along with a low count indicates that the counter just wrapped.
+        if (pending && (count < partCount / 2U)) { elapsedCount += partCount; }
+        elapsedTime_us = elapsedCount * TicklessParam::CountInterval_us;
+    }
+    else
+    {
+        // A pending interrupt along with a low count indicates that the counter just wrapped.
+        uint32_t interruptCount{myHw->counter};
+        if (pending && (count < PeriodicParam::CountsPerInterrupt / 2U)) { interruptCount++; }
+        elapsedTime_us = interruptCount * PeriodicParam::InterruptInterval_us 
+            + count / PeriodicParam::CountsPerUs;
+    }
+    SREG = status;
+    return elapsedTime_us;
+}
+
 // -----------------------------------------------------------------------------
 void Atmega328p::start() noexcept
 { 
 	if (0U == myMaxCount) { return; }
+
+    // Program the first deadline in tickless mode unless the timer is already running.
+    if ((Mode::Tickless == myHw->mode) && !myEnabled)
+    {
+        clearCounter(myHw->index);
+        startPeriod();
+    }
     utils::globalInterruptEnable();
 	utils::set(*(myHw->maskReg), myHw->maskBit);
 	myEnabled = true;
@@ -162,22 +356,65 @@ void Atmega328p::toggle() noexcept
 void Atmega328p::restart() noexcept
 {
     myHw->counter = 0U;
+
+    // Program a new deadline in tickless mode.
+    if ((Mode::Tickless == myHw->mode) && (0U < myMaxCount))
+    {
+        clearCounter(myHw->index);
+        startPeriod();
+    }
     start();
 }
 
 // -----------------------------------------------------------------------------
 void Atmega328p::handleCallback() noexcept
 {
-	// Increment the timer, invoke callback on timeout.
-	increment();
-
+    if (Mode::Tickless == myHw->mode)
+    {
+        // Ignore the interrupt if the timer is disabled.
+        if (!myEnabled) { return; }
+
+        // Program the next part of the period if the deadline hasn't been reached yet.
+        if (0U < myHw->remaining) 
+        { 
+            scheduleNext(); 
+            return;
+        }
+        // Indicate timeout, since the deadline has been reached.
+        myHw->counter = myMaxCount;
+    }
+	// Increment the timer in periodic mode.
+	else { increment(); }
+
+	// Invoke callback on timeout.
 	if (hasTimedOut()) 
 	{ 
 		myCallbacks.invoke(myHw->index); 
 		clearTimedOut();
+
+        // Program the next deadline in tickless mode unless the timer was stopped or restarted.
+        if ((Mode::Tickless == myHw->mode) && myEnabled && (0U == myHw->remaining)) 
+        { 
+            startPeriod(); 
+        }
 	}
 }
 
+// -----------------------------------------------------------------------------
+bool Atmega328p::reserveCircuit(const uint8_t circuit) noexcept
+{
+    // Only reserve the circuit if it's valid and neither used by a timer nor reserved.
+    if ((CircuitCount <= circuit) || !isCircuitFree(circuit)) { return false; }
+    utils::set(myCircuitRegistry, circuit);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::releaseCircuit(const uint8_t circuit) noexcept
+{
+    if (CircuitCount > circuit) { utils::clear(myCircuitRegistry, circuit); }
+}
+
 // -----------------------------------------------------------------------------
 void Atmega328p::addCallback(void (*callback)()) const noexcept
 { 
@@ -199,12 +436,32 @@ bool Atmega328p::increment() noexcept
 void Atmega328p::clearTimedOut() noexcept { myHw->counter = 0U; }
 
 // -----------------------------------------------------------------------------
-Atmega328p::Hardware* Atmega328p::Hardware::reserve() noexcept
+void Atmega328p::startPeriod() noexcept
+{
+    // Convert the timeout to timer counts, then program the first part of the period.
+    myHw->remaining = myMaxCount * TicklessParam::CountsPerInterval;
+    scheduleNext();
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::scheduleNext() noexcept
+{
+    // Interrupt after the remaining counts, or on counter overflow if not possible.
+    const uint32_t maxCount{maxCounts(myHw->index)};
+    const uint32_t counts{maxCount < myHw->remaining ? maxCount : myHw->remaining};
+
+    // The counter is cleared on compare match, hence the period is the compare value + 1.
+    setCompareValue(myHw->index, static_cast<uint16_t>(counts - 1U));
+    myHw->remaining -= counts;
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::Hardware* Atmega328p::Hardware::reserve(const Mode mode) noexcept
 {
 	// Reserve a timer circuit if any is available, otherwise return a nullptr.
     for (uint8_t i{}; i < CircuitCount; ++i)
 	{
-        if (nullptr == myTimers[i]) { return init(i); }
+        if (isCircuitFree(i)) { return init(i, mode); }
 	}
 	return nullptr;
 }
@@ -218,14 +475,18 @@ void Atmega328p::Hardware::release(Atmega328p::Hardware* hw) noexcept
 	switch (hw->index)
 	{
 		case Index::Timer0:
+		    TCCR0A = 0U;
 		    TCCR0B = 0U;
+		    OCR0A  = 0U;
 			break;
 		case Index::Timer1:
 		    TCCR1B = 0U;
 		    OCR1A = 0U;
 			break;
 		case Index::Timer2:
+		    TCCR2A = 0U;
 		    TCCR2B = 0U;
+		    OCR2A  = 0U;
 			break;
 		default:
 		    break;
@@ -235,7 +496,8 @@ void Atmega328p::Hardware::release(Atmega328p::Hardware* hw) noexcept
 }
 
 // -----------------------------------------------------------------------------
-Atmega328p::Hardware* Atmega328p::Hardware::init(const uint8_t timerIndex) noexcept
+Atmega328p::Hardware* Atmega328p::Hardware::init(const uint8_t timerIndex, 
+                                                  const Mode mode) noexcept
 {
     constexpr uint16_t timer1MaxCount{256U};  
 	constexpr uint8_t controlBits0{(1U << CS01)};
@@ -246,6 +508,39 @@ Atmega328p::Hardware* Atmega328p::Hardware::init(const uint8_t timerIndex) noexc
     Hardware* hw{utils::newMemory<Hardware>()};
 	if (nullptr == hw) { return nullptr; }
 
+    // Use CTC mode with prescaler 1024 in tickless mode, the compare value is set on start.
+    if (Mode::Tickless == mode)
+    {
+        switch (timerIndex)
+        {
+            case Index::Timer0:
+                hw->maskReg = &TIMSK0;
+                hw->maskBit = OCIE0A;
+                TCCR0A      = (1U << WGM01);
+                TCCR0B      = (1U << CS02) | (1U << CS00);
+                break;
+            case Index::Timer1:
+                hw->maskReg = &TIMSK1;
+                hw->maskBit = OCIE1A;
+                TCCR1B      = (1U << WGM12) | (1U << CS12) | (1U << CS10);
+                break;
+            case Index::Timer2:
+                hw->maskReg = &TIMSK2;
+                hw->maskBit = OCIE2A;
+                TCCR2A      = (1U << WGM21);
+                TCCR2B      = (1U << CS22) | (1U << CS21) | (1U << CS20);
+                break;
+            default:
+                utils::deleteMemory(hw);
+                return nullptr;
+        }
+        hw->counter   = 0U;
+        hw->remaining = 0U;
+        hw->index     = timerIndex;
+        hw->mode      = mode;
+        return hw;
+    }
+
 	// Set the structure to refer to the corresponding timer circuit.
 	switch (timerIndex)
 	{
@@ -270,8 +565,10 @@ Atmega328p::Hardware* Atmega328p::Hardware::init(const uint8_t timerIndex) noexc
 			return nullptr;
 	}
 	// Return the initialized circuit.
-    hw->counter = 0U;
-	hw->index   = timerIndex;
+    hw->counter   = 0U;
+    hw->remaining = 0U;
+	hw->index     = timerIndex;
+    hw->mode      = mode;
 	return hw;
 }
 
@@ -284,5 +581,11 @@ ISR (TIMER1_COMPA_vect) { invokeCallback(Index::Timer1); }
 // -----------------------------------------------------------------------------
 ISR (TIMER2_OVF_vect) { invokeCallback(Index::Timer2); }
 
+// -----------------------------------------------------------------------------
+ISR (TIMER0_COMPA_vect) { invokeCallback(Index::Timer0); }
+
+// -----------------------------------------------------------------------------
+ISR (TIMER2_COMPA_vect) { invokeCallback(Index::Timer2); }
+
 } // namespace timer
 } // namespace driver
@@ -0,0 +1,97 @@
+/**
+ * @brief Implementation details of software timers.
+ */
+#include "driver/timer/software.h"
+#include "driver/timer/wheel.h"
+
+namespace driver
+{
+namespace timer
+{
+// -----------------------------------------------------------------------------
+Software::Software(Wheel& wheel, const uint32_t timeout_ms, void (*callback)(), 
+                   const bool startTimer) noexcept
+    : myWheel{wheel}
+    , myCallback{callback}
+    , myNext{nullptr}
+    , myPrev{nullptr}
+    , mySlot{nullptr}
+    , myExpiry{}
+    , myTimeout_ms{timeout_ms}
+    , myEnabled{false}
+    , myTimedOut{false}
+{
+    if (startTimer) { start(); }
+}
+
+// -----------------------------------------------------------------------------
+Software::~Software() noexcept { stop(); }
+
+// -----------------------------------------------------------------------------
+bool Software::isInitialized() const noexcept 
+{ 
+    return myWheel.isInitialized() && (0U < myTimeout_ms); 
+}
+
+// -----------------------------------------------------------------------------
+bool Software::isEnabled() const noexcept { return myEnabled; }
+
+// -----------------------------------------------------------------------------
+bool Software::hasTimedOut() const noexcept { return myTimedOut; }
+
+// -----------------------------------------------------------------------------
+uint32_t Software::timeout_ms() const noexcept { return myTimeout_ms; }
+
+// -----------------------------------------------------------------------------
+void Software::setTimeout_ms(const uint32_t timeout_ms) noexcept
+{
+    // Do nothing if the timeout is invalid, i.e. 0 ms.
+    if (0U == timeout_ms) { return; }
+    myTimeout_ms = timeout_ms;
+}
+
+// -----------------------------------------------------------------------------
+void Software::start() noexcept
+{
+    // Do nothing if the timer is uninitialized or already running.
+    if (!isInitialized() || myEnabled) { return; }
+    myEnabled = true;
+    myWheel.add(*this);
+}
+
+// -----------------------------------------------------------------------------
+void Software::stop() noexcept
+{
+    myWheel.remove(*this);
+    myEnabled = false;
+}
+
+// -----------------------------------------------------------------------------
+void Software::toggle() noexcept
+{
+    if (myEnabled) { stop(); }
+    else { start(); }
+}
+
+// -----------------------------------------------------------------------------
+void Software::restart() noexcept
+{
+    // Reschedule the timer with the full timeout.
+    if (!isInitialized()) { return; }
+    myEnabled = true;
+    myWheel.add(*this);
+}
+
+// -----------------------------------------------------------------------------
+void Software::handleTimeout() noexcept
+{
+    // Indicate timeout while invoking the callback.
+    myTimedOut = true;
+    if (nullptr != myCallback) { myCallback(); }
+    myTimedOut = false;
+
+    // Reschedule the timer unless it was stopped or restarted by the callback.
+    if (myEnabled && (nullptr == mySlot)) { myWheel.add(*this); }
+}
+} // namespace timer
+} // namespace driver
@@ -0,0 +1,84 @@
+/**
+ * @brief Implementation details of the monotonic system time service.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/timer/system_time.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace timer
+{
+namespace
+{
+/**
+ * @brief Structure of time base parameters.
+ */
+struct TimeBaseParam
+{
+    /** Time between each time base update in ms, corresponds to exactly 125 timer interrupts. */
+    static constexpr uint32_t Period_ms{16U};
+
+    /** Time between each time base update in us. */
+    static constexpr uint32_t Period_us{Period_ms * 1000U};
+};
+
+/** Pointer to the system time service driven by the hardware timer. */
+SystemTime* myInstance{nullptr};
+
+// -----------------------------------------------------------------------------
+void handleTimeout() noexcept
+{
+    if (nullptr != myInstance) { myInstance->handleTimeout(); }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+SystemTime::SystemTime(const Atmega328p::Mode mode) noexcept
+    : myTimer{TimeBaseParam::Period_ms, timer::handleTimeout, false, mode}
+    , myTimeBase_us{}
+{
+    // Only use the service if a timer circuit was reserved and no other service is in use.
+    if (!myTimer.isInitialized() || (nullptr != myInstance)) { return; }
+    myInstance = this;
+    myTimer.start();
+}
+
+// -----------------------------------------------------------------------------
+SystemTime::~SystemTime() noexcept
+{
+    // Skip cleanup if the service is uninitialized, the timer circuit is released automatically.
+    if (!isInitialized()) { return; }
+    myTimer.stop();
+    myInstance = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+bool SystemTime::isInitialized() const noexcept { return this == myInstance; }
+
+// -----------------------------------------------------------------------------
+uint64_t SystemTime::uptime_us() const noexcept
+{
+    if (!isInitialized()) { return 0U; }
+
+    // Disable interrupts while reading, since the 64-bit time base can't be read atomically.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    const uint64_t uptime_us{myTimeBase_us + myTimer.elapsedTime_us()};
+    SREG = status;
+    return uptime_us;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t SystemTime::uptime_ms() const noexcept 
+{ 
+    return static_cast<uint32_t>(uptime_us() / 1000U); 
+}
+
+// -----------------------------------------------------------------------------
+void SystemTime::handleTimeout() noexcept 
+{ 
+    myTimeBase_us = myTimeBase_us + TimeBaseParam::Period_us; 
+}
+} // namespace timer
+} // namespace driver
@@ -0,0 +1,183 @@
+/**
+ * @brief Implementation details of the hierarchical timer wheel.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/timer/software.h"
+#include "driver/timer/wheel.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace timer
+{
+namespace
+{
+/** Time between each tick in ms. */
+constexpr uint32_t TickIntervalMs{1U};
+
+/** Time between each tick in us. */
+constexpr uint32_t TickInterval_us{1000U * TickIntervalMs};
+
+/** 
+ * Time between each hardware tick in us. The hardware timer rounds the tick interval to a 
+ * multiple of 128 us, i.e. eight 128 us intervals (1.024 ms) in this case.
+ */
+constexpr uint32_t HardwareTickInterval_us{1024U};
+
+/** Pointer to the wheel driven by the hardware timer. */
+Wheel* myInstance{nullptr};
+
+// -----------------------------------------------------------------------------
+void handleTick() noexcept
+{
+    if (nullptr != myInstance) { myInstance->elapse(HardwareTickInterval_us); }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Wheel::Wheel() noexcept
+    : myTickTimer{TickIntervalMs, handleTick, false, Atmega328p::Mode::Tickless}
+    , mySlots{}
+    , myTicks{}
+    , myRemainder_us{}
+{
+    // Only use the wheel if a timer circuit was reserved and no other wheel is in use.
+    if (!myTickTimer.isInitialized() || (nullptr != myInstance)) { return; }
+    myInstance = this;
+    myTickTimer.start();
+}
+
+// -----------------------------------------------------------------------------
+Wheel::~Wheel() noexcept
+{
+    // Skip cleanup if the wheel is uninitialized, the timer circuit is released automatically.
+    if (!isInitialized()) { return; }
+    myTickTimer.stop();
+    myInstance = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+bool Wheel::isInitialized() const noexcept { return this == myInstance; }
+
+// -----------------------------------------------------------------------------
+uint32_t Wheel::ticks() const noexcept 
+{ 
+    // Disable interrupts while reading, since the 32-bit tick count can't be read atomically.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    const uint32_t ticks{myTicks};
+    SREG = status;
+    return ticks;
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::elapse(const uint32_t time_us) noexcept
+{
+    // Tick once per elapsed tick interval, carry the remainder over to the next call.
+    uint32_t remaining_us{myRemainder_us + time_us};
+
+    while (TickInterval_us <= remaining_us)
+    {
+        tick();
+        remaining_us -= TickInterval_us;
+    }
+    myRemainder_us = static_cast<uint16_t>(remaining_us);
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::tick() noexcept
+{
+    const uint32_t ticks{myTicks + 1U};
+    myTicks = ticks;
+
+    // Cascade the timers of each level whose lower bits of the tick count have wrapped around.
+    for (uint8_t level{1U}; level < LevelCount; ++level)
+    {
+        const uint32_t lowerBits{(static_cast<uint32_t>(1U) << (level * LevelBits)) - 1U};
+        if (0U != (ticks & lowerBits)) { break; }
+        cascade(level);
+    }
+
+    // Handle the expired timers, one at a time, since each callback may start or stop timers.
+    Software*& slot{mySlots[0U][ticks & (SlotCount - 1U)]};
+    
+    while (nullptr != slot)
+    {
+        Software& timer{*slot};
+        remove(timer);
+        timer.handleTimeout();
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::add(Software& timer) noexcept
+{
+    // Schedule the timer with interrupts disabled, restore the interrupt state afterwards.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    remove(timer);
+    timer.myExpiry = myTicks + timer.myTimeout_ms / TickIntervalMs;
+    insert(timer);
+    SREG = status;
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::remove(Software& timer) noexcept
+{
+    // Unlink the timer with interrupts disabled, restore the interrupt state afterwards.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+
+    if (nullptr != timer.mySlot)
+    {
+        if (nullptr != timer.myPrev) { timer.myPrev->myNext = timer.myNext; }
+        else { *timer.mySlot = timer.myNext; }
+        if (nullptr != timer.myNext) { timer.myNext->myPrev = timer.myPrev; }
+
+        timer.myNext = nullptr;
+        timer.myPrev = nullptr;
+        timer.mySlot = nullptr;
+    }
+    SREG = status;
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::insert(Software& timer) noexcept
+{
+    // Select the lowest level covering the remaining number of ticks.
+    const uint32_t remaining{timer.myExpiry - myTicks};
+    uint8_t level{};
+
+    while ((LevelCount - 1U > level) && (remaining >> ((level + 1U) * LevelBits))) { ++level; }
+
+    // Select the slot by the bits of the expiry corresponding to the level.
+    const uint8_t index{static_cast<uint8_t>(
+        (timer.myExpiry >> (level * LevelBits)) & (SlotCount - 1U))};
+    Software*& slot{mySlots[level][index]};
+
+    // Insert the timer first in the slot.
+    timer.myPrev = nullptr;
+    timer.myNext = slot;
+    timer.mySlot = &slot;
+    if (nullptr != slot) { slot->myPrev = &timer; }
+    slot = &timer;
+}
+
+// -----------------------------------------------------------------------------
+void Wheel::cascade(const uint8_t level) noexcept
+{
+    // Detach the timers of the current slot of the given level.
+    const uint8_t index{static_cast<uint8_t>((myTicks >> (level * LevelBits)) & (SlotCount - 1U))};
+    Software* timer{mySlots[level][index]};
+    mySlots[level][index] = nullptr;
+
+    // Insert the timers again, which places them on lower levels.
+    while (nullptr != timer)
+    {
+        Software* next{timer->myNext};
+        insert(*timer);
+        timer = next;
+    }
+}
+} // namespace timer
+} // namespace driver
@@ -3,6 +3,7 @@
  */
 #include "arch/avr/hw_platform.h"
 #include "utils/utils.h"
+#include "driver/reset/atmega328p.h"
 #include "driver/watchdog/atmega328p.h"
 
 namespace driver 
@@ -14,6 +15,19 @@ namespace
 /** Default watchdog timeout (1024 ms). */
 constexpr Atmega328p::Timeout DefaultTimeout{Atmega328p::Timeout::Duration1024ms};
 
+/** Callback invoked on watchdog timeout (nullptr = reset mode only). */
+void (*myTimeoutCallback)(){nullptr};
+
+// -----------------------------------------------------------------------------
+void handleTimeout(const uint16_t programCounter) noexcept
+{
+    // Record the interrupted program counter, since the system may be reset on next timeout.
+    reset::Atmega328p::recordWatchdogTimeout(programCounter);
+
+    // The hardware clears the interrupt enable bit, so the next timeout resets the system.
+    if (nullptr != myTimeoutCallback) { myTimeoutCallback(); }
+}
+
 // -----------------------------------------------------------------------------
 constexpr bool isTimeoutValid(const Atmega328p::Timeout timeout) noexcept
 {
@@ -96,6 +110,10 @@ void Atmega328p::setEnabled(const bool enable) noexcept
     if (enable) { utils::set(WDTCSR, WDE); }
     else { utils::clear(WDTCSR, WDE); }
 
+    // Use interrupt-then-reset mode if a timeout callback is set.
+    if (enable && (nullptr != myTimeoutCallback)) { utils::set(WDTCSR, WDIE); }
+    else { utils::clear(WDTCSR, WDIE); }
+
     // Re-enable interrupts once the write sequence is complete.
     utils::globalInterruptEnable();
 
@@ -123,10 +141,26 @@ void Atmega328p::reset() noexcept
     asm("WDR");
     utils::clear(MCUSR, WDRF);
 
+    // Re-arm the timeout interrupt, which is disabled by hardware after each timeout interrupt.
+    if (myEnabled && (nullptr != myTimeoutCallback)) { utils::set(WDTCSR, WDIE); }
+
     // Re-enable interrupts once the reset process is complete.
     utils::globalInterruptEnable();
 }
 
+// -----------------------------------------------------------------------------
+void Atmega328p::setTimeoutCallback(void (*callback)()) noexcept
+{
+    // Update the callback and the interrupt enablement atomically.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    myTimeoutCallback = callback;
+
+    if (myEnabled && (nullptr != callback)) { utils::set(WDTCSR, WDIE); }
+    else { utils::clear(WDTCSR, WDIE); }
+    SREG = status;
+}
+
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p() noexcept
     : myTimeout{}
@@ -158,5 +192,63 @@ bool Atmega328p::setTimeout(const Timeout timeout) noexcept
     myTimeout = timeout;
     return true;
 }
+
+#ifndef TESTSUITE
+// -----------------------------------------------------------------------------
+ISR(WDT_vect, ISR_NAKED)
+{
+    // Save the registers that may be modified by the handler (the call-clobbered registers and
+    // SREG), read the return address from the stack before passing it to the handler.
+    // The return address is stored high byte first above the 15 saved bytes.
+    asm volatile(
+        "push r0                \n\t"
+        "in   r0, __SREG__      \n\t"
+        "push r0                \n\t"
+        "push r1                \n\t"
+        "clr  r1                \n\t"
+        "push r18               \n\t"
+        "push r19               \n\t"
+        "push r20               \n\t"
+        "push r21               \n\t"
+        "push r22               \n\t"
+        "push r23               \n\t"
+        "push r24               \n\t"
+        "push r25               \n\t"
+        "push r26               \n\t"
+        "push r27               \n\t"
+        "push r30               \n\t"
+        "push r31               \n\t"
+        "in   r30, __SP_L__     \n\t"
+        "in   r31, __SP_H__     \n\t"
+        "ldd  r25, Z+16         \n\t"
+        "ldd  r24, Z+17         \n\t"
+        "call %x0               \n\t"
+        "pop  r31               \n\t"
+        "pop  r30               \n\t"
+        "pop  r27               \n\t"
+        "pop  r26               \n\t"
+        "pop  r25               \n\t"
+        "pop  r24               \n\t"
+        "pop  r23               \n\t"
+        "pop  r22               \n\t"
+        "pop  r21               \n\t"
+        "pop  r20               \n\t"
+        "pop  r19               \n\t"
+        "pop  r18               \n\t"
+        "pop  r1                \n\t"
+        "pop  r0                \n\t"
+        "out  __SREG__, r0      \n\t"
+        "pop  r0                \n\t"
+        "reti                   \n\t"
+        :: "i"(handleTimeout));
+}
+#else
+// -----------------------------------------------------------------------------
+ISR(WDT_vect)
+{
+    // The interrupted program counter can't be read when testing.
+    handleTimeout(0U);
+}
+#endif /** TESTSUITE */
 } // namespace watchdog
 } // namespace driver
@@ -6,25 +6,100 @@
 #include "driver/adc/interface.h"
 #include "driver/eeprom/interface.h"
 #include "driver/gpio/interface.h"
+#include "driver/reset/interface.h"
 #include "driver/serial/interface.h"
 #include "driver/tempsensor/interface.h"
 #include "driver/timer/interface.h"
 #include "driver/watchdog/interface.h"
 #include "logic/logic.h"
+#include "memory/instrumentation.h"
+#include "scheduler/power_manager.h"
+#include "scheduler/supervisor.h"
 
 namespace logic
 {
+// -----------------------------------------------------------------------------
+// Transition table, one row per state with one entry per input (in enumeration order).
+// Entries keeping the state without an action mean that the input is ignored in that state.
+constexpr Logic::StateMachine::Table Logic::TransitionTable
+{
+    // State::Idle
+    {
+        {State::IdleDebouncing, &Logic::startDebounce},      // Input::ButtonActivity
+        {State::Toggling, &Logic::startToggle},              // Input::ToggleRequest
+        {State::Idle, &Logic::readTemp},                     // Input::TempRequest
+        {State::Idle, nullptr},                              // Input::DebounceTimeout
+        {State::Idle, nullptr},                              // Input::ToggleTimeout
+        {State::Idle, &Logic::printTemp},                    // Input::TempTimeout
+        {State::Idle, &Logic::printToggleState},             // Input::StateRequest
+        {State::Idle, &Logic::printPowerStatistics},         // Input::PowerRequest
+    },
+    // State::Toggling
+    {
+        {State::TogglingDebouncing, &Logic::startDebounce},  // Input::ButtonActivity
+        {State::Idle, &Logic::stopToggle},                   // Input::ToggleRequest
+        {State::Toggling, &Logic::readTemp},                 // Input::TempRequest
+        {State::Toggling, nullptr},                          // Input::DebounceTimeout
+        {State::Toggling, &Logic::toggleLed},                // Input::ToggleTimeout
+        {State::Toggling, &Logic::printTemp},                // Input::TempTimeout
+        {State::Toggling, &Logic::printToggleState},         // Input::StateRequest
+        {State::Toggling, &Logic::printPowerStatistics},     // Input::PowerRequest
+    },
+    // State::IdleDebouncing
+    {
+        {State::IdleDebouncing, nullptr},                    // Input::ButtonActivity
+        {State::TogglingDebouncing, &Logic::startToggle},    // Input::ToggleRequest
+        {State::IdleDebouncing, &Logic::readTemp},           // Input::TempRequest
+        {State::Idle, &Logic::endDebounce},                  // Input::DebounceTimeout
+        {State::IdleDebouncing, nullptr},                    // Input::ToggleTimeout
+        {State::IdleDebouncing, &Logic::printTemp},          // Input::TempTimeout
+        {State::IdleDebouncing, &Logic::printToggleState},   // Input::StateRequest
+        {State::IdleDebouncing, &Logic::printPowerStatistics}, // Input::PowerRequest
+    },
+    // State::TogglingDebouncing
+    {
+        {State::TogglingDebouncing, nullptr},                // Input::ButtonActivity
+        {State::IdleDebouncing, &Logic::stopToggle},         // Input::ToggleRequest
+        {State::TogglingDebouncing, &Logic::readTemp},       // Input::TempRequest
+        {State::Toggling, &Logic::endDebounce},              // Input::DebounceTimeout
+        {State::TogglingDebouncing, &Logic::toggleLed},      // Input::ToggleTimeout
+        {State::TogglingDebouncing, &Logic::printTemp},      // Input::TempTimeout
+        {State::TogglingDebouncing, &Logic::printToggleState}, // Input::StateRequest
+        {State::TogglingDebouncing, &Logic::printPowerStatistics}, // Input::PowerRequest
+    },
+};
+
+// -----------------------------------------------------------------------------
+// Serial commands, sorted by name to enable binary search. Placed in program memory.
+constexpr Logic::CommandParser::Command Logic::Commands[CommandCount] PROGMEM
+{
+    {"dump eeprom", "", "print the EEPROM contents", 0U, &Logic::dumpEepromCommand},
+    {"help", "", "list the available commands", 0U, &Logic::helpCommand},
+    {"mem", "", "print the stack and heap usage", 0U, &Logic::memoryCommand},
+    {"p", "", "print the power statistics", 0U, &Logic::powerCommand},
+    {"r", "", "read the temperature", 0U, &Logic::readTempCommand},
+    {"reset", "", "print the cause of the last reset", 0U, &Logic::resetCommand},
+    {"s", "", "check the state of the toggle timer", 0U, &Logic::stateCommand},
+    {"set toggle", "<ms>", "set the toggle timer interval", 1U, &Logic::setToggleCommand},
+    {"t", "", "toggle the toggle timer", 0U, &Logic::toggleCommand},
+    {"temp interval", "<ms>", "set the temperature timer interval", 1U, 
+     &Logic::tempIntervalCommand},
+};
+
 // -----------------------------------------------------------------------------
 Logic::Logic(driver::gpio::Interface& led,
              driver::gpio::Interface& toggleButton,
              driver::gpio::Interface& tempButton, 
-             driver::timer::Interface& debounceTimer, 
+             driver::timer::Interface* debounceTimer, 
              driver::timer::Interface& toggleTimer,
              driver::timer::Interface& tempTimer,
              driver::serial::Interface& serial, 
              driver::watchdog::Interface& watchdog, 
              driver::eeprom::Interface& eeprom, 
-             driver::tempsensor::Interface& tempSensor) noexcept
+             driver::tempsensor::Interface& tempSensor,
+             scheduler::PowerManager* powerManager,
+             scheduler::Supervisor* supervisor,
+             driver::reset::Interface* resetCause) noexcept
     : myLed{led}
     , myToggleButton{toggleButton}
     , myTempButton{tempButton}
@@ -35,12 +110,30 @@ Logic::Logic(driver::gpio::Interface& led,
     , myWatchdog{watchdog}
     , myEeprom{eeprom}
     , myTempSensor{tempSensor}
+    , myEvents{}
+    , myPowerManager{powerManager}
+    , mySupervisor{supervisor}
+    , myMainLoopTask{nullptr != supervisor ? supervisor->addTask(MainLoopDeadline_ms) 
+                                           : static_cast<int8_t>(-1)}
+    , myResetCause{resetCause}
+    , myStateMachine{TransitionTable, *this, State::Idle}
+    , myCommandParser{Commands, *this}
+    , myCommandLine{}
+    , myCommandLength{}
 {
+    // Generate a compiler error if the transition or command table is invalid.
+    static_assert(StateMachine::isValid(TransitionTable), "Invalid transition table!");
+    static_assert(CommandParser::isValid(Commands), "Invalid command table!");
+
     // Enable system if all hardware drivers were initialized correctly.
     if (isInitialized())
     {
-        myToggleButton.enableInterrupt(true);
-        myTempButton.enableInterrupt(true);
+        // Only wake up on button activity if the buttons aren't debounced elsewhere by polling.
+        if (nullptr != myDebounceTimer)
+        {
+            myToggleButton.enableInterrupt(true);
+            myTempButton.enableInterrupt(true);
+        }
         myTempTimer.start();
         mySerial.setEnabled(true);
         myWatchdog.setEnabled(true);
@@ -58,7 +151,7 @@ Logic::~Logic() noexcept
     myLed.write(false);
     myToggleButton.enableInterrupt(false);
     myTempButton.enableInterrupt(false);
-    myDebounceTimer.stop();
+    if (nullptr != myDebounceTimer) { myDebounceTimer->stop(); }
     myToggleTimer.stop();
     myTempTimer.stop();
     mySerial.setEnabled(false);
@@ -72,7 +165,8 @@ bool Logic::isInitialized() const noexcept
 {
     // Return true if all hardware drivers are initialized.
     return myLed.isInitialized() && myToggleButton.isInitialized() && myTempButton.isInitialized()
-        && myDebounceTimer.isInitialized() && myToggleTimer.isInitialized() 
+        && ((nullptr == myDebounceTimer) || myDebounceTimer->isInitialized()) 
+        && myToggleTimer.isInitialized() 
         && myTempTimer.isInitialized() && mySerial.isInitialized() && myWatchdog.isInitialized()
         && myEeprom.isInitialized() && myTempSensor.isInitialized();
 }
@@ -98,46 +192,54 @@ void Logic::run(const bool& stop) noexcept
     mySerial.printf("Running the system!\n");
 
     //Print info about transmitting commands.
-    mySerial.printf("Please enter one of the following commands:\n");
-    mySerial.printf("- 't' to toggle the toggle timer\n");
-    mySerial.printf("- 'r' to read the temperature\n");
-    mySerial.printf("- 's' to check the state of the toggle timer\n\n");
+    (void) (helpCommand(*this, utils::Tokens{}));
+    mySerial.printf("\n");
 
     while (!stop) 
     { 
         // Regularly reset the watchdog to avoid system reset.
-        myWatchdog.reset();
+        kickWatchdog();
 
-        // Read serial port, execute recieved commands.
-        readSerialPort();
+        // Handle the pending event with the highest priority, sleep if no events are pending.
+        // Record each event in the crash record before handling it.
+        uint8_t event{};
+        if (myEvents.pop(event)) 
+        { 
+            if (nullptr != myResetCause) { myResetCause->recordEvent(event); }
+            handleEvent(static_cast<Event>(event)); 
+        }
+        else { myEvents.waitForEvent(myPowerManager); }
     }
 }
 
+// -----------------------------------------------------------------------------
+void Logic::postEvent(const Event event) noexcept 
+{ 
+    (void) (myEvents.post(static_cast<uint8_t>(event))); 
+}
+
 // -----------------------------------------------------------------------------
 void Logic::handleButtonEvent() noexcept
 {
-    // Ignore if this call was done manually.
-    if (myDebounceTimer.isEnabled()) { return; }
-    
-    // Disable interrupts on the I/O ports to mitigate effects of debouncing.
-    myToggleButton.enableInterruptOnPort(false);
-    myTempButton.enableInterruptOnPort(false);
-    myDebounceTimer.start();
+    // Ignore button activity during the debounce period, i.e. if this call was done manually.
+    // Without a debounce timer the buttons are debounced elsewhere, so no period is started.
+    if ((nullptr != myDebounceTimer) && !myStateMachine.dispatch(Input::ButtonActivity)) 
+    { 
+        return; 
+    }
 
     // Handle specific button event when pressed.
-    if (myToggleButton.read()) { handleToggleButtonPressed(); }
-    if (myTempButton.read()) { handleTempButtonPressed(); }
+    if (myToggleButton.read()) { (void) (myStateMachine.dispatch(Input::ToggleRequest)); }
+    if (myTempButton.read()) { (void) (myStateMachine.dispatch(Input::TempRequest)); }
 }
 
 // -----------------------------------------------------------------------------
 void Logic::handleDebounceTimerTimeout() noexcept
 {
     // Re-enable interrupts on the ports after debounce timer timeout.
-    if (myDebounceTimer.hasTimedOut())
-    {
-        myDebounceTimer.stop();
-        myToggleButton.enableInterruptOnPort(true);
-        myTempButton.enableInterruptOnPort(true);
+    if ((nullptr != myDebounceTimer) && myDebounceTimer->hasTimedOut()) 
+    { 
+        (void) (myStateMachine.dispatch(Input::DebounceTimeout)); 
     }
 }
 
@@ -145,14 +247,14 @@ void Logic::handleDebounceTimerTimeout() noexcept
 void Logic::handleToggleTimerTimeout() noexcept 
 {
     // Toggle the LED on toggle timer timeout. 
-    if (myToggleTimer.hasTimedOut()) { myLed.toggle(); }
+    if (myToggleTimer.hasTimedOut()) { (void) (myStateMachine.dispatch(Input::ToggleTimeout)); }
 }
 
 // -----------------------------------------------------------------------------
 void Logic::handleTempTimerTimeout() noexcept 
 { 
     // Read and print the temperature on temperature timer timeout.
-    if (myTempTimer.hasTimedOut()) { printTemperature(); }
+    if (myTempTimer.hasTimedOut()) { (void) (myStateMachine.dispatch(Input::TempTimeout)); }
 }
 
 // -----------------------------------------------------------------------------
@@ -177,29 +279,63 @@ void Logic::printTemperature() noexcept
 }
 
 // -----------------------------------------------------------------------------
-void Logic::handleToggleButtonPressed() noexcept
+void Logic::startDebounce(Logic& logic) noexcept
 {
-    // Toggle the toggle timer on pressdown, safe the current LED state in EEPROM.
-    myToggleTimer.toggle();
-    writeToggleStateToEeprom(myToggleTimer.isEnabled());
+    // Disable interrupts on the I/O ports to mitigate effects of debouncing.
+    logic.myToggleButton.enableInterruptOnPort(false);
+    logic.myTempButton.enableInterruptOnPort(false);
+    if (nullptr != logic.myDebounceTimer) { logic.myDebounceTimer->start(); }
+}
 
-    if (myToggleTimer.isEnabled()) { mySerial.printf("Toggle timer enabled!\n"); }
-    else
-    {
-        // Immediately disable the LED if the toggle timer is disabled to ensure that the LED
-        // isn't stuck in an enabled state.
-        mySerial.printf("Toggle timer disabled!\n");
-        myLed.write(false);
-    }
+// -----------------------------------------------------------------------------
+void Logic::endDebounce(Logic& logic) noexcept
+{
+    // Re-enable interrupts on the I/O ports after the debounce period.
+    if (nullptr != logic.myDebounceTimer) { logic.myDebounceTimer->stop(); }
+    logic.myToggleButton.enableInterruptOnPort(true);
+    logic.myTempButton.enableInterruptOnPort(true);
 }
 
 // -----------------------------------------------------------------------------
-void Logic::handleTempButtonPressed() noexcept
+void Logic::startToggle(Logic& logic) noexcept
 {
-    // Read and print the temperature on pressdown.
-    // Restart the temperature timer.
-    printTemperature();
-    myTempTimer.restart();
+    // Enable the toggle timer, save the toggle state in EEPROM.
+    logic.myToggleTimer.start();
+    logic.writeToggleStateToEeprom(true);
+    logic.mySerial.printf("Toggle timer enabled!\n");
+}
+
+// -----------------------------------------------------------------------------
+void Logic::stopToggle(Logic& logic) noexcept
+{
+    // Disable the toggle timer, save the toggle state in EEPROM.
+    logic.myToggleTimer.stop();
+    logic.writeToggleStateToEeprom(false);
+    logic.mySerial.printf("Toggle timer disabled!\n");
+
+    // Immediately disable the LED to ensure that the LED isn't stuck in an enabled state.
+    logic.myLed.write(false);
+}
+
+// -----------------------------------------------------------------------------
+void Logic::toggleLed(Logic& logic) noexcept { logic.myLed.toggle(); }
+
+// -----------------------------------------------------------------------------
+void Logic::readTemp(Logic& logic) noexcept
+{
+    // Read and print the temperature on request, restart the temperature timer.
+    logic.printTemperature();
+    logic.myTempTimer.restart();
+}
+
+// -----------------------------------------------------------------------------
+void Logic::printTemp(Logic& logic) noexcept { logic.printTemperature(); }
+
+// -----------------------------------------------------------------------------
+void Logic::printToggleState(Logic& logic) noexcept
+{
+    const char* state{logic.myToggleTimer.isEnabled() ? "enabled" : "disabled"};
+    logic.mySerial.printf("The toggle timer is %s!\n", state);
 }
 
 // -----------------------------------------------------------------------------
@@ -210,6 +346,7 @@ void Logic::restoreToggleStateFromEeprom() noexcept
     {
         myToggleTimer.start();
         mySerial.printf("Toggle timer enabled!\n");
+        myStateMachine.setState(State::Toggling);
     }
 }
 
@@ -217,16 +354,20 @@ void Logic::restoreToggleStateFromEeprom() noexcept
 bool Logic::readSerialPort() noexcept
 {
     // Buffer size (bytes).
-    constexpr uint16_t bufferSize{5U};
+    constexpr uint16_t bufferSize{8U};
 
-    // Read timeout in milliseconds.
-    constexpr uint16_t readTimeout_ms{100U};
+    // Read timeout in milliseconds, short since the data has already been received.
+    constexpr uint16_t readTimeout_ms{1U};
 
     // Read buffer (to recieve data as bytes)
     uint8_t buffer[bufferSize]{};
 
-    // Read the serial port, teminate the function on failure.
-    const int16_t bytesRead{mySerial.read(buffer, bufferSize, readTimeout_ms)};
+    // Read the serial port until all received data has been handled.
+    int16_t bytesRead{};
+    while (0 < (bytesRead = mySerial.read(buffer, bufferSize, readTimeout_ms)))
+    {
+        for (int16_t i{}; i < bytesRead; ++i) { handleReceivedChar(static_cast<char>(buffer[i])); }
+    }
 
     // Check the return valur, return false fi the operation failed.
     if (0 > bytesRead)
@@ -234,49 +375,281 @@ bool Logic::readSerialPort() noexcept
         mySerial.printf("Failed to recieve data from the serial port!\n");
         return false;
     }
-    
-    // Handle command if we recieve data.
-    if (0 < bytesRead)
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Logic::handleReceivedChar(const char character) noexcept
+{
+    // Execute the command at the end of the line, ignore empty lines.
+    if (('\r' == character) || ('\n' == character))
     {
-        // Extract the transmitted command.
-        const char cmd{static_cast<char>(buffer[0U])};
+        if (CommandLineSize == myCommandLength) 
+        { 
+            mySerial.printf("Command too long, max %u characters!\n", CommandLineSize - 1U); 
+        }
+        else if (0U < myCommandLength) { (void) (executeCommand()); }
+        myCommandLength = 0U;
+    }
+    // Store the character, discard the rest of the line if the buffer is full.
+    else if (CommandLineSize - 1U > myCommandLength) 
+    { 
+        myCommandLine[myCommandLength++] = character; 
+    }
+    else { myCommandLength = CommandLineSize; }
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::executeCommand() noexcept
+{
+    // Terminate the command line and execute the command.
+    myCommandLine[myCommandLength] = '\0';
+
+    switch (myCommandParser.execute(myCommandLine))
+    {
+        case utils::CommandResult::Success:
+        case utils::CommandResult::Empty:
+            return true;
+        case utils::CommandResult::UnknownCommand:
+            mySerial.printf("Unknown command, enter 'help' to list the available commands!\n");
+            return false;
+        case utils::CommandResult::InvalidArguments:
+            mySerial.printf("Invalid arguments, enter 'help' to list the available commands!\n");
+            return false;
+        default:
+            return false;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::kickWatchdog() noexcept
+{
+    // Let the supervisor reset the watchdog if all tasks are healthy, or reset it directly
+    // if the main loop isn't supervised.
+    if (0 <= myMainLoopTask)
+    {
+        mySupervisor->checkIn(static_cast<uint8_t>(myMainLoopTask));
+        (void) (mySupervisor->service());
+    }
+    else { myWatchdog.reset(); }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::handleEvent(const Event event) noexcept
+{
+    // The timers have already timed out when their events are handled, hence the timeout 
+    // flags aren't checked. Timer events are ignored in states where the timer is stopped.
+    switch (event)
+    {
+        case Event::Button:
+            handleButtonEvent();
+            break;
+        case Event::ToggleButton:
+            (void) (myStateMachine.dispatch(Input::ToggleRequest));
+            break;
+        case Event::TempButton:
+            (void) (myStateMachine.dispatch(Input::TempRequest));
+            break;
+        case Event::DebounceTimer:
+            (void) (myStateMachine.dispatch(Input::DebounceTimeout));
+            break;
+        case Event::ToggleTimer:
+            (void) (myStateMachine.dispatch(Input::ToggleTimeout));
+            break;
+        case Event::SerialReceive:
+            (void) (readSerialPort());
+            break;
+        case Event::TempTimer:
+            (void) (myStateMachine.dispatch(Input::TempTimeout));
+            break;
+        default:
+            break;
+    }
+}
 
-        // Handle recieved command.
-        switch (cmd)
+// -----------------------------------------------------------------------------
+void Logic::printPowerStatistics(Logic& logic) noexcept
+{
+    // Names of the power states, in the same order as the power state enumeration.
+    constexpr const char* stateNames[]{"active", "idle", "ADC noise reduction", 
+                                       "power-save", "power-down"};
+    static_assert(sizeof(stateNames) / sizeof(stateNames[0U]) 
+        == static_cast<uint8_t>(scheduler::PowerState::Count), "Power state names missing!");
+
+    const scheduler::PowerManager* powerManager{logic.myPowerManager};
+    driver::serial::Interface& serial{logic.mySerial};
+
+    if (nullptr == powerManager)
+    {
+        serial.printf("Power management is not used!\n");
+        return;
+    }
+
+    // Print the number of transitions to and the time spent in each power state.
+    serial.printf("Power statistics:\n");
+    for (uint8_t i{}; i < static_cast<uint8_t>(scheduler::PowerState::Count); ++i)
+    {
+        const auto state{static_cast<scheduler::PowerState>(i)};
+        const auto time_ms{powerManager->timeInState_us(state) / 1000U};
+        serial.printf("- %s: %lu times, %lu ms\n", stateNames[i], 
+                        static_cast<unsigned long>(powerManager->entryCount(state)),
+                        static_cast<unsigned long>(time_ms));
+    }
+}
+// -----------------------------------------------------------------------------
+bool Logic::dumpEepromCommand(Logic& logic, const utils::Tokens&) noexcept
+{
+    // Number of bytes to print per row.
+    constexpr uint8_t bytesPerRow{16U};
+
+    // Print the EEPROM contents row by row, reset the watchdog since printing takes time.
+    const uint16_t size{logic.myEeprom.size()};
+    for (uint16_t address{}; address < size; address += bytesPerRow)
+    {
+        logic.kickWatchdog();
+        logic.mySerial.printf("%04x:", address);
+
+        for (uint16_t i{address}; (i < address + bytesPerRow) && (i < size); ++i)
         {
-            // If we recieve command 't', toggle the toggle timer.
-            case 't':
-            {
-                // Command 't' works the same as pressing the toggle button.
-                handleToggleButtonPressed();
-                break;
-            }
-            
-            // If we recieved command 'r', read the temperature.
-            case 'r':
-            {
-                // Command 'r' works the same as pressing the temperature button.
-                handleTempButtonPressed();
-                break;
-            }
-            
-            // If we recived command 's', print the state of the toggle timer.
-            case 's':
-            {
-                const char* state{myToggleTimer.isEnabled() ? "enabled" : "disabled"};
-                mySerial.printf("The toggle timer is %s!\n", state);
-                break;
-            }
-            
-            // Print error message if an unknown command command was entered.
-            default:
-            {
-                mySerial.printf("Unknown command %c!\n", cmd);
-                return false;
-            }
+            uint8_t data{};
+            (void) (logic.myEeprom.read(i, data));
+            logic.mySerial.printf(" %02x", data);
         }
+        logic.mySerial.printf("\n");
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::helpCommand(Logic& logic, const utils::Tokens&) noexcept
+{
+    logic.mySerial.printf("Please enter one of the following commands:\n");
+
+    for (uint8_t i{}; i < logic.myCommandParser.commandCount(); ++i)
+    {
+        // Copy one command at a time from program memory.
+        CommandParser::Command command{};
+        if (!logic.myCommandParser.command(i, command)) { break; }
+        const char* separator{'\0' == command.args[0U] ? "" : " "};
+        logic.mySerial.printf("- '%s%s%s' to %s\n", command.name, separator, command.args, 
+                              command.description);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::memoryCommand(Logic& logic, const utils::Tokens&) noexcept
+{
+    driver::serial::Interface& serial{logic.mySerial};
+    serial.printf("Stack high-water mark: %u bytes\n", 
+                  static_cast<unsigned>(memory::stackHighWater()));
+    serial.printf("Free between heap and stack: %u bytes\n", 
+                  static_cast<unsigned>(memory::stackHeapGap()));
+
+    if (!memory::isHeapStatsEnabled())
+    {
+        serial.printf("Heap statistics are not enabled!\n");
+        return true;
+    }
+    const memory::HeapStats stats{memory::heapStats()};
+    serial.printf("Heap: %u bytes allocated, %u bytes peak, %lu allocations\n", 
+                  static_cast<unsigned>(stats.current), static_cast<unsigned>(stats.peak),
+                  static_cast<unsigned long>(stats.allocationCount));
+    serial.printf("Largest free block: %u bytes\n", 
+                  static_cast<unsigned>(stats.largestFreeBlock));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::powerCommand(Logic& logic, const utils::Tokens&) noexcept
+{
+    return logic.myStateMachine.dispatch(Input::PowerRequest);
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::readTempCommand(Logic& logic, const utils::Tokens&) noexcept
+{
+    // Command 'r' works the same as pressing the temperature button.
+    return logic.myStateMachine.dispatch(Input::TempRequest);
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::resetCommand(Logic& logic, const utils::Tokens&) noexcept
+{
+    // Names of the reset causes, in the same order as the reset cause enumeration.
+    constexpr const char* causeNames[]{"power-on", "brown-out", "watchdog", "external", 
+                                       "unknown"};
+    static_assert(sizeof(causeNames) / sizeof(causeNames[0U]) 
+        == static_cast<uint8_t>(driver::reset::Cause::Count), "Reset cause names missing!");
+
+    const driver::reset::Interface* resetCause{logic.myResetCause};
+    driver::serial::Interface& serial{logic.mySerial};
+
+    if (nullptr == resetCause)
+    {
+        serial.printf("Reset cause is not captured!\n");
+        return true;
+    }
+    serial.printf("Last reset cause: %s\n", 
+                  causeNames[static_cast<uint8_t>(resetCause->cause())]);
+
+    // Print the state of the system before the reset, if it survived the reset.
+    driver::reset::CrashRecord record{};
+    if (!resetCause->crashRecord(record)) 
+    { 
+        serial.printf("No crash record available!\n"); 
+        return true;
+    }
+    serial.printf("- last event: %u\n", record.lastEvent);
+    serial.printf("- program counter: 0x%04x (word address)\n", record.programCounter);
+    serial.printf("- stack high-water mark: %u bytes\n", record.stackHighWater);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::stateCommand(Logic& logic, const utils::Tokens&) noexcept
+{
+    return logic.myStateMachine.dispatch(Input::StateRequest);
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::setToggleCommand(Logic& logic, const utils::Tokens& args) noexcept
+{
+    uint32_t interval_ms{};
+
+    // Check the interval, print an error message if invalid.
+    if (!args.toUint32(0U, interval_ms) || (0U == interval_ms))
+    {
+        logic.mySerial.printf("Invalid toggle timer interval %s!\n", args[0U]);
+        return false;
+    }
+    logic.myToggleTimer.setTimeout_ms(interval_ms);
+    logic.mySerial.printf("Toggle timer interval set to %lu ms!\n", 
+                          static_cast<unsigned long>(interval_ms));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::toggleCommand(Logic& logic, const utils::Tokens&) noexcept
+{
+    // Command 't' works the same as pressing the toggle button.
+    return logic.myStateMachine.dispatch(Input::ToggleRequest);
+}
+
+// -----------------------------------------------------------------------------
+bool Logic::tempIntervalCommand(Logic& logic, const utils::Tokens& args) noexcept
+{
+    uint32_t interval_ms{};
+
+    // Check the interval, print an error message if invalid.
+    if (!args.toUint32(0U, interval_ms) || (0U == interval_ms))
+    {
+        logic.mySerial.printf("Invalid temperature timer interval %s!\n", args[0U]);
+        return false;
     }
-    // Return true to indicate success.
+    logic.myTempTimer.setTimeout_ms(interval_ms);
+    logic.mySerial.printf("Temperature timer interval set to %lu ms!\n", 
+                          static_cast<unsigned long>(interval_ms));
     return true;
 }
 } // namespace logic
\ No newline at end of file
@@ -6,23 +6,43 @@
  *            - A button to read the surrounding temperature.
  *            - A blink timer to toggle an LED when enabled.
  *            - A temperature timer to print the temperature on timeout.
- *            - A debounce timer to reduce the effect of contact bounces after pushing the buttons.
+ *            - A debounced input service sampling both buttons from a shared software timer, 
+ *              filtering out contact bounces per button.
  *            - A serial device to print serial data via UART.
- *            - A watchdog timer to restart the program if it gets stuck somewhere.
+ *            - A watchdog timer to restart the program if it gets stuck somewhere, supervised 
+ *              per task so that a stalled main loop or debounce tick leads to a restart. The
+ *              overdue task and the uptime are stored in EEPROM and printed on the next startup.
+ *            - Memory instrumentation measuring the stack and heap usage (print it with the
+ *              "mem" command).
+ *            - A reset cause driver capturing the cause of the last reset at early boot, along
+ *              with a crash record surviving warm resets (print it with the "reset" command).
  *            - An EEPROM stream to store the LED state. On startup, this value is read; if the
  *              last stored state before power down was "on," the LED will automatically blink.
+ *              The trained temperature model is stored as well, so it's only trained once.
  *            - A temperature sensor to read the surrounding temperature.
+ * 
+ *        The callbacks only post events, which are handled in main context by the logic. 
+ *        The CPU sleeps in the deepest safe sleep mode whenever no events are pending, the time
+ *        spent in each power state can be printed via the serial port.
  */
 #include "driver/adc/atmega328p.h"
 #include "driver/eeprom/atmega328p.h"
 #include "driver/gpio/atmega328p.h"
+#include "driver/gpio/debouncer.h"
+#include "driver/gpio/pin.h"
+#include "driver/reset/atmega328p.h"
 #include "driver/serial/atmega328p.h"
 #include "driver/tempsensor/smart.h"
-#include "driver/timer/atmega328p.h"
+#include "driver/timer/software.h"
+#include "driver/timer/system_time.h"
+#include "driver/timer/wheel.h"
 #include "driver/watchdog/atmega328p.h"
 #include "logic/logic.h"
+#include "memory/instrumentation.h"
 #include "ml/lin_reg/fixed.h"
 #include "ml/types.h"
+#include "scheduler/power_manager.h"
+#include "scheduler/supervisor.h"
 
 using namespace driver;
 
@@ -31,51 +51,94 @@ namespace
 /** Pointer to the logic implementation. */
 logic::Interface* myLogic{nullptr};
 
+/** Pointer to the debounced input service sampling the buttons. */
+gpio::Debouncer* myDebouncer{nullptr};
+
+/** Index of the toggle button in the debounced input service (-1 if not registered). */
+int8_t myToggleButtonInput{-1};
+
+/** Index of the temperature button in the debounced input service (-1 if not registered). */
+int8_t myTempButtonInput{-1};
+
+/** Pointer to the watchdog supervisor. */
+scheduler::Supervisor* mySupervisor{nullptr};
+
+/** ID of the debounce tick in the watchdog supervisor (-1 if not supervised). */
+int8_t myDebounceTickTask{-1};
+
 namespace callback
 {
 /**
  * @brief Callback for the buttons.
  * 
- *        This callback is invoked when a button event occurs.
+ *        This callback is invoked by the debounced input service when a button event occurs.
+ *        Only presses are posted, so releasing a button doesn't wake up the logic.
+ * 
+ * @param[in] input The index of the button in the debounced input service.
+ * @param[in] event The button event.
  */
-void button() noexcept { myLogic->handleButtonEvent(); }
+void button(const uint8_t input, const gpio::InputEvent event) noexcept 
+{ 
+    if (gpio::InputEvent::Press != event) { return; }
+    if (myToggleButtonInput == static_cast<int8_t>(input)) 
+    { 
+        myLogic->postEvent(logic::Event::ToggleButton); 
+    }
+    else if (myTempButtonInput == static_cast<int8_t>(input)) 
+    { 
+        myLogic->postEvent(logic::Event::TempButton); 
+    }
+}
 
 /**
- * @brief Callback for the debounce timer.
+ * @brief Callback for the debounce tick timer.
  * 
- *        This callback is invoked when the debounce timer times out.
+ *        This callback is invoked periodically to sample the buttons.
  */
-void debounceTimer() noexcept { myLogic->handleDebounceTimerTimeout(); }
+void debounceTick() noexcept 
+{ 
+    myDebouncer->tick(); 
+    if (0 <= myDebounceTickTask) 
+    { 
+        mySupervisor->checkIn(static_cast<uint8_t>(myDebounceTickTask)); 
+    }
+}
 
 /**
  * @brief Callback for the toggle timer.
  * 
  *        This callback is invoked when the toggle timer times out.
  */
-void toggleTimer() noexcept { myLogic->handleToggleTimerTimeout(); }
+void toggleTimer() noexcept { myLogic->postEvent(logic::Event::ToggleTimer); }
 
 /**
  * @brief Callback for the temperature timer.
  * 
  *        This callback is invoked when the temperature timer times out.
  */
-void tempTimer() noexcept { myLogic->handleTempTimerTimeout(); }
+void tempTimer() noexcept { myLogic->postEvent(logic::Event::TempTimer); }
+
+/**
+ * @brief Callback for the serial device.
+ * 
+ *        This callback is invoked when serial data is received.
+ */
+void serialReceive() noexcept { myLogic->postEvent(logic::Event::SerialReceive); }
 
 } // namespace callback
 
 /**
  * @brief Train fixed linear regression model to predict temperature based on the input voltage.
  * 
+ *        The closed-form least-squares solution is used, which only requires a single pass 
+ *        over the training data.
+ * 
  * @param[in] model The model to train.
  * 
  * @return True on success, false on failure.
  */
 bool trainModel(ml::lin_reg::Fixed& model) noexcept
 {
-    // Training parameters.
-    constexpr size_t epochCount{100U};
-    constexpr double learningRate{0.01};
-
     // Training data to teach the model to predict T = 100 * Uin - 50.
     const ml::Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 
                                0.5, 0.6, 0.7, 0.8, 0.9, 
@@ -85,7 +148,7 @@ bool trainModel(ml::lin_reg::Fixed& model) noexcept
                                 60.0, 70.0, 80.0, 90.0, 100.0};
 
     // Train the model, return the result.
-    return model.train(trainIn, trainOut, epochCount, learningRate);
+    return model.trainClosedForm(trainIn, trainOut);
 }
 } // namespace
 
@@ -96,6 +159,9 @@ bool trainModel(ml::lin_reg::Fixed& model) noexcept
  */
 int main()
 {
+    // Track heap allocations from the start, so every block is counted.
+    memory::setHeapStatsEnabled(true);
+
     // Set pin numbers.
     constexpr uint8_t tempSensorPin{2U};
     constexpr uint8_t ledPin{5U};
@@ -103,27 +169,53 @@ int main()
     constexpr uint8_t tempButtonPin{7U};
 
     // Set timeouts.
-    constexpr uint32_t debounceTimerTimeout{300U};
+    constexpr uint32_t debounceTickTimeout{10U};
     constexpr uint32_t toggleTimerTimeout{100U};
     constexpr uint32_t tempTimerTimeout{60000U};
+    constexpr uint32_t debounceTickDeadline{100U};
+
+    // Set the start address of the EEPROM region reserved for the temperature model
+    // (the toggle state is stored at address 0).
+    constexpr uint16_t modelEepromAddr{16U};
+
+    // Set the address of the failure record stored on watchdog timeout.
+    constexpr uint16_t failureRecordAddr{8U};
 
     constexpr auto input{gpio::Direction::InputPullup};
     constexpr auto output{gpio::Direction::Output};
 
     // Initialize the GPIO devices.
-    gpio::Atmega328p led{ledPin, output};
-    gpio::Atmega328p toggleButton{toggleButtonPin, input, callback::button};
-    gpio::Atmega328p tempButton{tempButtonPin, input, callback::button};
+    // Bind the LED at compile time, adapt it to the GPIO interface used by the logic.
+    gpio::Pin<ledPin, output> ledOutput{};
+    gpio::PinAdapter<decltype(ledOutput)> led{ledOutput};
+    gpio::Atmega328p toggleButton{toggleButtonPin, input};
+    gpio::Atmega328p tempButton{tempButtonPin, input};
+
+    // Debounce the buttons by sampling them from a shared tick, so simultaneous presses
+    // aren't lost.
+    gpio::Debouncer debouncer{callback::button};
+    myToggleButtonInput = debouncer.add(toggleButton);
+    myTempButtonInput   = debouncer.add(tempButton);
+    myDebouncer = &debouncer;
+
+    // Initialize the timers, use software timers sharing a single hardware timer circuit.
+    timer::Wheel timerWheel{};
+    timer::Software debounceTick{timerWheel, debounceTickTimeout, callback::debounceTick};
+    timer::Software toggleTimer{timerWheel, toggleTimerTimeout, callback::toggleTimer};
+    timer::Software tempTimer{timerWheel, tempTimerTimeout, callback::tempTimer};
 
-    // Initialize the timers.
-    timer::Atmega328p debounceTimer{debounceTimerTimeout, callback::debounceTimer};
-    timer::Atmega328p toggleTimer{toggleTimerTimeout, callback::toggleTimer};
-    timer::Atmega328p tempTimer{tempTimerTimeout, callback::tempTimer};
+    // Keep track of the uptime in tickless mode to measure the time spent in each power state
+    // without waking up the CPU more often than necessary.
+    timer::SystemTime systemTime{timer::Atmega328p::Mode::Tickless};
+    scheduler::PowerManager powerManager{&systemTime};
 
     // Obtain a reference to the singleton serial device instance.
     auto& serial{serial::Atmega328p::getInstance()};
     serial.setEnabled(true);
 
+    // Obtain a reference to the singleton reset cause driver instance.
+    auto& resetCause{reset::Atmega328p::getInstance()};
+
     // Obtain a reference to the singleton watchdog timer instance.
     auto& watchdog{watchdog::Atmega328p::getInstance()};
 
@@ -135,14 +227,37 @@ int main()
 
 
     ml::lin_reg::Fixed linReg{};
-    
-    //!       Train the model and print the result. 
-    if (trainModel(linReg))
+
+    // Load the model stored in EEPROM, only retrain (and store the result) if it's missing.
+    eeprom.setEnabled(true);
+    if (linReg.load(eeprom, modelEepromAddr))
+    {
+        serial.printf("Temperature prediction model loaded from EEPROM!\n");
+    }
+    else if (trainModel(linReg))
     {
         serial.printf("Temperature prediction training succeded!\n");
+        if (!linReg.save(eeprom, modelEepromAddr))
+        {
+            serial.printf("Failed to store the temperature prediction model in EEPROM!\n");
+        }
     }
     else { serial.printf("Temperature prediction training failed!\n"); }
 
+    // Supervise the main loop and the debounce tick, print the failure record of the last
+    // watchdog timeout (if any) before clearing it.
+    scheduler::Supervisor supervisor{watchdog, systemTime, &eeprom, failureRecordAddr};
+    uint8_t failedTask{};
+    uint32_t failureUptime_ms{};
+    if (supervisor.readRecord(failedTask, failureUptime_ms))
+    {
+        serial.printf("Restarted by watchdog: task %u overdue after %lu ms!\n", 
+                      failedTask, static_cast<unsigned long>(failureUptime_ms));
+        supervisor.clearRecord();
+    }
+    myDebounceTickTask = supervisor.addTask(debounceTickDeadline);
+    mySupervisor       = &supervisor;
+
     // tempsensor::Smart tempSensor{tempSensorPin, adc, linReg};
     tempsensor::Smart tempSensor{tempSensorPin, adc, linReg};
 
@@ -151,14 +266,19 @@ int main()
     logic::Logic logic{led, 
                        toggleButton, 
                        tempButton, 
-                       debounceTimer, 
+                       nullptr, 
                        toggleTimer, 
                        tempTimer,
                        serial, 
                        watchdog, 
                        eeprom, 
-                       tempSensor};
+                       tempSensor,
+                       &powerManager,
+                       &supervisor,
+                       &resetCause};
     myLogic = &logic;
+    debounceTick.start();
+    serial.setReceiveCallback(callback::serialReceive);
 
     // Run the application on the target MCU.
     const bool stop{false};
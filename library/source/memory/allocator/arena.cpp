@@ -0,0 +1,93 @@
+/**
+ * @brief Implementation details of the arena allocator.
+ */
+#include "memory/allocator/arena.h"
+
+namespace memory
+{
+namespace allocator
+{
+// -----------------------------------------------------------------------------
+Arena::Arena(uint8_t* buffer, const size_t size) noexcept
+    : myBuffer{buffer}
+    , myCapacity{nullptr != buffer ? size : 0U}
+    , myUsed{}
+    , myLastBlock{}
+{}
+
+// -----------------------------------------------------------------------------
+void* Arena::allocate(const size_t size) noexcept
+{
+    // Align the block by padding the current position.
+    const uintptr_t address{reinterpret_cast<uintptr_t>(myBuffer + myUsed)};
+    const size_t padding{(Alignment - (address % Alignment)) % Alignment};
+    if ((0U == size) || (myCapacity - myUsed < padding)
+        || (myCapacity - myUsed - padding < size))
+    {
+        return nullptr;
+    }
+    myLastBlock = myUsed + padding;
+    myUsed      = myLastBlock + size;
+    return myBuffer + myLastBlock;
+}
+
+// -----------------------------------------------------------------------------
+void* Arena::reallocate(void* block, const size_t newSize) noexcept
+{
+    if (nullptr == block) { return allocate(newSize); }
+    if (0U == newSize)
+    {
+        deallocate(block);
+        return nullptr;
+    }
+    const size_t offset{static_cast<size_t>(static_cast<uint8_t*>(block) - myBuffer)};
+
+    // Resize the last block in place.
+    if ((offset == myLastBlock) && (myLastBlock < myUsed))
+    {
+        if (myCapacity - offset < newSize) { return nullptr; }
+        myUsed = offset + newSize;
+        return block;
+    }
+
+    // Copy any other block to a new block. The old size is unknown, but the block ends before
+    // the current position, so copying up to the current position is safe.
+    const size_t maxOldSize{myUsed - offset};
+    auto newBlock{static_cast<uint8_t*>(allocate(newSize))};
+    if (nullptr == newBlock) { return nullptr; }
+    const size_t copySize{newSize < maxOldSize ? newSize : maxOldSize};
+    for (size_t i{}; i < copySize; ++i) { newBlock[i] = static_cast<uint8_t*>(block)[i]; }
+    return newBlock;
+}
+
+// -----------------------------------------------------------------------------
+void Arena::deallocate(void* block) noexcept
+{
+    // Only reclaim the last block, the block before it is unknown afterwards.
+    if ((nullptr != block) && (myLastBlock < myUsed) && (myBuffer + myLastBlock == block))
+    {
+        myUsed = myLastBlock;
+    }
+}
+
+// -----------------------------------------------------------------------------
+size_t Arena::capacity() const noexcept { return myCapacity; }
+
+// -----------------------------------------------------------------------------
+size_t Arena::used() const noexcept { return myUsed; }
+
+// -----------------------------------------------------------------------------
+Arena::Marker Arena::mark() const noexcept { return myUsed; }
+
+// -----------------------------------------------------------------------------
+void Arena::release(const Marker marker) noexcept
+{
+    if (marker > myUsed) { return; }
+    myUsed      = marker;
+    myLastBlock = myUsed;
+}
+
+// -----------------------------------------------------------------------------
+void Arena::reset() noexcept { release(0U); }
+} // namespace allocator
+} // namespace memory
@@ -0,0 +1,144 @@
+/**
+ * @brief Implementation details of the pool allocator.
+ */
+#include "memory/allocator/pool.h"
+#include "utils/utils.h"
+
+namespace memory
+{
+namespace allocator
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+constexpr size_t alignedBlockSize(const size_t blockSize) noexcept
+{
+    // Each free block holds a pointer to the next free block.
+    const size_t size{blockSize < sizeof(void*) ? sizeof(void*) : blockSize};
+    return (size + Alignment - 1U) / Alignment * Alignment;
+}
+
+// -----------------------------------------------------------------------------
+size_t alignmentPadding(const uint8_t* buffer) noexcept
+{
+    const uintptr_t address{reinterpret_cast<uintptr_t>(buffer)};
+    return (Alignment - (address % Alignment)) % Alignment;
+}
+
+// -----------------------------------------------------------------------------
+constexpr size_t freeMapSize(const size_t blockCount) noexcept
+{
+    // One bit is used per block.
+    return (blockCount + 7U) / 8U;
+}
+
+// -----------------------------------------------------------------------------
+size_t maxBlockCount(const size_t size, const size_t blockSize) noexcept
+{
+    // Estimate the count including one bit per block, round down if the map doesn't fit.
+    size_t blockCount{size * 8U / (blockSize * 8U + 1U)};
+    while ((0U < blockCount) && (blockCount * blockSize + freeMapSize(blockCount) > size)) 
+    { 
+        --blockCount; 
+    }
+    return blockCount;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Pool::Pool(uint8_t* buffer, const size_t bufferSize, const size_t blockSize) noexcept
+    : myBlocks{nullptr}
+    , myFreeMap{nullptr}
+    , myFreeList{nullptr}
+    , myBlockSize{alignedBlockSize(blockSize)}
+    , myBlockCount{}
+    , myFreeCount{}
+{
+    const size_t padding{alignmentPadding(buffer)};
+    if ((nullptr == buffer) || (0U == blockSize) || (bufferSize <= padding)) { return; }
+    myBlocks     = buffer + padding;
+    myBlockCount = maxBlockCount(bufferSize - padding, myBlockSize);
+
+    // Place the map of free blocks after the blocks, mark all blocks as free.
+    myFreeMap = myBlocks + myBlockCount * myBlockSize;
+    for (size_t i{}; i < freeMapSize(myBlockCount); ++i) { myFreeMap[i] = 0xFFU; }
+
+    // Link all blocks into the free list, starting with the first block.
+    for (size_t i{myBlockCount}; 0U < i; --i)
+    {
+        void* block{myBlocks + (i - 1U) * myBlockSize};
+        *static_cast<void**>(block) = myFreeList;
+        myFreeList                  = block;
+    }
+    myFreeCount = myBlockCount;
+}
+
+// -----------------------------------------------------------------------------
+void* Pool::allocate(const size_t size) noexcept
+{
+    if ((0U == size) || (myBlockSize < size) || (nullptr == myFreeList)) { return nullptr; }
+    void* block{myFreeList};
+    myFreeList = *static_cast<void**>(block);
+    myFreeCount--;
+
+    const size_t index{blockIndex(block)};
+    utils::clear(myFreeMap[index / 8U], static_cast<uint8_t>(index % 8U));
+    return block;
+}
+
+// -----------------------------------------------------------------------------
+void* Pool::reallocate(void* block, const size_t newSize) noexcept
+{
+    if (nullptr == block) { return allocate(newSize); }
+    if (0U == newSize)
+    {
+        deallocate(block);
+        return nullptr;
+    }
+    return newSize <= myBlockSize ? block : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+void Pool::deallocate(void* block) noexcept
+{
+    if (!owns(block)) { return; }
+
+    // Ignore blocks already freed, since linking them again would corrupt the free list.
+    const size_t index{blockIndex(block)};
+    uint8_t& freeBits{myFreeMap[index / 8U]};
+    if (utils::read(freeBits, static_cast<uint8_t>(index % 8U))) { return; }
+    utils::set(freeBits, static_cast<uint8_t>(index % 8U));
+
+    *static_cast<void**>(block) = myFreeList;
+    myFreeList                  = block;
+    myFreeCount++;
+}
+
+// -----------------------------------------------------------------------------
+bool Pool::owns(const void* block) const noexcept
+{
+    const uint8_t* byte{static_cast<const uint8_t*>(block)};
+    if ((nullptr == byte) || (nullptr == myBlocks) || (byte < myBlocks)
+        || (byte >= myBlocks + myBlockCount * myBlockSize))
+    {
+        return false;
+    }
+    return 0U == static_cast<size_t>(byte - myBlocks) % myBlockSize;
+}
+
+// -----------------------------------------------------------------------------
+size_t Pool::blockSize() const noexcept { return myBlockSize; }
+
+// -----------------------------------------------------------------------------
+size_t Pool::blockIndex(const void* block) const noexcept
+{
+    return static_cast<size_t>(static_cast<const uint8_t*>(block) - myBlocks) / myBlockSize;
+}
+
+// -----------------------------------------------------------------------------
+size_t Pool::blockCount() const noexcept { return myBlockCount; }
+
+// -----------------------------------------------------------------------------
+size_t Pool::freeCount() const noexcept { return myFreeCount; }
+} // namespace allocator
+} // namespace memory
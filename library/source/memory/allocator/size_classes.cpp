@@ -0,0 +1,88 @@
+/**
+ * @brief Implementation details of the size-class allocator.
+ */
+#include "memory/allocator/pool.h"
+#include "memory/allocator/size_classes.h"
+
+namespace memory
+{
+namespace allocator
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+uint8_t validPoolCount(Pool* const* pools, const uint8_t poolCount) noexcept
+{
+    if (nullptr == pools) { return 0U; }
+
+    // The pools must be sorted by ascending block size, else small blocks may be allocated
+    // from pools with larger blocks while a better fitting pool has free blocks.
+    for (uint8_t i{}; i < poolCount; ++i)
+    {
+        if ((nullptr == pools[i]) 
+            || ((0U < i) && (pools[i]->blockSize() <= pools[i - 1U]->blockSize())))
+        {
+            return 0U;
+        }
+    }
+    return poolCount;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+SizeClasses::SizeClasses(Pool* const* pools, const uint8_t poolCount) noexcept
+    : myPools{pools}
+    , myPoolCount{validPoolCount(pools, poolCount)}
+{}
+
+// -----------------------------------------------------------------------------
+void* SizeClasses::allocate(const size_t size) noexcept
+{
+    // Use the smallest block that fits, the pools reject sizes exceeding their block size.
+    for (uint8_t i{}; i < myPoolCount; ++i)
+    {
+        void* block{myPools[i]->allocate(size)};
+        if (nullptr != block) { return block; }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+void* SizeClasses::reallocate(void* block, const size_t newSize) noexcept
+{
+    if (nullptr == block) { return allocate(newSize); }
+    Pool* pool{owner(block)};
+    if (nullptr == pool) { return nullptr; }
+    if (0U == newSize)
+    {
+        pool->deallocate(block);
+        return nullptr;
+    }
+    if (newSize <= pool->blockSize()) { return block; }
+
+    // Move the block to a pool with larger blocks.
+    auto newBlock{static_cast<uint8_t*>(allocate(newSize))};
+    if (nullptr == newBlock) { return nullptr; }
+    for (size_t i{}; i < pool->blockSize(); ++i) { newBlock[i] = static_cast<uint8_t*>(block)[i]; }
+    pool->deallocate(block);
+    return newBlock;
+}
+
+// -----------------------------------------------------------------------------
+void SizeClasses::deallocate(void* block) noexcept
+{
+    Pool* pool{owner(block)};
+    if (nullptr != pool) { pool->deallocate(block); }
+}
+
+// -----------------------------------------------------------------------------
+Pool* SizeClasses::owner(const void* block) const noexcept
+{
+    for (uint8_t i{}; i < myPoolCount; ++i)
+    {
+        if (myPools[i]->owns(block)) { return myPools[i]; }
+    }
+    return nullptr;
+}
+} // namespace allocator
+} // namespace memory
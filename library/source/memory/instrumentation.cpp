@@ -0,0 +1,192 @@
+/**
+ * @brief Implementation details of the memory instrumentation.
+ */
+#include "arch/avr/hw_platform.h"
+#include "memory/instrumentation.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+#include <malloc.h>
+#else
+extern "C"
+{
+/** The start of the heap, defined by the linker. */
+extern uint8_t __heap_start;
+
+/** The current top of the heap, or nullptr before the first allocation (avr-libc). */
+extern char* __brkval;
+
+/** The min number of bytes kept free between the heap and the stack (avr-libc). */
+extern size_t __malloc_margin;
+
+/** Structure of a free heap chunk (avr-libc). */
+struct __freelist
+{
+    /** The size of the chunk in bytes, excluding the size field. */
+    size_t sz;
+
+    /** Pointer to the next free chunk. */
+    __freelist* nx;
+};
+
+/** The list of free heap chunks (avr-libc). */
+extern __freelist* __flp;
+}
+#endif /** TESTSUITE */
+
+namespace memory
+{
+namespace
+{
+/** The heap statistics. */
+HeapStats myHeapStats{};
+
+// -----------------------------------------------------------------------------
+size_t blockSize(const void* block) noexcept
+{
+#ifndef TESTSUITE
+    // The usable size of each block is stored right before the block by avr-libc.
+    return static_cast<const size_t*>(block)[-1];
+#else
+    return malloc_usable_size(const_cast<void*>(block));
+#endif /** TESTSUITE */
+}
+
+// -----------------------------------------------------------------------------
+void recordReallocation(const void* block) noexcept
+{
+    myHeapStats.current += blockSize(block);
+    if (myHeapStats.current > myHeapStats.peak) { myHeapStats.peak = myHeapStats.current; }
+}
+
+// -----------------------------------------------------------------------------
+void recordAllocation(const void* block) noexcept
+{
+    recordReallocation(block);
+    myHeapStats.allocationCount++;
+}
+
+// -----------------------------------------------------------------------------
+void recordDeallocation(const void* block) noexcept
+{
+    // Ignore blocks allocated before the statistics were enabled.
+    const size_t size{blockSize(block)};
+    myHeapStats.current = size < myHeapStats.current ? myHeapStats.current - size : 0U;
+}
+
+/** Hooks gathering the heap statistics. */
+constexpr utils::MemoryHooks HeapStatsHooks{recordAllocation, recordDeallocation, 
+                                            recordReallocation};
+
+#ifndef TESTSUITE
+// -----------------------------------------------------------------------------
+const uint8_t* heapTop() noexcept
+{
+    return nullptr != __brkval ? reinterpret_cast<const uint8_t*>(__brkval) : &__heap_start;
+}
+
+// -----------------------------------------------------------------------------
+size_t largestFreeBlock() noexcept
+{
+    size_t largest{};
+
+    // Check the free chunks left by deallocated blocks.
+    for (const __freelist* chunk{__flp}; nullptr != chunk; chunk = chunk->nx)
+    {
+        if (chunk->sz > largest) { largest = chunk->sz; }
+    }
+
+    // Check the memory between the heap and the stack, minus the margin kept for the stack
+    // and the size field of the block.
+    const size_t gap{stackHeapGap()};
+    const size_t reserved{__malloc_margin + sizeof(size_t)};
+    if ((gap > reserved) && (gap - reserved > largest)) { largest = gap - reserved; }
+    return largest;
+}
+
+// -----------------------------------------------------------------------------
+// Paint the memory between the end of the static data and the end of the RAM at early boot,
+// before the stack is used. Only registers are used, since the stack isn't set up yet.
+void paintAtBoot() noexcept __attribute__((naked, used, section(".init1")));
+void paintAtBoot() noexcept
+{
+    asm volatile(
+        "ldi  r30, lo8(__heap_start) \n\t"
+        "ldi  r31, hi8(__heap_start) \n\t"
+        "ldi  r24, %0                \n\t"
+        "ldi  r25, hi8(%1)           \n\t"
+        "1:                          \n\t"
+        "st   Z+, r24                \n\t"
+        "cpi  r30, lo8(%1)           \n\t"
+        "cpc  r31, r25               \n\t"
+        "brlo 1b                     \n\t"
+        "breq 1b                     \n\t"
+        :: "M"(StackPaint), "i"(RAMEND));
+}
+#else
+// -----------------------------------------------------------------------------
+size_t largestFreeBlock() noexcept { return 0U; }
+#endif /** TESTSUITE */
+} // namespace
+
+// -----------------------------------------------------------------------------
+void setHeapStatsEnabled(const bool enable) noexcept
+{
+    utils::setMemoryHooks(enable ? &HeapStatsHooks : nullptr);
+}
+
+// -----------------------------------------------------------------------------
+bool isHeapStatsEnabled() noexcept { return &HeapStatsHooks == utils::memoryHooks(); }
+
+// -----------------------------------------------------------------------------
+HeapStats heapStats() noexcept
+{
+    HeapStats stats{myHeapStats};
+    stats.largestFreeBlock = largestFreeBlock();
+    return stats;
+}
+
+// -----------------------------------------------------------------------------
+void resetHeapStats() noexcept
+{
+    myHeapStats.peak            = myHeapStats.current;
+    myHeapStats.allocationCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+void paintStack(uint8_t* begin, const uint8_t* end) noexcept
+{
+    for (uint8_t* byte{begin}; byte < end; ++byte) { *byte = StackPaint; }
+}
+
+// -----------------------------------------------------------------------------
+size_t stackHighWater(const uint8_t* begin, const uint8_t* end) noexcept
+{
+    // Count the bytes still holding the stack paint, starting from the far end of the stack.
+    const uint8_t* byte{begin};
+    while ((byte < end) && (StackPaint == *byte)) { ++byte; }
+    return static_cast<size_t>(end - byte);
+}
+
+#ifndef TESTSUITE
+// -----------------------------------------------------------------------------
+size_t stackHighWater() noexcept
+{
+    return stackHighWater(heapTop(), reinterpret_cast<const uint8_t*>(RAMEND + 1U));
+}
+
+// -----------------------------------------------------------------------------
+size_t stackHeapGap() noexcept
+{
+    const uint8_t* stackPointer{reinterpret_cast<const uint8_t*>(SP)};
+    const uint8_t* top{heapTop()};
+    return stackPointer > top ? static_cast<size_t>(stackPointer - top) : 0U;
+}
+#else
+// -----------------------------------------------------------------------------
+size_t stackHighWater() noexcept { return 0U; }
+
+// -----------------------------------------------------------------------------
+size_t stackHeapGap() noexcept { return 0U; }
+#endif /** TESTSUITE */
+} // namespace memory
@@ -1,8 +1,14 @@
 /**
  * @brief Fixed linear regression implementation details.
  */
+#include "driver/eeprom/interface.h"
 #include "ml/lin_reg/fixed.h"
 #include "ml/types.h"
+#include "utils/utils.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 namespace ml
 {
@@ -21,12 +27,177 @@ constexpr bool isLearningRateValid(const double learningRate) noexcept
 {
     return (0.0 < learningRate) && (1.0 >= learningRate);
 }
+
+/**
+ * @brief Structure of parameters for storing the model in EEPROM.
+ */
+struct StorageParam
+{
+    /** Format version, update when the layout below is changed. */
+    static constexpr uint8_t Version{1U};
+
+    /** Offset of the weight. */
+    static constexpr uint16_t WeightOffset{1U};
+
+    /** Offset of the bias. */
+    static constexpr uint16_t BiasOffset{WeightOffset + sizeof(double)};
+
+    /** Offset of the checksum, which covers all preceding bytes. */
+    static constexpr uint16_t ChecksumOffset{BiasOffset + sizeof(double)};
+};
+
+/**
+ * @brief Structure of parameters for the prior seeded from the current model parameters.
+ */
+struct PriorParam
+{
+    /** Sample weight of the prior, i.e. the number of pseudo-samples it corresponds to. */
+    static constexpr double SampleWeight{8.0};
+
+    /** Input variance of the prior pseudo-samples. */
+    static constexpr double InputVariance{1.0};
+};
+
+// Generate a compiler error if the storage size doesn't match the layout.
+static_assert(Fixed::StorageSize == StorageParam::ChecksumOffset + sizeof(uint16_t), 
+    "Invalid storage size of the linear regression model!");
+
+// -----------------------------------------------------------------------------
+void storeBytes(uint8_t* destination, const void* source, const uint16_t size) noexcept
+{
+    const uint8_t* bytes{static_cast<const uint8_t*>(source)};
+    for (uint16_t i{}; i < size; ++i) { destination[i] = bytes[i]; }
+}
+
+// -----------------------------------------------------------------------------
+constexpr bool isForgettingFactorValid(const double forgettingFactor) noexcept
+{
+    return (0.0 < forgettingFactor) && (1.0 >= forgettingFactor);
+}
+
+#if defined(__AVX2__)
+/** Four doubles processed at once in an AVX register. */
+using Pack = __m256d;
+constexpr size_t PackSize{4U};
+
+inline Pack load(const double* data) noexcept { return _mm256_loadu_pd(data); }
+inline void store(double* data, const Pack pack) noexcept { _mm256_storeu_pd(data, pack); }
+inline Pack broadcast(const double value) noexcept { return _mm256_set1_pd(value); }
+inline Pack add(const Pack x, const Pack y) noexcept { return _mm256_add_pd(x, y); }
+inline Pack subtract(const Pack x, const Pack y) noexcept { return _mm256_sub_pd(x, y); }
+inline Pack multiply(const Pack x, const Pack y) noexcept { return _mm256_mul_pd(x, y); }
+
+inline double sumElements(const Pack pack) noexcept
+{
+    const __m128d half{_mm_add_pd(_mm256_castpd256_pd128(pack), _mm256_extractf128_pd(pack, 1))};
+    return _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+}
+
+#elif defined(__SSE2__)
+/** Two doubles processed at once in an SSE register. */
+using Pack = __m128d;
+constexpr size_t PackSize{2U};
+
+inline Pack load(const double* data) noexcept { return _mm_loadu_pd(data); }
+inline void store(double* data, const Pack pack) noexcept { _mm_storeu_pd(data, pack); }
+inline Pack broadcast(const double value) noexcept { return _mm_set1_pd(value); }
+inline Pack add(const Pack x, const Pack y) noexcept { return _mm_add_pd(x, y); }
+inline Pack subtract(const Pack x, const Pack y) noexcept { return _mm_sub_pd(x, y); }
+inline Pack multiply(const Pack x, const Pack y) noexcept { return _mm_mul_pd(x, y); }
+
+inline double sumElements(const Pack pack) noexcept
+{
+    return _mm_cvtsd_f64(_mm_add_sd(pack, _mm_unpackhi_pd(pack, pack)));
+}
+
+#else
+/** Scalar fallback, one double processed at a time (e.g. on AVR). */
+using Pack = double;
+constexpr size_t PackSize{1U};
+
+inline Pack load(const double* data) noexcept { return *data; }
+inline void store(double* data, const Pack pack) noexcept { *data = pack; }
+inline Pack broadcast(const double value) noexcept { return value; }
+inline Pack add(const Pack x, const Pack y) noexcept { return x + y; }
+inline Pack subtract(const Pack x, const Pack y) noexcept { return x - y; }
+inline Pack multiply(const Pack x, const Pack y) noexcept { return x * y; }
+inline double sumElements(const Pack pack) noexcept { return pack; }
+#endif
+
+// -----------------------------------------------------------------------------
+void predictKernel(const double weight, const double bias, const double* input, 
+                   double* output, const size_t count) noexcept
+{
+    // Predict whole packs first.
+    const Pack weights{broadcast(weight)};
+    const Pack biases{broadcast(bias)};
+    size_t i{};
+
+    for (; i + PackSize <= count; i += PackSize)
+    {
+        store(output + i, add(multiply(weights, load(input + i)), biases));
+    }
+
+    // Predict the remaining inputs one at a time.
+    for (; i < count; ++i) { output[i] = weight * input[i] + bias; }
+}
+
+// -----------------------------------------------------------------------------
+double sumKernel(const double* data, const size_t count) noexcept
+{
+    // Sum whole packs first.
+    Pack packSum{broadcast(0.0)};
+    size_t i{};
+    for (; i + PackSize <= count; i += PackSize) { packSum = add(packSum, load(data + i)); }
+
+    // Add the remaining values one at a time.
+    double sum{sumElements(packSum)};
+    for (; i < count; ++i) { sum += data[i]; }
+    return sum;
+}
+
+// -----------------------------------------------------------------------------
+void deviationKernel(const double* x, const double xMean, const double* y, const double yMean,
+                     const size_t count, double& squaredSum, double& productSum) noexcept
+{
+    // Accumulate the deviation sums of whole packs first.
+    const Pack xMeans{broadcast(xMean)};
+    const Pack yMeans{broadcast(yMean)};
+    Pack packSquaredSum{broadcast(0.0)};
+    Pack packProductSum{broadcast(0.0)};
+    size_t i{};
+
+    for (; i + PackSize <= count; i += PackSize)
+    {
+        const Pack xDeviation{subtract(load(x + i), xMeans)};
+        const Pack yDeviation{subtract(load(y + i), yMeans)};
+        packSquaredSum = add(packSquaredSum, multiply(xDeviation, xDeviation));
+        packProductSum = add(packProductSum, multiply(xDeviation, yDeviation));
+    }
+
+    // Add the remaining values one at a time.
+    squaredSum = sumElements(packSquaredSum);
+    productSum = sumElements(packProductSum);
+
+    for (; i < count; ++i)
+    {
+        const double xDeviation{x[i] - xMean};
+        squaredSum += xDeviation * xDeviation;
+        productSum += xDeviation * (y[i] - yMean);
+    }
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
-Fixed::Fixed() noexcept
+Fixed::Fixed(const double forgettingFactor) noexcept
     : myWeight{}
     , myBias{}
+    , myForgettingFactor{isForgettingFactorValid(forgettingFactor) ? forgettingFactor : 1.0}
+    , mySampleWeight{}
+    , myInputMean{}
+    , myOutputMean{}
+    , mySquaredDeviationSum{}
+    , myCoDeviationSum{}
     , myTrained{false}
 {}
 
@@ -36,6 +207,26 @@ bool Fixed::isTrained() const noexcept { return myTrained; }
 // -----------------------------------------------------------------------------
 double Fixed::predict(const double input) const noexcept { return myWeight * input + myBias; }
 
+// -----------------------------------------------------------------------------
+bool Fixed::update(const double input, const double output) noexcept
+{
+    // Seed the statistics from the current parameters if the model is trained without them.
+    if (myTrained && (0.0 == mySampleWeight)) { seedStatistics(input); }
+
+    // Add the sample to the statistics, decay the earlier samples.
+    accumulate(input, output, myForgettingFactor);
+
+    // Update the weight once the input values differ, keep the current weight otherwise.
+    if (0.0 < mySquaredDeviationSum)
+    {
+        myWeight  = myCoDeviationSum / mySquaredDeviationSum;
+        myTrained = true;
+    }
+    // Fit the bias to the weighted means with the current weight.
+    myBias = myOutputMean - myWeight * myInputMean;
+    return myTrained;
+}
+
 // -----------------------------------------------------------------------------
 bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_t epochCount, 
                    const double learningRate) noexcept
@@ -47,9 +238,10 @@ bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_
     const size_t setCount{min(trainIn.size(), trainOut.size())};
     if (0U == setCount) { return false; }
 
-    // Clear the trainable parameters before starting training.
+    // Clear the trainable parameters and the online statistics before starting training.
     myWeight = 0.0;
     myBias   = 0.0;
+    clearStatistics();
 
     // Train the model the specified number of epochs.
     for (size_t epoch{}; epoch < epochCount; ++epoch)
@@ -65,6 +257,105 @@ bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_
     return myTrained;
 }
 
+// -----------------------------------------------------------------------------
+bool Fixed::trainClosedForm(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept
+{
+    // Check the training set count, return false if invalid.
+    const size_t setCount{min(trainIn.size(), trainOut.size())};
+    if (0U == setCount) { return false; }
+
+    // Accumulate the statistics in a single pass without forgetting earlier samples.
+    clearStatistics();
+    for (size_t i{}; i < setCount; ++i) { accumulate(trainIn[i], trainOut[i], 1.0); }
+
+    // Compute the least-squares parameters, use the mean output if the input is constant.
+    myWeight  = 0.0 < mySquaredDeviationSum ? myCoDeviationSum / mySquaredDeviationSum : 0.0;
+    myBias    = myOutputMean - myWeight * myInputMean;
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+void Fixed::predictBatch(const double* input, double* output, const size_t count) const noexcept
+{
+    // Return immediately if the data is missing.
+    if ((nullptr == input) || (nullptr == output)) { return; }
+    predictKernel(myWeight, myBias, input, output, count);
+}
+
+// -----------------------------------------------------------------------------
+bool Fixed::trainBatch(const double* trainIn, const double* trainOut, 
+                       const size_t count) noexcept
+{
+    // Check the training data, return false if invalid.
+    if ((nullptr == trainIn) || (nullptr == trainOut) || (0U == count)) { return false; }
+
+    // Compute the means in the first pass and the deviation sums in the second pass.
+    clearStatistics();
+    mySampleWeight = static_cast<double>(count);
+    myInputMean    = sumKernel(trainIn, count) / mySampleWeight;
+    myOutputMean   = sumKernel(trainOut, count) / mySampleWeight;
+    deviationKernel(trainIn, myInputMean, trainOut, myOutputMean, count, 
+                    mySquaredDeviationSum, myCoDeviationSum);
+
+    // Compute the least-squares parameters, use the mean output if the input is constant.
+    myWeight  = 0.0 < mySquaredDeviationSum ? myCoDeviationSum / mySquaredDeviationSum : 0.0;
+    myBias    = myOutputMean - myWeight * myInputMean;
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+bool Fixed::save(driver::eeprom::Interface& eeprom, const uint16_t address) const noexcept
+{
+    // Return false if there are no parameters to store.
+    if (!myTrained) { return false; }
+
+    // Serialize the model, append the checksum (least significant byte first).
+    uint8_t record[StorageSize]{};
+    record[0U] = StorageParam::Version;
+    storeBytes(record + StorageParam::WeightOffset, &myWeight, sizeof(myWeight));
+    storeBytes(record + StorageParam::BiasOffset, &myBias, sizeof(myBias));
+    const uint16_t checksum{utils::crc16(record, StorageParam::ChecksumOffset)};
+    record[StorageParam::ChecksumOffset]      = static_cast<uint8_t>(checksum);
+    record[StorageParam::ChecksumOffset + 1U] = static_cast<uint8_t>(checksum >> 8U);
+
+    // Write the bytes that differ from the stored ones, return false on failure.
+    for (uint16_t i{}; i < StorageSize; ++i)
+    {
+        uint8_t storedByte{};
+        if (!eeprom.read(address + i, storedByte)) { return false; }
+        if ((record[i] != storedByte) && !eeprom.write(address + i, record[i])) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Fixed::load(const driver::eeprom::Interface& eeprom, const uint16_t address) noexcept
+{
+    // Read the stored record, return false on failure.
+    uint8_t record[StorageSize]{};
+    for (uint16_t i{}; i < StorageSize; ++i)
+    {
+        if (!eeprom.read(address + i, record[i])) { return false; }
+    }
+
+    // Return false if the format version or the checksum is invalid (e.g. erased EEPROM).
+    const uint16_t checksum{static_cast<uint16_t>(record[StorageParam::ChecksumOffset] 
+        | (record[StorageParam::ChecksumOffset + 1U] << 8U))};
+    if ((StorageParam::Version != record[0U]) 
+        || (utils::crc16(record, StorageParam::ChecksumOffset) != checksum)) { return false; }
+
+    // Restore the parameters, clear the statistics of earlier training.
+    storeBytes(reinterpret_cast<uint8_t*>(&myWeight), record + StorageParam::WeightOffset, 
+               sizeof(myWeight));
+    storeBytes(reinterpret_cast<uint8_t*>(&myBias), record + StorageParam::BiasOffset, 
+               sizeof(myBias));
+    clearStatistics();
+    myTrained = true;
+    return myTrained;
+}
+
 // -----------------------------------------------------------------------------
 void Fixed::optimize(const double input, const double output, const double learningRate) noexcept
 {
@@ -78,5 +369,43 @@ void Fixed::optimize(const double input, const double output, const double learn
         myWeight += error * learningRate * input;
     }
 }
+
+// -----------------------------------------------------------------------------
+void Fixed::accumulate(const double input, const double output, 
+                       const double forgettingFactor) noexcept
+{
+    // Decay the earlier samples and add the new sample with weight 1.0.
+    mySampleWeight = forgettingFactor * mySampleWeight + 1.0;
+
+    // Update the means and co-moments (weighted version of Welford's algorithm).
+    const double inputDelta{input - myInputMean};
+    myInputMean           += inputDelta / mySampleWeight;
+    myOutputMean          += (output - myOutputMean) / mySampleWeight;
+    mySquaredDeviationSum  = forgettingFactor * mySquaredDeviationSum 
+        + inputDelta * (input - myInputMean);
+    myCoDeviationSum       = forgettingFactor * myCoDeviationSum 
+        + inputDelta * (output - myOutputMean);
+}
+
+// -----------------------------------------------------------------------------
+void Fixed::seedStatistics(const double input) noexcept
+{
+    // Use pseudo-samples on the current line, centered at the given input, as prior.
+    mySampleWeight        = PriorParam::SampleWeight;
+    myInputMean           = input;
+    myOutputMean          = predict(input);
+    mySquaredDeviationSum = PriorParam::SampleWeight * PriorParam::InputVariance;
+    myCoDeviationSum      = myWeight * mySquaredDeviationSum;
+}
+
+// -----------------------------------------------------------------------------
+void Fixed::clearStatistics() noexcept
+{
+    mySampleWeight        = 0.0;
+    myInputMean           = 0.0;
+    myOutputMean          = 0.0;
+    mySquaredDeviationSum = 0.0;
+    myCoDeviationSum      = 0.0;
+}
 } // namespace lin_reg
 } // namespace ml
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**
+ * @brief Implementation details of the event queue.
+ */
+#include "arch/avr/hw_platform.h"
+#include "scheduler/event_queue.h"
+#include "scheduler/power_manager.h"
+#include "utils/utils.h"
+
+namespace scheduler
+{
+// -----------------------------------------------------------------------------
+EventQueue::EventQueue() noexcept
+    : myPending{}
+{}
+
+// -----------------------------------------------------------------------------
+bool EventQueue::isEmpty() const noexcept { return 0U == myPending; }
+
+// -----------------------------------------------------------------------------
+bool EventQueue::isPending(const uint8_t event) const noexcept
+{
+    return (MaxEventCount > event) && utils::read(myPending, event);
+}
+
+// -----------------------------------------------------------------------------
+bool EventQueue::post(const uint8_t event) noexcept
+{
+    if (MaxEventCount <= event) { return false; }
+
+    // Disable interrupts while updating, since the 16-bit pending mask isn't updated atomically.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    utils::set(myPending, event);
+    SREG = status;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool EventQueue::pop(uint8_t& event) noexcept
+{
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    const uint16_t pending{myPending};
+    bool popped{false};
+
+    // Pop the lowest pending event number, which has the highest priority.
+    if (0U != pending)
+    {
+        uint8_t i{};
+        while (!utils::read(pending, i)) { ++i; }
+        utils::clear(myPending, i);
+        event  = i;
+        popped = true;
+    }
+    SREG = status;
+    return popped;
+}
+
+// -----------------------------------------------------------------------------
+void EventQueue::clear() noexcept 
+{ 
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    myPending = 0U; 
+    SREG = status;
+}
+
+// -----------------------------------------------------------------------------
+void EventQueue::waitForEvent(PowerManager* powerManager) noexcept
+{
+    // Disable interrupts to avoid missing events posted between the check and the sleep.
+    utils::globalInterruptDisable();
+
+    // Let the power manager select the sleep mode if present.
+    if (isEmpty() && (nullptr != powerManager)) { powerManager->sleep(); }
+    else if (isEmpty())
+    {
+        // Enable idle sleep mode, which keeps timers, UART and pin change interrupts running.
+        SMCR = (1U << SE);
+
+        // The instruction following SEI is always executed before any pending interrupt,
+        // hence an interrupt posting an event will wake the CPU up instead of being missed.
+        asm("SEI");
+        asm("SLEEP");
+        SMCR = 0U;
+    }
+    else { utils::globalInterruptEnable(); }
+}
+} // namespace scheduler
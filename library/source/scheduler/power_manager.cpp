@@ -0,0 +1,178 @@
+/**
+ * @brief Implementation details of the sleep-mode power manager.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/timer/system_time.h"
+#include "scheduler/power_manager.h"
+#include "utils/utils.h"
+
+namespace scheduler
+{
+namespace
+{
+/**
+ * @brief Structure of timer parameters.
+ */
+struct TimerParam
+{
+    /** Clock select bits of the timer control registers (a timer is stopped if all are 0). */
+    static constexpr uint8_t ClockSelectMask{(1U << CS00) | (1U << CS01) | (1U << CS02)};
+};
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t stateIndex(const PowerState state) noexcept
+{
+    return static_cast<uint8_t>(state);
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t sleepModeBits(const PowerState state) noexcept
+{
+    switch (state)
+    {
+        case PowerState::AdcNoiseReduction:
+            return (1U << SM0);
+        case PowerState::PowerSave:
+            return (1U << SM1) | (1U << SM0);
+        case PowerState::PowerDown:
+            return (1U << SM1);
+        default:
+            return 0U;
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool isTimerRunning(const volatile uint8_t& controlRegB) noexcept
+{
+    return 0U != (controlRegB & TimerParam::ClockSelectMask);
+}
+
+// -----------------------------------------------------------------------------
+bool isSerialActive() noexcept
+{
+    // The receiver can only wake up the CPU from idle mode. The transmit complete flag is
+    // cleared by the serial driver for each character and set once it has been shifted out.
+    if (utils::read(UCSR0B, RXEN0)) { return true; }
+    return utils::read(UCSR0B, TXEN0) && !utils::read(UCSR0A, TXC0);
+}
+
+// -----------------------------------------------------------------------------
+bool isEdgeTriggeredInterruptEnabled() noexcept
+{
+    // External interrupts only wake up the CPU from deeper sleep modes when level-triggered.
+    const bool int0{utils::read(EIMSK, INT0) && utils::read(EICRA, ISC00, ISC01)};
+    const bool int1{utils::read(EIMSK, INT1) && utils::read(EICRA, ISC10, ISC11)};
+    return int0 || int1;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+PowerManager::PowerManager(const driver::timer::SystemTime* systemTime) noexcept
+    : mySystemTime{systemTime}
+    , myEntryCount{}
+    , myTime_us{}
+    , myWakeUpTime_us{now()}
+{}
+
+// -----------------------------------------------------------------------------
+PowerState PowerManager::deepestSleepMode() const noexcept
+{
+    // Use idle mode if any peripheral running on the I/O clock is in use.
+    if (isSerialActive() || utils::read(SPCR, SPE) || isEdgeTriggeredInterruptEnabled()
+        || isTimerRunning(TCCR0B) || isTimerRunning(TCCR1B))
+    {
+        return PowerState::Idle;
+    }
+
+    // Timer 2 only keeps running in deeper sleep modes if clocked asynchronously.
+    const bool timer2Running{isTimerRunning(TCCR2B)};
+    if (timer2Running && !utils::read(ASSR, AS2)) { return PowerState::Idle; }
+
+    // Use ADC noise reduction mode if an ADC conversion is ongoing.
+    if (utils::read(ADCSRA, ADSC)) { return PowerState::AdcNoiseReduction; }
+
+    // Use power-save mode if the asynchronous timer is running, otherwise power-down mode.
+    return timer2Running ? PowerState::PowerSave : PowerState::PowerDown;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t PowerManager::unusedPeripherals() const noexcept
+{
+    uint8_t bits{};
+
+    // Power down disabled peripherals and stopped timers.
+    if (!utils::read(TWCR, TWEN)) { utils::set(bits, PRTWI); }
+    if (!isTimerRunning(TCCR2B)) { utils::set(bits, PRTIM2); }
+    if (!isTimerRunning(TCCR0B)) { utils::set(bits, PRTIM0); }
+    if (!isTimerRunning(TCCR1B)) { utils::set(bits, PRTIM1); }
+    if (!utils::read(SPCR, SPE)) { utils::set(bits, PRSPI); }
+    if (!utils::read(UCSR0B, RXEN0, TXEN0)) { utils::set(bits, PRUSART0); }
+    if (!utils::read(ADCSRA, ADEN)) { utils::set(bits, PRADC); }
+    return bits;
+}
+
+// -----------------------------------------------------------------------------
+void PowerManager::sleep() noexcept
+{
+    // Select the sleep mode while interrupts are disabled, then update the statistics.
+    const PowerState mode{deepestSleepMode()};
+    const uint64_t sleepTime_us{now()};
+    addTime(PowerState::Active, myWakeUpTime_us, sleepTime_us);
+    myEntryCount[stateIndex(mode)]++;
+
+    // Power down unused peripherals, keep the bits set by the application.
+    const uint8_t powerReduction{PRR};
+    PRR = powerReduction | unusedPeripherals();
+
+    // The instruction following SEI is always executed before any pending interrupt,
+    // hence an interrupt occurring after the sleep mode was selected wakes the CPU up.
+    SMCR = sleepModeBits(mode) | (1U << SE);
+    asm("SEI");
+    asm("SLEEP");
+
+    // Disable sleep mode and power up the peripherals again directly after wake-up.
+    SMCR = 0U;
+    PRR  = powerReduction;
+
+    // Update the statistics.
+    myWakeUpTime_us = now();
+    addTime(mode, sleepTime_us, myWakeUpTime_us);
+    myEntryCount[stateIndex(PowerState::Active)]++;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t PowerManager::entryCount(const PowerState state) const noexcept
+{
+    return StateCount > stateIndex(state) ? myEntryCount[stateIndex(state)] : 0U;
+}
+
+// -----------------------------------------------------------------------------
+uint64_t PowerManager::timeInState_us(const PowerState state) const noexcept
+{
+    return StateCount > stateIndex(state) ? myTime_us[stateIndex(state)] : 0U;
+}
+
+// -----------------------------------------------------------------------------
+void PowerManager::resetStatistics() noexcept
+{
+    for (uint8_t i{}; i < StateCount; ++i)
+    {
+        myEntryCount[i] = 0U;
+        myTime_us[i]    = 0U;
+    }
+    myWakeUpTime_us = now();
+}
+
+// -----------------------------------------------------------------------------
+uint64_t PowerManager::now() const noexcept
+{
+    return nullptr != mySystemTime ? mySystemTime->uptime_us() : 0U;
+}
+
+// -----------------------------------------------------------------------------
+void PowerManager::addTime(const PowerState state, const uint64_t start_us,
+                           const uint64_t end_us) noexcept
+{
+    if (end_us > start_us) { myTime_us[stateIndex(state)] += end_us - start_us; }
+}
+} // namespace scheduler
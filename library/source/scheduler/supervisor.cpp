@@ -0,0 +1,159 @@
+/**
+ * @brief Implementation details of the watchdog supervisor.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/eeprom/interface.h"
+#include "driver/timer/system_time.h"
+#include "driver/watchdog/interface.h"
+#include "scheduler/supervisor.h"
+#include "utils/utils.h"
+
+namespace scheduler
+{
+namespace
+{
+/** Task ID of an erased failure record, i.e. no record stored. */
+constexpr uint8_t ErasedTask{0xFFU};
+
+/** Pointer to the supervisor handling watchdog timeouts. */
+Supervisor* myInstance{nullptr};
+
+// -----------------------------------------------------------------------------
+void handleWatchdogTimeout() noexcept
+{
+    if (nullptr != myInstance) { myInstance->handleWatchdogTimeout(); }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Supervisor::Supervisor(driver::watchdog::Interface& watchdog,
+                       const driver::timer::SystemTime& systemTime,
+                       driver::eeprom::Interface* eeprom, const uint16_t recordAddr) noexcept
+    : myTasks{}
+    , myWatchdog{watchdog}
+    , mySystemTime{systemTime}
+    , myEeprom{eeprom}
+    , myRecordAddr{recordAddr}
+    , myTaskCount{}
+    , myRecordPending{false}
+{
+    // Only use the supervisor if no other supervisor is in use.
+    if (nullptr != myInstance) { return; }
+    myInstance = this;
+    myWatchdog.setTimeoutCallback(scheduler::handleWatchdogTimeout);
+}
+
+// -----------------------------------------------------------------------------
+Supervisor::~Supervisor() noexcept
+{
+    if (!isInitialized()) { return; }
+    myWatchdog.setTimeoutCallback(nullptr);
+    myInstance = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+bool Supervisor::isInitialized() const noexcept { return this == myInstance; }
+
+// -----------------------------------------------------------------------------
+int8_t Supervisor::addTask(const uint32_t deadline_ms) noexcept
+{
+    if (!isInitialized() || (MaxTaskCount <= myTaskCount)) { return -1; }
+    const uint32_t now_ms{mySystemTime.uptime_ms()};
+
+    // Disable interrupts, since tasks may check in from interrupt context.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    myTasks[myTaskCount] = Task{deadline_ms, now_ms};
+    const uint8_t task{myTaskCount++};
+    SREG = status;
+    return static_cast<int8_t>(task);
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Supervisor::taskCount() const noexcept { return myTaskCount; }
+
+// -----------------------------------------------------------------------------
+void Supervisor::checkIn(const uint8_t task) noexcept
+{
+    if (task >= myTaskCount) { return; }
+    const uint32_t now_ms{mySystemTime.uptime_ms()};
+
+    // Disable interrupts, since the 32-bit timestamp can't be written atomically.
+    const uint8_t status{SREG};
+    utils::globalInterruptDisable();
+    myTasks[task].lastCheckIn_ms = now_ms;
+    SREG = status;
+}
+
+// -----------------------------------------------------------------------------
+int8_t Supervisor::overdueTask() const noexcept
+{
+    const uint32_t now_ms{mySystemTime.uptime_ms()};
+
+    for (uint8_t i{}; i < myTaskCount; ++i)
+    {
+        // Disable interrupts, since the task may check in from interrupt context.
+        const uint8_t status{SREG};
+        utils::globalInterruptDisable();
+        const uint32_t lastCheckIn_ms{myTasks[i].lastCheckIn_ms};
+        SREG = status;
+
+        // Compare the signed difference to handle wrap-around of the uptime, check-ins after
+        // the current time was read result in a negative difference and are treated as on time.
+        const int32_t elapsed_ms{static_cast<int32_t>(now_ms - lastCheckIn_ms)};
+        if (elapsed_ms > static_cast<int32_t>(myTasks[i].deadline_ms)) 
+        { 
+            return static_cast<int8_t>(i); 
+        }
+    }
+    return -1;
+}
+
+// -----------------------------------------------------------------------------
+bool Supervisor::service() noexcept
+{
+    // Only reset the watchdog if all tasks are healthy, let the watchdog time out otherwise.
+    if (0 <= overdueTask()) { return false; }
+    myWatchdog.reset();
+
+    // Clear the failure record of a preceding timeout, since the system has recovered.
+    if (myRecordPending)
+    {
+        myRecordPending = false;
+        clearRecord();
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Supervisor::handleWatchdogTimeout() noexcept
+{
+    if (nullptr == myEeprom) { return; }
+
+    // Store the first overdue task and the uptime before the system is reset.
+    const int8_t task{overdueTask()};
+    (void) (myEeprom->write(myRecordAddr, 0 <= task ? static_cast<uint8_t>(task) : NoTask));
+    (void) (myEeprom->write(myRecordAddr + 1U, mySystemTime.uptime_ms()));
+    myRecordPending = true;
+}
+
+// -----------------------------------------------------------------------------
+bool Supervisor::readRecord(uint8_t& task, uint32_t& uptime_ms) const noexcept
+{
+    // Return false if no record is stored, i.e. if the record is erased.
+    uint8_t storedTask{ErasedTask};
+    if ((nullptr == myEeprom) || !myEeprom->read(myRecordAddr, storedTask)
+        || (ErasedTask == storedTask) || !myEeprom->read(myRecordAddr + 1U, uptime_ms))
+    {
+        return false;
+    }
+    task = storedTask;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Supervisor::clearRecord() noexcept
+{
+    if (nullptr != myEeprom) { (void) (myEeprom->write(myRecordAddr, ErasedTask)); }
+}
+} // namespace scheduler
@@ -0,0 +1,87 @@
+/**
+ * @brief Implementation details of the command line tokenizer.
+ */
+#include "utils/command_parser.h"
+
+namespace utils
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+constexpr bool isWhitespace(const char character) noexcept
+{
+    return (' ' == character) || ('\t' == character) || ('\r' == character) 
+        || ('\n' == character);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Tokens::Tokens() noexcept
+    : myTokens{}
+    , myCount{}
+    , myTruncated{false}
+{}
+
+// -----------------------------------------------------------------------------
+Tokens::Tokens(char* line) noexcept
+    : Tokens{}
+{
+    if (nullptr == line) { return; }
+
+    while ('\0' != *line)
+    {
+        // Skip leading whitespace, terminate if the end of the line is reached.
+        while (isWhitespace(*line)) { ++line; }
+        if ('\0' == *line) { return; }
+
+        // Store the token, drop it if the max number of tokens has already been stored.
+        if (MaxCount > myCount) { myTokens[myCount++] = line; }
+        else { myTruncated = true; }
+
+        // Find the end of the token, terminate it by replacing the following whitespace.
+        while (('\0' != *line) && !isWhitespace(*line)) { ++line; }
+        if ('\0' != *line) { *line++ = '\0'; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Tokens::count() const noexcept { return myCount; }
+
+// -----------------------------------------------------------------------------
+bool Tokens::isTruncated() const noexcept { return myTruncated; }
+
+// -----------------------------------------------------------------------------
+const char* Tokens::operator[](const uint8_t index) const noexcept
+{
+    return index < myCount ? myTokens[index] : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+Tokens Tokens::tail(const uint8_t first) const noexcept
+{
+    Tokens tokens{};
+
+    for (uint8_t i{first}; i < myCount; ++i) { tokens.myTokens[tokens.myCount++] = myTokens[i]; }
+    tokens.myTruncated = myTruncated;
+    return tokens;
+}
+
+// -----------------------------------------------------------------------------
+bool Tokens::toUint32(const uint8_t index, uint32_t& value) const noexcept
+{
+    const char* token{(*this)[index]};
+    if (nullptr == token) { return false; }
+
+    // Accumulate the digits, return false on invalid characters or overflow.
+    uint32_t result{};
+    for (; '\0' != *token; ++token)
+    {
+        if (('0' > *token) || ('9' < *token)) { return false; }
+        const uint8_t digit{static_cast<uint8_t>(*token - '0')};
+        if ((UINT32_MAX - digit) / 10U < result) { return false; }
+        result = result * 10U + digit;
+    }
+    value = result;
+    return true;
+}
+} // namespace utils
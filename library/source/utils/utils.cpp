@@ -6,6 +6,12 @@
 
 namespace utils
 { 
+namespace
+{
+/** Hooks invoked on heap allocation (nullptr if unused). */
+const MemoryHooks* myMemoryHooks{nullptr};
+} // namespace
+
 // -----------------------------------------------------------------------------
 void delay_s(const uint16_t& delayTime_s) noexcept
 {
@@ -39,6 +45,37 @@ void globalInterruptEnable() noexcept { asm("SEI"); }
 // -----------------------------------------------------------------------------
 void globalInterruptDisable() noexcept { asm("CLI"); }
 
+// -----------------------------------------------------------------------------
+uint16_t crc16(const uint8_t* data, const size_t size) noexcept
+{
+    uint16_t crc{0xFFFFU};
+
+    // Process the data one byte at a time, most significant bit first.
+    for (size_t i{}; i < size; ++i)
+    {
+        crc ^= static_cast<uint16_t>(data[i] << 8U);
+
+        for (uint8_t bit{}; bit < 8U; ++bit)
+        {
+            crc = (crc & 0x8000U) ? static_cast<uint16_t>((crc << 1U) ^ 0x1021U) 
+                                  : static_cast<uint16_t>(crc << 1U);
+        }
+    }
+    return crc;
+}
+
+// -----------------------------------------------------------------------------
+void setMemoryHooks(const MemoryHooks* hooks) noexcept
+{
+    // Only use the hooks if all are set, since they are invoked without null checks.
+    const bool valid{(nullptr != hooks) && (nullptr != hooks->onAllocate) 
+                     && (nullptr != hooks->onDeallocate) && (nullptr != hooks->onReallocate)};
+    myMemoryHooks = valid ? hooks : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+const MemoryHooks* memoryHooks() noexcept { return myMemoryHooks; }
+
 } // namespace utils
 
 /**
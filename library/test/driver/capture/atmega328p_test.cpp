@@ -0,0 +1,157 @@
+/**
+ * @brief Unit tests for the ATmega328p input capture driver.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/capture/atmega328p.h"
+#include "driver/timer/atmega328p.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** The number of timer counts per overflow. */
+constexpr std::uint32_t OverflowCount{65536UL};
+
+// -----------------------------------------------------------------------------
+void capture(capture::Atmega328p& unit, const std::uint32_t timestamp, 
+             const bool overflowPending = false) noexcept
+{
+    // Simulate the capture interrupt at given timestamp (lower 16 bits).
+    ICR1 = static_cast<std::uint16_t>(timestamp % OverflowCount);
+    if (overflowPending) { utils::set(TIFR1, TOV1); }
+    else { utils::clear(TIFR1, TOV1); }
+    unit.handleCapture();
+}
+
+/**
+ * @brief Input capture initialization test.
+ * 
+ *        Verify that Timer 1 is reserved by the input capture unit.
+ */
+TEST(Capture_Atmega328p, Initialization)
+{
+    {
+        capture::Atmega328p unit{capture::Atmega328p::Edge::Both, true};
+        EXPECT_TRUE(unit.isInitialized());
+        EXPECT_TRUE(unit.isEnabled());
+
+        // Expect normal mode without prescaler, noise canceler enabled and rising edge first.
+        EXPECT_EQ(0U, TCCR1A);
+        EXPECT_EQ((1U << ICNC1) | (1U << ICES1) | (1U << CS10), TCCR1B);
+        EXPECT_EQ((1U << ICIE1) | (1U << TOIE1), TIMSK1);
+
+        // Expect only one input capture unit to be available.
+        capture::Atmega328p other{};
+        EXPECT_FALSE(other.isInitialized());
+
+        // Expect timers not to be able to use Timer 1.
+        timer::Atmega328p timer0{10U};
+        timer::Atmega328p timer1{10U};
+        timer::Atmega328p timer2{10U};
+        EXPECT_TRUE(timer0.isInitialized());
+        EXPECT_TRUE(timer1.isInitialized());
+        EXPECT_FALSE(timer2.isInitialized());
+
+        // Expect the interrupts to be disabled when the unit is disabled.
+        unit.setEnabled(false);
+        EXPECT_FALSE(unit.isEnabled());
+        EXPECT_EQ(0U, TIMSK1);
+    }
+
+    // Verify that Timer 1 is released when the unit is deleted.
+    EXPECT_EQ(0U, TCCR1B);
+    capture::Atmega328p unit{capture::Atmega328p::Edge::Falling};
+    EXPECT_TRUE(unit.isInitialized());
+    EXPECT_FALSE(unit.isEnabled());
+    EXPECT_FALSE(utils::read(TCCR1B, ICES1));
+}
+
+/**
+ * @brief Input capture measurement test.
+ * 
+ *        Verify that the period and duty cycle are measured correctly, also when the timer 
+ *        overflows between captures.
+ */
+TEST(Capture_Atmega328p, Measurement)
+{
+    capture::Atmega328p unit{capture::Atmega328p::Edge::Both, true};
+    EXPECT_TRUE(unit.isInitialized());
+
+    // Case 1 - Verify that no measurement is made before a complete period is captured.
+    capture::Measurement measurement{};
+    EXPECT_FALSE(unit.measure(measurement));
+    capture(unit, 1000U);
+    capture(unit, 5000U);
+    EXPECT_FALSE(unit.measure(measurement));
+
+    // Case 2 - Verify a 1 kHz signal with 25 % duty cycle (16000 counts per period).
+    capture(unit, 17000U);
+    capture(unit, 21000U);
+    capture(unit, 33000U);
+    capture(unit, 37000U);
+    capture(unit, 49000U);
+    capture(unit, 53000U);
+    capture(unit, 65000U);
+
+    // The counter overflows before the next capture, but the overflow interrupt is pending.
+    capture(unit, 69000U, true);
+    unit.handleOverflow();
+    capture(unit, 81000U);
+    EXPECT_EQ(9U, unit.eventCount());
+
+    EXPECT_TRUE(unit.measure(measurement));
+    EXPECT_EQ(0U, unit.eventCount());
+    EXPECT_EQ(9U, measurement.periodCount);
+    EXPECT_DOUBLE_EQ(1000.0, measurement.period_us);
+    EXPECT_DOUBLE_EQ(250.0, measurement.highTime_us);
+    EXPECT_DOUBLE_EQ(1000.0, measurement.frequency_Hz);
+    EXPECT_DOUBLE_EQ(0.25, measurement.dutyCycle);
+
+    // Case 3 - Verify that the last edges are retained between measurements.
+    capture(unit, 85000U);
+    EXPECT_TRUE(unit.measure(measurement));
+    EXPECT_EQ(1U, measurement.periodCount);
+    EXPECT_DOUBLE_EQ(1000.0, measurement.period_us);
+
+    // Case 4 - Verify that the edges alternate and that raw events can be read.
+    capture::Event event{};
+    capture(unit, 97000U);
+    EXPECT_TRUE(unit.readEvent(event));
+    EXPECT_TRUE(event.rising);
+    EXPECT_EQ(97000U, event.timestamp);
+    EXPECT_FALSE(unit.readEvent(event));
+}
+
+/**
+ * @brief Input capture buffer overflow test.
+ * 
+ *        Verify that events are counted as lost when the event buffer is full.
+ */
+TEST(Capture_Atmega328p, LostEvents)
+{
+    capture::Atmega328p unit{capture::Atmega328p::Edge::Rising, true};
+
+    // Capture more events than the buffer can hold, expect the excess events to be lost.
+    for (std::uint32_t i{}; i < 40U; ++i) { capture(unit, i * 1000U); }
+    EXPECT_EQ(32U, unit.eventCount());
+    EXPECT_EQ(8U, unit.lostEventCount());
+
+    // Expect the rising edges to be used for the period, but no duty cycle to be measured.
+    capture::Measurement measurement{};
+    EXPECT_TRUE(unit.measure(measurement));
+    EXPECT_EQ(31U, measurement.periodCount);
+    EXPECT_DOUBLE_EQ(62.5, measurement.period_us);
+    EXPECT_DOUBLE_EQ(16000.0, measurement.frequency_Hz);
+    EXPECT_DOUBLE_EQ(0.0, measurement.dutyCycle);
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -13,6 +13,12 @@
 
 namespace driver
 {
+namespace gpio
+{
+/** Pin change interrupt service routine for I/O port D. */
+void PCINT2_vect() noexcept;
+} // namespace gpio
+
 namespace
 {
 /**
@@ -78,6 +84,24 @@ constexpr void simulateToggle(GpioRegs& regs) noexcept
     }
 }
 
+/** The number of edges detected per edge type. */
+std::uint8_t myEdgeCount[static_cast<std::uint8_t>(gpio::Edge::Count)]{};
+
+/** The number of changes detected. */
+std::uint8_t myChangeCount{};
+
+// -----------------------------------------------------------------------------
+void countEdge(const gpio::Edge edge) { myEdgeCount[static_cast<std::uint8_t>(edge)]++; }
+
+// -----------------------------------------------------------------------------
+void countChange() { myChangeCount++; }
+
+// -----------------------------------------------------------------------------
+std::uint8_t edgeCount(const gpio::Edge edge) noexcept 
+{ 
+    return myEdgeCount[static_cast<std::uint8_t>(edge)]; 
+}
+
 // -----------------------------------------------------------------------------
 void runOutputTest(const std::uint8_t id, GpioRegs& regs) noexcept
 {
@@ -247,6 +271,79 @@ TEST(Gpio_Atmega328p, Input)
         runInputTest(pin, regs);
     }
 }
+
+/**
+ * @brief GPIO pin change interrupt test.
+ * 
+ *        Verify that pin change interrupts only invoke the callbacks of the pins that changed,
+ *        along with the associated edge.
+ */
+TEST(Gpio_Atmega328p, PinChangeInterrupt)
+{
+    constexpr std::uint8_t edgePin{4U};
+    constexpr std::uint8_t changePin{7U};
+    constexpr std::uint8_t unusedPin{5U};
+
+    gpio::Atmega328p edgeButton{edgePin, gpio::Direction::Input, &countEdge};
+    gpio::Atmega328p changeButton{changePin, gpio::Direction::Input, &countChange};
+    ASSERT_TRUE(edgeButton.isInitialized());
+    ASSERT_TRUE(changeButton.isInitialized());
+
+    // Start with all inputs low, latch the inputs by enabling the interrupts.
+    PIND = 0U;
+    edgeButton.enableInterrupt(true);
+    changeButton.enableInterrupt(true);
+
+    // Case 1 - Verify that no callbacks are invoked if no input has changed.
+    gpio::PCINT2_vect();
+    EXPECT_EQ(0U, edgeCount(gpio::Edge::Rising));
+    EXPECT_EQ(0U, edgeCount(gpio::Edge::Falling));
+    EXPECT_EQ(0U, myChangeCount);
+
+    // Case 2 - Set the first input high, expect a rising edge for the associated pin only.
+    utils::set(PIND, edgePin);
+    gpio::PCINT2_vect();
+    EXPECT_EQ(1U, edgeCount(gpio::Edge::Rising));
+    EXPECT_EQ(0U, edgeCount(gpio::Edge::Falling));
+    EXPECT_EQ(0U, myChangeCount);
+
+    // Case 3 - Set the first input low, expect a falling edge for the associated pin only.
+    utils::clear(PIND, edgePin);
+    gpio::PCINT2_vect();
+    EXPECT_EQ(1U, edgeCount(gpio::Edge::Rising));
+    EXPECT_EQ(1U, edgeCount(gpio::Edge::Falling));
+    EXPECT_EQ(0U, myChangeCount);
+
+    // Case 4 - Change the second input, expect the associated callback to be invoked only.
+    utils::set(PIND, changePin);
+    gpio::PCINT2_vect();
+    utils::clear(PIND, changePin);
+    gpio::PCINT2_vect();
+    EXPECT_EQ(2U, myChangeCount);
+    EXPECT_EQ(1U, edgeCount(gpio::Edge::Rising));
+    EXPECT_EQ(1U, edgeCount(gpio::Edge::Falling));
+
+    // Case 5 - Change a pin without interrupt enabled, expect no callbacks to be invoked.
+    utils::set(PIND, unusedPin);
+    gpio::PCINT2_vect();
+    EXPECT_EQ(2U, myChangeCount);
+    EXPECT_EQ(1U, edgeCount(gpio::Edge::Rising));
+
+    // Case 6 - Disable the interrupt for the first pin, expect changes to be ignored.
+    edgeButton.enableInterrupt(false);
+    utils::set(PIND, edgePin);
+    gpio::PCINT2_vect();
+    EXPECT_EQ(1U, edgeCount(gpio::Edge::Rising));
+
+    // Case 7 - Re-enable the interrupt, expect the current input to be latched.
+    edgeButton.enableInterrupt(true);
+    gpio::PCINT2_vect();
+    EXPECT_EQ(1U, edgeCount(gpio::Edge::Rising));
+    utils::clear(PIND, edgePin);
+    gpio::PCINT2_vect();
+    EXPECT_EQ(2U, edgeCount(gpio::Edge::Falling));
+    PIND = 0U;
+}
 } // namespace
 } // namespace driver
 
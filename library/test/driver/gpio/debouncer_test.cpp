@@ -0,0 +1,148 @@
+/**
+ * @brief Unit tests for the debounced input service.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/gpio/debouncer.h"
+#include "driver/gpio/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** The max number of recorded inputs. */
+constexpr std::uint8_t MaxInputs{2U};
+
+/** The number of events per input and event type. */
+std::uint8_t myEvents[MaxInputs][static_cast<std::uint8_t>(gpio::InputEvent::Count)]{};
+
+// -----------------------------------------------------------------------------
+void recordEvent(const std::uint8_t input, const gpio::InputEvent event)
+{
+    if (MaxInputs > input) { myEvents[input][static_cast<std::uint8_t>(event)]++; }
+}
+
+// -----------------------------------------------------------------------------
+std::uint8_t eventCount(const std::uint8_t input, const gpio::InputEvent event) noexcept
+{
+    return myEvents[input][static_cast<std::uint8_t>(event)];
+}
+
+// -----------------------------------------------------------------------------
+void resetEvents() noexcept
+{
+    for (auto& input : myEvents)
+    {
+        for (auto& count : input) { count = 0U; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void tick(gpio::Debouncer& debouncer, const std::uint8_t count) noexcept
+{
+    for (std::uint8_t i{}; i < count; ++i) { debouncer.tick(); }
+}
+
+/**
+ * @brief Debounce test.
+ *
+ *        Verify that contact bounces are filtered out and press/release events are generated.
+ */
+TEST(Gpio_Debouncer, PressRelease)
+{
+    constexpr std::uint8_t limit{4U};
+    resetEvents();
+    gpio::Stub button{};
+    gpio::Debouncer debouncer{recordEvent, limit, 0U};
+    ASSERT_EQ(0, debouncer.add(button));
+    EXPECT_FALSE(debouncer.isActive(0U));
+
+    // Case 1 - Simulate bounces shorter than the integrator limit, expect no events.
+    for (std::uint8_t i{}; i < 10U; ++i)
+    {
+        button.write(0U == i % 2U);
+        debouncer.tick();
+    }
+    EXPECT_EQ(0U, eventCount(0U, gpio::InputEvent::Press));
+    EXPECT_FALSE(debouncer.isActive(0U));
+
+    // Case 2 - Keep the input active, expect a single press event once the limit is reached.
+    button.write(true);
+    tick(debouncer, limit - 1U);
+    EXPECT_EQ(0U, eventCount(0U, gpio::InputEvent::Press));
+    tick(debouncer, limit);
+    EXPECT_EQ(1U, eventCount(0U, gpio::InputEvent::Press));
+    EXPECT_TRUE(debouncer.isActive(0U));
+
+    // Case 3 - Bounce while active, expect no new events.
+    button.write(false);
+    tick(debouncer, 2U);
+    button.write(true);
+    tick(debouncer, limit);
+    EXPECT_EQ(1U, eventCount(0U, gpio::InputEvent::Press));
+    EXPECT_EQ(0U, eventCount(0U, gpio::InputEvent::Release));
+
+    // Case 4 - Release the input, expect a single release event.
+    button.write(false);
+    tick(debouncer, 2U * limit);
+    EXPECT_EQ(1U, eventCount(0U, gpio::InputEvent::Release));
+    EXPECT_FALSE(debouncer.isActive(0U));
+    EXPECT_EQ(0U, eventCount(0U, gpio::InputEvent::LongPress));
+}
+
+/**
+ * @brief Long press and multiple input test.
+ *
+ *        Verify that long presses are detected and that inputs are debounced independently.
+ */
+TEST(Gpio_Debouncer, LongPress)
+{
+    constexpr std::uint8_t limit{2U};
+    constexpr std::uint16_t longPressTicks{10U};
+    resetEvents();
+    gpio::Stub button1{};
+    gpio::Stub button2{};
+    button2.write(true);
+    gpio::Debouncer debouncer{recordEvent, limit, longPressTicks};
+
+    // Register the second input as active low, expect it to start inactive.
+    EXPECT_EQ(0, debouncer.add(button1));
+    EXPECT_EQ(1, debouncer.add(button2, true));
+    EXPECT_EQ(2U, debouncer.inputCount());
+    EXPECT_FALSE(debouncer.isActive(1U));
+    EXPECT_FALSE(debouncer.isActive(2U));
+
+    // Case 1 - Press both buttons simultaneously, expect a press event for each.
+    button1.write(true);
+    button2.write(false);
+    tick(debouncer, limit);
+    EXPECT_EQ(1U, eventCount(0U, gpio::InputEvent::Press));
+    EXPECT_EQ(1U, eventCount(1U, gpio::InputEvent::Press));
+
+    // Case 2 - Release the second button, keep the first pressed, expect a long press event
+    //          for the first button only.
+    button2.write(true);
+    tick(debouncer, longPressTicks);
+    EXPECT_EQ(1U, eventCount(0U, gpio::InputEvent::LongPress));
+    EXPECT_EQ(0U, eventCount(1U, gpio::InputEvent::LongPress));
+    EXPECT_EQ(1U, eventCount(1U, gpio::InputEvent::Release));
+
+    // Case 3 - Keep holding the first button, expect no further long press events.
+    tick(debouncer, 2U * longPressTicks);
+    EXPECT_EQ(1U, eventCount(0U, gpio::InputEvent::LongPress));
+
+    // Case 4 - Verify that no more than the max number of inputs can be registered.
+    for (std::uint8_t i{2U}; i < gpio::Debouncer::MaxInputCount; ++i)
+    {
+        EXPECT_EQ(static_cast<std::int8_t>(i), debouncer.add(button1));
+    }
+    EXPECT_EQ(-1, debouncer.add(button1));
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,148 @@
+/**
+ * @brief Unit tests for GPIOs bound at compile time.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/gpio/atmega328p.h"
+#include "driver/gpio/pin.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+using Port = gpio::Atmega328p::Port;
+using IoPort = gpio::Atmega328p::IoPort;
+
+// Verify that the registers and bits are resolved at compile time.
+static_assert(IoPort::D == gpio::Pin<Port::D7, gpio::Direction::Output>::Port, "Invalid port!");
+static_assert(IoPort::B == gpio::Pin<Port::B5, gpio::Direction::Output>::Port, "Invalid port!");
+static_assert(IoPort::C == gpio::Pin<Port::C0, gpio::Direction::Input>::Port, "Invalid port!");
+static_assert(7U == gpio::Pin<Port::D7, gpio::Direction::Output>::Bit, "Invalid bit!");
+static_assert(5U == gpio::Pin<Port::B5, gpio::Direction::Output>::Bit, "Invalid bit!");
+static_assert(0x20U == gpio::Pin<Port::B5, gpio::Direction::Output>::Mask, "Invalid mask!");
+
+/**
+ * @brief Compile-time GPIO output test.
+ *
+ *        Verify that outputs bound at compile time configure and drive the associated pin.
+ */
+TEST(Gpio_Pin, Output)
+{
+    constexpr std::uint8_t bit{5U};
+    PINB = 0U;
+
+    // Limit the scope of the GPIO instance.
+    {
+        gpio::Pin<Port::B5, gpio::Direction::Output> led{};
+        EXPECT_TRUE(led.isInitialized());
+        EXPECT_TRUE(utils::read(DDRB, bit));
+
+        // Case 1 - Set the output high, expect the bit in PORTB to be set.
+        led.write(true);
+        EXPECT_TRUE(utils::read(PORTB, bit));
+
+        // Case 2 - Set the output low, expect the bit in PORTB to be cleared.
+        led.clear();
+        EXPECT_FALSE(utils::read(PORTB, bit));
+
+        // Case 3 - Toggle the output, expect the bit in PINB to be set.
+        led.toggle();
+        EXPECT_TRUE(utils::read(PINB, bit));
+        PINB = 0U;
+
+        // Case 4 - Verify that the pin is reserved, i.e. no other GPIO can use it.
+        gpio::Atmega328p other{Port::B5, gpio::Direction::Output};
+        EXPECT_FALSE(other.isInitialized());
+    }
+    // Expect DDRB and PORTB to be cleared and the pin to be released after deletion.
+    EXPECT_FALSE(utils::read(DDRB, bit));
+    EXPECT_FALSE(utils::read(PORTB, bit));
+
+    gpio::Atmega328p other{Port::B5, gpio::Direction::Output};
+    EXPECT_TRUE(other.isInitialized());
+
+    // Expect a GPIO bound at compile time to a pin already in use not to be initialized.
+    gpio::Pin<Port::B5, gpio::Direction::Output> led{};
+    EXPECT_FALSE(led.isInitialized());
+}
+
+/**
+ * @brief Compile-time GPIO input test.
+ *
+ *        Verify that inputs bound at compile time configure and read the associated pin.
+ */
+TEST(Gpio_Pin, Input)
+{
+    constexpr std::uint8_t bit{3U};
+
+    // Limit the scope of the GPIO instance.
+    {
+        gpio::Pin<Port::C3, gpio::Direction::InputPullup> button{};
+        EXPECT_TRUE(button.isInitialized());
+        EXPECT_FALSE(utils::read(DDRC, bit));
+        EXPECT_TRUE(utils::read(PORTC, bit));
+
+        // Case 1 - Set and clear the input, expect the GPIO to follow.
+        utils::set(PINC, bit);
+        EXPECT_TRUE(button.read());
+        utils::clear(PINC, bit);
+        EXPECT_FALSE(button.read());
+
+        // Case 2 - Enable pin change interrupt, expect the mask and control bits to be set.
+        button.enableInterrupt(true);
+        EXPECT_TRUE(utils::read(PCMSK1, bit));
+        EXPECT_TRUE(utils::read(PCICR, PCIE1));
+        button.enableInterrupt(false);
+        EXPECT_FALSE(utils::read(PCMSK1, bit));
+    }
+    // Expect PORTC to be cleared after deletion.
+    EXPECT_FALSE(utils::read(PORTC, bit));
+}
+
+/**
+ * @brief Compile-time GPIO adapter test.
+ *
+ *        Verify that GPIOs bound at compile time can be used via the GPIO interface.
+ */
+TEST(Gpio_Pin, Adapter)
+{
+    constexpr std::uint8_t outputBit{2U};
+    constexpr std::uint8_t inputBit{3U};
+
+    gpio::Pin<Port::D2, gpio::Direction::Output> output{};
+    gpio::Pin<Port::D3, gpio::Direction::Input> input{};
+    gpio::PinAdapter<decltype(output)> outputAdapter{output};
+    gpio::PinAdapter<decltype(input)> inputAdapter{input};
+    gpio::Interface& outputGpio{outputAdapter};
+    gpio::Interface& inputGpio{inputAdapter};
+
+    EXPECT_TRUE(outputGpio.isInitialized());
+    EXPECT_EQ(gpio::Direction::Output, outputGpio.direction());
+    EXPECT_EQ(gpio::Direction::Input, inputGpio.direction());
+
+    // Case 1 - Write to the output via the interface, expect the output to change.
+    outputGpio.write(true);
+    EXPECT_TRUE(utils::read(PORTD, outputBit));
+    outputGpio.write(false);
+    EXPECT_FALSE(utils::read(PORTD, outputBit));
+
+    // Case 2 - Write to the input via the interface, expect the operation to be ignored.
+    inputGpio.write(true);
+    EXPECT_FALSE(utils::read(PORTD, inputBit));
+
+    // Case 3 - Read the input via the interface.
+    utils::set(PIND, inputBit);
+    EXPECT_TRUE(inputGpio.read());
+    utils::clear(PIND, inputBit);
+    EXPECT_FALSE(inputGpio.read());
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,113 @@
+/**
+ * @brief Unit tests for GPIO pin groups.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/gpio/atmega328p.h"
+#include "driver/gpio/port_group.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+using Port = gpio::Atmega328p::Port;
+
+/**
+ * @brief Pin group initialization test.
+ *
+ *        Verify that only groups of valid and free pins on the same I/O port are initialized.
+ */
+TEST(Gpio_PortGroup, Initialization)
+{
+    // Case 1 - Verify that invalid pin sets are rejected.
+    {
+        constexpr std::uint8_t mixedPorts[]{Port::D2, Port::B0};
+        constexpr std::uint8_t invalidPin[]{Port::D2, 20U};
+        constexpr std::uint8_t duplicates[]{Port::D2, Port::D2};
+        EXPECT_FALSE((gpio::PortGroup{mixedPorts, 2U, gpio::Direction::Output}.isInitialized()));
+        EXPECT_FALSE((gpio::PortGroup{invalidPin, 2U, gpio::Direction::Output}.isInitialized()));
+        EXPECT_FALSE((gpio::PortGroup{duplicates, 2U, gpio::Direction::Output}.isInitialized()));
+        EXPECT_FALSE((gpio::PortGroup{nullptr, 0U, gpio::Direction::Output}.isInitialized()));
+        EXPECT_FALSE((gpio::PortGroup{mixedPorts, 1U, gpio::Direction::Count}.isInitialized()));
+    }
+
+    // Case 2 - Verify that the pins of rejected groups aren't left reserved.
+    {
+        gpio::Atmega328p gpio{Port::D2, gpio::Direction::Output};
+        EXPECT_TRUE(gpio.isInitialized());
+    }
+
+    // Case 3 - Verify that pins in use can't be added to a group and vice versa.
+    {
+        constexpr std::uint8_t pins[]{Port::C0, Port::C1, Port::C2};
+        gpio::Atmega328p gpio{Port::C1, gpio::Direction::Output};
+        EXPECT_FALSE((gpio::PortGroup{pins, 3U, gpio::Direction::Output}.isInitialized()));
+    }
+    {
+        constexpr std::uint8_t pins[]{Port::C0, Port::C1, Port::C2};
+        gpio::PortGroup group{pins, 3U, gpio::Direction::InputPullup};
+        ASSERT_TRUE(group.isInitialized());
+        EXPECT_EQ(0x07U, group.mask());
+        EXPECT_EQ(0x07U, PORTC & 0x07U);
+        EXPECT_FALSE(gpio::Atmega328p(Port::C2, gpio::Direction::Output).isInitialized());
+    }
+    // Expect the pins to be released and reset after the group has been deleted.
+    EXPECT_EQ(0U, PORTC & 0x07U);
+    EXPECT_TRUE(gpio::Atmega328p(Port::C2, gpio::Direction::Output).isInitialized());
+}
+
+/**
+ * @brief Pin group I/O test.
+ *
+ *        Verify that the pins of a group are read, written and toggled at once.
+ */
+TEST(Gpio_PortGroup, ReadWrite)
+{
+    constexpr std::uint8_t pins[]{Port::B0, Port::B1, Port::B2, Port::B3};
+    constexpr std::uint8_t groupMask{0x0FU};
+    gpio::PortGroup bus{pins, 4U, gpio::Direction::Output};
+    ASSERT_TRUE(bus.isInitialized());
+    EXPECT_EQ(groupMask, bus.mask());
+    EXPECT_EQ(groupMask, DDRB & groupMask);
+    EXPECT_EQ(0x20U, gpio::PortGroup::pinMask(Port::B5));
+    EXPECT_EQ(0U, gpio::PortGroup::pinMask(20U));
+
+    // Case 1 - Write all pins, expect the pins outside the group to be unaffected.
+    PORTB = 0x20U;
+    bus.write(0xFFU, 0x0AU);
+    EXPECT_EQ(0x2AU, PORTB);
+
+    // Case 2 - Write some pins, expect the other pins to be unaffected.
+    bus.write(0x03U, 0x01U);
+    EXPECT_EQ(0x29U, PORTB);
+
+    // Case 3 - Toggle pins, expect only the pins in the group to be written to PINB.
+    PINB = 0U;
+    bus.toggle(0xF1U);
+    EXPECT_EQ(0x01U, PINB);
+
+    // Case 4 - Read the pins, expect the pins outside the group to be masked.
+    PINB = 0xF5U;
+    EXPECT_EQ(0x05U, bus.read());
+    PINB = 0U;
+
+    // Case 5 - Verify that inputs can't be written.
+    {
+        constexpr std::uint8_t inputs[]{Port::D4, Port::D5};
+        gpio::PortGroup group{inputs, 2U, gpio::Direction::Input};
+        ASSERT_TRUE(group.isInitialized());
+        PORTD = 0U;
+        group.write(0xFFU, 0xFFU);
+        EXPECT_EQ(0U, PORTD);
+    }
+    PORTB = 0U;
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
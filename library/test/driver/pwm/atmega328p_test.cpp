@@ -0,0 +1,215 @@
+/**
+ * @brief Unit tests for the ATmega328p PWM driver.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/pwm/atmega328p.h"
+#include "driver/timer/atmega328p.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/**
+ * @brief PWM initialization test.
+ * 
+ *        Verify that PWM outputs are only initialized for valid pins and frequencies.
+ */
+TEST(Pwm_Atmega328p, Initialization)
+{
+    // Case 1 - Verify that only pins connected to output compare units can be used.
+    {
+        pwm::Atmega328p pwm{7U, 1000U};
+        EXPECT_FALSE(pwm.isInitialized());
+        EXPECT_EQ(0U, pwm.frequency_Hz());
+        EXPECT_FALSE(pwm.setDutyCycle(0.5));
+    }
+
+    // Case 2 - Verify that invalid frequencies are rejected.
+    {
+        pwm::Atmega328p zero{9U, 0U};
+        pwm::Atmega328p tooHigh{9U, 20000000UL};
+        EXPECT_FALSE(zero.isInitialized());
+        EXPECT_FALSE(tooHigh.isInitialized());
+    }
+
+    // Case 3 - Verify that low frequencies are generated by prescaling the timer clock.
+    {
+        pwm::Atmega328p pwm{10U, 1U};
+        EXPECT_TRUE(pwm.isInitialized());
+        EXPECT_EQ(1U, pwm.frequency_Hz());
+        EXPECT_EQ((1U << WGM13) | (1U << WGM12) | (1U << CS12), TCCR1B);
+        EXPECT_EQ(62499U, ICR1);
+    }
+
+    // Case 4 - Verify that each pin can only be used once.
+    {
+        pwm::Atmega328p pwm1{9U, 1000U};
+        pwm::Atmega328p pwm2{9U, 1000U};
+        EXPECT_TRUE(pwm1.isInitialized());
+        EXPECT_FALSE(pwm2.isInitialized());
+    }
+}
+
+/**
+ * @brief PWM Timer 1 test.
+ * 
+ *        Verify that Timer 1 generates the requested frequency with 16-bit resolution.
+ */
+TEST(Pwm_Atmega328p, Timer1)
+{
+    // Create a 1 kHz PWM output with 25 % duty cycle on pin 9 (OC1A).
+    pwm::Atmega328p pwm{9U, 1000U, 0.25, true};
+    EXPECT_TRUE(pwm.isInitialized());
+    EXPECT_TRUE(pwm.isEnabled());
+    EXPECT_EQ(1000U, pwm.frequency_Hz());
+    EXPECT_DOUBLE_EQ(0.25, pwm.dutyCycle());
+
+    // Expect fast PWM mode with ICR1 as top value and no prescaler, i.e. 16000 counts per period.
+    EXPECT_EQ((1U << WGM11) | (1U << COM1A1), TCCR1A);
+    EXPECT_EQ((1U << WGM13) | (1U << WGM12) | (1U << CS10), TCCR1B);
+    EXPECT_EQ(15999U, ICR1);
+    EXPECT_EQ(3999U, OCR1A);
+    EXPECT_TRUE(utils::read(DDRB, 1U));
+
+    // Case 1 - Verify that the other output of the circuit requires the same frequency.
+    {
+        pwm::Atmega328p other{10U, 2000U};
+        EXPECT_FALSE(other.isInitialized());
+    }
+    {
+        pwm::Atmega328p other{10U, 1000U, 0.5, true};
+        EXPECT_TRUE(other.isInitialized());
+        EXPECT_EQ(7999U, OCR1B);
+        EXPECT_TRUE(utils::read(TCCR1A, COM1B1));
+    }
+
+    // Expect the circuit to remain configured when the other output is released.
+    EXPECT_FALSE(utils::read(TCCR1A, COM1B1));
+    EXPECT_EQ(15999U, ICR1);
+
+    // Case 2 - Verify that the output is disconnected when disabled.
+    pwm.setEnabled(false);
+    EXPECT_FALSE(utils::read(TCCR1A, COM1A1));
+    pwm.setEnabled(true);
+    EXPECT_TRUE(utils::read(TCCR1A, COM1A1));
+}
+
+/**
+ * @brief PWM Timer 1 max resolution test.
+ * 
+ *        Verify that the full duty cycle range is supported at the highest top value of Timer 1.
+ */
+TEST(Pwm_Atmega328p, Timer1MaxTop)
+{
+    // Create a 245 Hz PWM output on pin 9 (OC1A), which gives the highest reachable top value.
+    pwm::Atmega328p pwm{9U, 245U, 0.0, true};
+    EXPECT_TRUE(pwm.isInitialized());
+    EXPECT_EQ(65305U, ICR1);
+    EXPECT_EQ((1U << WGM13) | (1U << WGM12) | (1U << CS10), TCCR1B);
+
+    // Case 1 - Verify that 100 % duty cycle keeps the output connected with compare value top.
+    EXPECT_TRUE(pwm.setDutyCycle(1.0));
+    EXPECT_EQ(65305U, OCR1A);
+    EXPECT_TRUE(utils::read(TCCR1A, COM1A1));
+    EXPECT_DOUBLE_EQ(1.0, pwm.dutyCycle());
+
+    // Case 2 - Verify that a duty cycle rounding up to the full period is handled the same way.
+    EXPECT_TRUE(pwm.setDutyCycle(0.999999));
+    EXPECT_EQ(65305U, OCR1A);
+    EXPECT_TRUE(utils::read(TCCR1A, COM1A1));
+    EXPECT_DOUBLE_EQ(1.0, pwm.dutyCycle());
+
+    // Case 3 - Verify that 0 % duty cycle disconnects the output.
+    EXPECT_TRUE(pwm.setDutyCycle(0.0));
+    EXPECT_FALSE(utils::read(TCCR1A, COM1A1));
+}
+
+/**
+ * @brief PWM duty cycle test.
+ * 
+ *        Verify that the 8-bit timers use the closest frequency and that the duty cycle 
+ *        can be updated.
+ */
+TEST(Pwm_Atmega328p, DutyCycle)
+{
+    // Create a PWM output on pin 6 (OC0A), expect the closest frequency 976.5 Hz (prescaler 64).
+    pwm::Atmega328p pwm{6U, 1000U};
+    EXPECT_TRUE(pwm.isInitialized());
+    EXPECT_FALSE(pwm.isEnabled());
+    EXPECT_EQ(977U, pwm.frequency_Hz());
+    EXPECT_EQ((1U << WGM01) | (1U << WGM00), TCCR0A);
+    EXPECT_EQ((1U << CS01) | (1U << CS00), TCCR0B);
+
+    // Case 1 - Verify that the output stays disconnected at 0 % duty cycle.
+    pwm.setEnabled(true);
+    EXPECT_FALSE(utils::read(TCCR0A, COM0A1));
+
+    // Case 2 - Verify that 100 % duty cycle results in compare value 0xFF.
+    EXPECT_TRUE(pwm.setDutyCycle(1.0));
+    EXPECT_EQ(255U, OCR0A);
+    EXPECT_TRUE(utils::read(TCCR0A, COM0A1));
+    EXPECT_DOUBLE_EQ(1.0, pwm.dutyCycle());
+
+    // Case 3 - Verify that the duty cycle is rounded to the nearest count.
+    EXPECT_TRUE(pwm.setDutyCycle(0.5));
+    EXPECT_EQ(127U, OCR0A);
+    EXPECT_DOUBLE_EQ(0.5, pwm.dutyCycle());
+
+    // Case 4 - Verify that invalid duty cycles are rejected.
+    EXPECT_FALSE(pwm.setDutyCycle(-0.1));
+    EXPECT_FALSE(pwm.setDutyCycle(1.1));
+    EXPECT_DOUBLE_EQ(0.5, pwm.dutyCycle());
+
+    // Case 5 - Verify that Timer 2 supports additional prescalers.
+    pwm::Atmega328p pwm2{3U, 2000U, 0.5, true};
+    EXPECT_TRUE(pwm2.isInitialized());
+    EXPECT_EQ(1953U, pwm2.frequency_Hz());
+    EXPECT_EQ((1U << CS21) | (1U << CS20), TCCR2B);
+    EXPECT_TRUE(utils::read(TCCR2A, COM2B1));
+}
+
+/**
+ * @brief PWM reservation test.
+ * 
+ *        Verify that timer circuits are either used for PWM generation or by timers.
+ */
+TEST(Pwm_Atmega328p, Reservation)
+{
+    // Case 1 - Verify that timers can't use circuits reserved for PWM generation.
+    {
+        pwm::Atmega328p pwm{9U, 1000U};
+        EXPECT_TRUE(pwm.isInitialized());
+
+        timer::Atmega328p timer0{10U};
+        timer::Atmega328p timer1{10U};
+        timer::Atmega328p timer2{10U};
+        EXPECT_TRUE(timer0.isInitialized());
+        EXPECT_TRUE(timer1.isInitialized());
+        EXPECT_FALSE(timer2.isInitialized());
+
+        // Expect PWM generation to be unavailable on circuits used by timers.
+        pwm::Atmega328p other{6U, 1000U};
+        EXPECT_FALSE(other.isInitialized());
+    }
+
+    // Case 2 - Verify that the circuit is released along with the PWM output.
+    {
+        timer::Atmega328p timer0{10U};
+        timer::Atmega328p timer1{10U};
+        timer::Atmega328p timer2{10U};
+        EXPECT_TRUE(timer2.isInitialized());
+        EXPECT_EQ(0U, TCCR1A);
+        EXPECT_EQ(0U, ICR1);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,104 @@
+/**
+ * @brief Unit tests for the ATmega328p reset cause driver.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/reset/atmega328p.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+reset::Interface& simulateReset(const std::uint8_t resetFlag) noexcept
+{
+    // Set the given reset flag and capture the reset cause as done at early boot.
+    MCUSR = 0U;
+    utils::set(MCUSR, resetFlag);
+    reset::Atmega328p::captureResetCause();
+    return reset::Atmega328p::getInstance();
+}
+
+/**
+ * @brief Reset cause test.
+ *
+ *        Verify that the reset cause is captured and that the reset flags are cleared.
+ */
+TEST(Reset_Atmega328p, Cause)
+{
+    reset::Interface& resetCause{reset::Atmega328p::getInstance()};
+    EXPECT_TRUE(resetCause.isInitialized());
+
+    // Case 1 - Simulate each type of reset, expect the corresponding cause to be reported.
+    EXPECT_EQ(reset::Cause::PowerOn, simulateReset(PORF).cause());
+    EXPECT_EQ(reset::Cause::BrownOut, simulateReset(BORF).cause());
+    EXPECT_EQ(reset::Cause::Watchdog, simulateReset(WDRF).cause());
+    EXPECT_EQ(reset::Cause::External, simulateReset(EXTRF).cause());
+
+    // Case 2 - Expect the reset flags to be cleared and the watchdog to be disabled.
+    EXPECT_EQ(0U, MCUSR);
+    EXPECT_FALSE(utils::read(WDTCSR, WDE));
+
+    // Case 3 - Simulate a reset without any reset flag set, expect an unknown cause.
+    MCUSR = 0U;
+    reset::Atmega328p::captureResetCause();
+    EXPECT_EQ(reset::Cause::Unknown, resetCause.cause());
+
+    // Case 4 - Simulate several flags set, expect the power-on reset to take precedence.
+    utils::set(MCUSR, WDRF, PORF);
+    reset::Atmega328p::captureResetCause();
+    EXPECT_EQ(reset::Cause::PowerOn, resetCause.cause());
+}
+
+/**
+ * @brief Crash record test.
+ *
+ *        Verify that the crash record survives warm resets only.
+ */
+TEST(Reset_Atmega328p, CrashRecord)
+{
+    constexpr std::uint16_t programCounter{0x1234U};
+    reset::CrashRecord record{};
+
+    // Case 1 - Simulate a power-on reset, expect no crash record to be available.
+    reset::Interface& resetCause{simulateReset(PORF)};
+    EXPECT_FALSE(resetCause.crashRecord(record));
+
+    // Case 2 - Record events at different stack depths and a watchdog timeout, then simulate
+    //          a watchdog reset. Expect the crash record to hold the last event, the program
+    //          counter and the max stack usage.
+    SP = RAMEND - 100U;
+    resetCause.recordEvent(3U);
+    SP = RAMEND - 40U;
+    resetCause.recordEvent(5U);
+    reset::Atmega328p::recordWatchdogTimeout(programCounter);
+    EXPECT_FALSE(resetCause.crashRecord(record));
+
+    (void) (simulateReset(WDRF));
+    ASSERT_TRUE(resetCause.crashRecord(record));
+    EXPECT_EQ(5U, record.lastEvent);
+    EXPECT_EQ(programCounter, record.programCounter);
+    EXPECT_EQ(100U, record.stackHighWater);
+
+    // Case 3 - Simulate an external reset without new events, expect a cleared crash record.
+    (void) (simulateReset(EXTRF));
+    ASSERT_TRUE(resetCause.crashRecord(record));
+    EXPECT_EQ(0U, record.lastEvent);
+    EXPECT_EQ(0U, record.programCounter);
+    EXPECT_EQ(0U, record.stackHighWater);
+
+    // Case 4 - Simulate a brown-out reset, expect the crash record to be discarded.
+    (void) (simulateReset(BORF));
+    EXPECT_FALSE(resetCause.crashRecord(record));
+    SP = 0U;
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -37,36 +37,6 @@ void delay_us(const std::size_t duration_us) noexcept
     std::this_thread::sleep_for(std::chrono::microseconds(duration_us));
 }
 
-// -----------------------------------------------------------------------------
-void simulateDataReg(const bool& stop) noexcept
-{
-    std::uint8_t prevByte{};
-
-    // Initialize UDR0 to 0 and set UDRE0 (data register empty, ready to write).
-    UDR0 = 0U;
-    utils::set(UCSR0A, UDRE0);
-
-    // Clear UDRE0 when UDR0 changes to simulate that the data register is full.
-    while (!stop)
-    {
-        constexpr std::size_t loopInterval_us{1U};
-
-        // Read the current byte from UDR0.
-        const std::uint8_t byte{UDR0};
-
-        // Check if UDR0 has changed and is non-zero (new data written).
-        if ((byte != prevByte) && (0U != byte))
-        {
-            prevByte = byte;
-            
-            // Simulate transmission delay, then mark that the data register is full.
-            delay_us(TransmissionDelay_us);
-            utils::clear(UCSR0A, UDRE0);
-        }
-        delay_us(loopInterval_us);
-    }
-}
-
 // -----------------------------------------------------------------------------
 void printThread(serial::Interface& serial, const std::string& msg, bool& stop) noexcept
 {
@@ -85,9 +55,13 @@ void readDataRegThread(const std::string& msg, const bool& stop) noexcept
     // Iterate through each character in the message.
     for (const auto& c : msg)
     {
-        // Wait until data is available (UDRE0 is cleared by the hardware simulator).
+        // Wait until data is available, i.e. UDRE0 is cleared (the driver writes zero to the 
+        // status bits when clearing TXC0) and a new character has been written to UDR0.
         // Also check the stop flag to allow early termination.
-        while (utils::read(UCSR0A, UDRE0) && !stop) { delay_us(TransmissionDelay_us); }
+        while ((utils::read(UCSR0A, UDRE0) || (0U == UDR0)) && !stop) 
+        { 
+            delay_us(TransmissionDelay_us); 
+        }
 
         // If stop flag is set, break out of the loop.
         if (stop) { break; }
@@ -95,6 +69,7 @@ void readDataRegThread(const std::string& msg, const bool& stop) noexcept
         // Read the character from UDR0 and verify it matches the expected character.
         const char actualChar{static_cast<char>(UDR0)};
         EXPECT_EQ(c, actualChar);
+        UDR0 = 0U;
         
         // Set UDRE0 to signal that the data has been read and the register is empty.
         utils::set(UCSR0A, UDRE0);
@@ -142,15 +117,17 @@ TEST(Serial_Atmega328p, Transmit)
     // Stop flag shared between threads.
     bool stopFlag{false};
     
+    // Initialize UDR0 to 0 and set UDRE0 (data register empty, ready to write).
+    UDR0 = 0U;
+    utils::set(UCSR0A, UDRE0);
+
     // Create threads to simulate data transmission.
-    std::thread t1{simulateDataReg, std::ref(stopFlag)};
-    std::thread t2{printThread, std::ref(serial), std::ref(msg), std::ref(stopFlag)};
-    std::thread t3{readDataRegThread, std::ref(msg), std::ref(stopFlag)};
+    std::thread t1{printThread, std::ref(serial), std::ref(msg), std::ref(stopFlag)};
+    std::thread t2{readDataRegThread, std::ref(msg), std::ref(stopFlag)};
 
     // Synchronize the threads.
     t1.join();
     t2.join();
-    t3.join();
 }
 
 //! @todo Add more tests here!
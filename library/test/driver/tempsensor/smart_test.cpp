@@ -204,6 +204,62 @@ TEST(TempSensor_Smart, HappyPath)
         EXPECT_EQ(tempSensor->read(), expectedTemp);
     }
 }
+
+/**
+ * @brief Smart temp sensor recalibration test.
+ * 
+ *        Verify that the temp sensor can be recalibrated online with reference temperatures,
+ *        both with an untrained model and after the sensor has drifted.
+ */
+TEST(TempSensor_Smart, Recalibration)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+
+    // Set up the ADC.
+    adc::Stub adc{};
+    adc.setInitialized(true);
+    adc.setChannelValidity(true);
+
+    // Set up the temp sensor with an untrained model, expect it to not be initialized.
+    ml::lin_reg::Fixed linReg{};
+    tempsensor::Smart tempSensor{tempSensorPin, adc, linReg};
+    EXPECT_FALSE(tempSensor.isInitialized());
+
+    // Case 1 - Calibrate the untrained model with two reference temperatures.
+    {
+        adc.setValue(100U);
+        EXPECT_FALSE(tempSensor.recalibrate(convertToTemp(std::uint16_t{100U})));
+        adc.setValue(300U);
+        EXPECT_TRUE(tempSensor.recalibrate(convertToTemp(std::uint16_t{300U})));
+        EXPECT_TRUE(tempSensor.isInitialized());
+
+        // Expect the temperature to be predicted within one degree (references are rounded).
+        for (std::uint16_t adcVal{}; adcVal <= 1000U; adcVal += 50U)
+        {
+            adc.setValue(adcVal);
+            EXPECT_NEAR(convertToTemp(adcVal), tempSensor.read(), 1);
+        }
+    }
+
+    // Case 2 - Simulate that the sensor reads 5 degrees too high, recalibrate repeatedly.
+    {
+        for (std::uint16_t adcVal{}; adcVal <= 1000U; adcVal += 50U)
+        {
+            adc.setValue(adcVal);
+            EXPECT_TRUE(tempSensor.recalibrate(convertToTemp(adcVal) - 5));
+        }
+
+        // Expect the predicted temperature to follow the references.
+        adc.setValue(500U);
+        EXPECT_NEAR(convertToTemp(std::uint16_t{500U}) - 5, tempSensor.read(), 3);
+    }
+
+    // Case 3 - Expect the recalibration to fail if the ADC isn't initialized.
+    {
+        adc.setInitialized(false);
+        EXPECT_FALSE(tempSensor.recalibrate(0));
+    }
+}
 } // namespace
 } // namespace driver.
 
@@ -131,6 +131,67 @@ TEST(TempSensor_Tmp36, Accuracy)
         EXPECT_EQ(tempSensor->read(), expectedTemp);
     }
 }
+
+/**
+ * @brief Temp sensor lookup table test.
+ * 
+ *        Verify that the integer conversion matches the floating-point formula for every 
+ *        ADC count, both in whole degrees and in tenths of a degree.
+ */
+TEST(TempSensor_Tmp36, LookupTable)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+    constexpr std::uint16_t adcMax{1023U};
+
+    // Set up the ADC and the temp sensor.
+    adc::Stub adc{};
+    tempsensor::Tmp36 tempSensor{tempSensorPin, adc};
+    EXPECT_TRUE(tempSensor.isInitialized());
+
+    // Try every ADC value.
+    for (std::uint16_t adcVal{}; adcVal <= adcMax; ++adcVal)
+    {
+        adc.setValue(adcVal);
+
+        // Expect the rounded temperature to match the floating-point formula exactly.
+        EXPECT_EQ(tempSensor.read(), convertToTemp(adcVal));
+
+        // Expect the temperature in tenths to be within a tenth of a degree.
+        const double expectedTenths{1000.0 * computeInputVoltage(adcVal) - 500.0};
+        EXPECT_NEAR(tempSensor.readTenths(), expectedTenths, 1.0);
+    }
+}
+
+/**
+ * @brief Temp sensor fallback test.
+ * 
+ *        Verify that the temp sensor predicts accurately when the ADC configuration doesn't 
+ *        match the lookup table, i.e. when the floating-point formula is used.
+ */
+TEST(TempSensor_Tmp36, Fallback)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+    constexpr std::uint8_t resolution{12U};
+    constexpr double supplyVoltage{3.3};
+    constexpr std::uint16_t adcMax{4095U};
+    constexpr std::size_t stepVal{15U};
+
+    // Set up a 12-bit ADC with a 3.3 V supply voltage and the temp sensor.
+    adc::Stub adc{resolution, supplyVoltage};
+    tempsensor::Tmp36 tempSensor{tempSensorPin, adc};
+    EXPECT_TRUE(tempSensor.isInitialized());
+
+    // Try different ADC values to simulate different input voltages.
+    for (std::uint16_t adcVal{}; adcVal <= adcMax; adcVal += stepVal)
+    {
+        adc.setValue(adcVal);
+        const double inputVoltage{adcVal * supplyVoltage / adcMax};
+
+        // Expect the temperature to follow the floating-point formula.
+        EXPECT_EQ(tempSensor.read(), convertToTemp(inputVoltage));
+        EXPECT_NEAR(tempSensor.readTenths(), 1000.0 * inputVoltage - 500.0, 1.0);
+    }
+}
 } // namespace
 } // namespace driver
 
@@ -223,6 +223,78 @@ TEST(Timer_Atmega328p, Restart)
     EXPECT_TRUE(callbackInvoked);
 }
 
+/**
+ * @brief Tickless mode test.
+ * 
+ *        Verify that timers in tickless mode only interrupt on timeout and counter overflow.
+ */
+TEST(Timer_Atmega328p, Tickless)
+{
+    // Case 1 - Verify that a short timeout requires a single interrupt.
+    {
+        resetCallbackFlag();
+        timer::Atmega328p timer0(10U, testCallback, true, timer::Atmega328p::Mode::Tickless);
+        EXPECT_TRUE(timer0.isInitialized());
+        EXPECT_EQ(timer::Atmega328p::Mode::Tickless, timer0.mode());
+
+        // Expect CTC mode with prescaler 1024 and the compare match interrupt enabled.
+        EXPECT_EQ((1U << WGM01), TCCR0A);
+        EXPECT_EQ((1U << CS02) | (1U << CS00), TCCR0B);
+        EXPECT_TRUE(utils::read(TIMSK0, OCIE0A));
+
+        // Expect the deadline to be 2 * 78 = 156 counts of 64 us away.
+        EXPECT_EQ(155U, OCR0A);
+        timer0.handleCallback();
+        EXPECT_TRUE(callbackInvoked);
+
+        // Expect the next period to be programmed after timeout.
+        EXPECT_EQ(155U, OCR0A);
+    }
+
+    // Case 2 - Verify that longer timeouts are split into counter overflows.
+    {
+        resetCallbackFlag();
+        timer::Atmega328p timer0(100U, testCallback, true, timer::Atmega328p::Mode::Tickless);
+
+        // 100 ms corresponds to 1562 counts, i.e. six overflows and one compare match.
+        for (std::uint8_t i{}; i < 6U; ++i)
+        {
+            EXPECT_EQ(255U, OCR0A);
+            timer0.handleCallback();
+            EXPECT_FALSE(callbackInvoked);
+        }
+        EXPECT_EQ(1562U - 6U * 256U - 1U, OCR0A);
+        timer0.handleCallback();
+        EXPECT_TRUE(callbackInvoked);
+
+        // Expect the callback not to be invoked when the timer is disabled.
+        resetCallbackFlag();
+        timer0.stop();
+        for (std::uint8_t i{}; i < 7U; ++i) { timer0.handleCallback(); }
+        EXPECT_FALSE(callbackInvoked);
+    }
+
+    // Case 3 - Verify that the 16-bit timer requires fewer interrupts for long timeouts.
+    {
+        resetCallbackFlag();
+        timer::Atmega328p timer0(10U);
+        timer::Atmega328p timer1(60000U, testCallback, true, timer::Atmega328p::Mode::Tickless);
+        EXPECT_EQ((1U << WGM12) | (1U << CS12) | (1U << CS10), TCCR1B);
+        EXPECT_TRUE(utils::read(TIMSK1, OCIE1A));
+
+        // 60 s corresponds to 937500 counts, i.e. 14 overflows and one compare match.
+        for (std::uint8_t i{}; i < 14U; ++i) 
+        {
+            EXPECT_EQ(65535U, OCR1A);
+            timer1.handleCallback(); 
+        }
+        EXPECT_FALSE(callbackInvoked);
+        EXPECT_EQ(937500UL - 14UL * 65536UL - 1UL, OCR1A);
+        timer1.handleCallback();
+        EXPECT_TRUE(callbackInvoked);
+    }
+}
+
 //! @todo Add more tests here (e.g., register verification, multiple timers running simultaneously).
 
 } // namespace
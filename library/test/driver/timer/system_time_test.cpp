@@ -0,0 +1,81 @@
+/**
+ * @brief Unit tests for the monotonic system time service.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/timer/system_time.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/**
+ * @brief System time initialization test.
+ * 
+ *        Verify that only one system time service can be used at a time.
+ */
+TEST(Timer_SystemTime, Initialization)
+{
+    // Create a system time service, expect it to be initialized and the uptime to be 0.
+    TCNT0 = 0U;
+    timer::SystemTime systemTime{};
+    EXPECT_TRUE(systemTime.isInitialized());
+    EXPECT_EQ(0U, systemTime.uptime_us());
+
+    // Expect another system time service to be uninitialized.
+    timer::SystemTime other{};
+    EXPECT_FALSE(other.isInitialized());
+    EXPECT_EQ(0U, other.uptime_ms());
+}
+
+/**
+ * @brief System time uptime test.
+ * 
+ *        Verify that the uptime is derived from the time base and the hardware counter.
+ */
+TEST(Timer_SystemTime, Uptime)
+{
+    // Clear the hardware counter and the pending interrupt flag of Timer 0.
+    TCNT0 = 0U;
+    utils::clear(TIFR0, TOV0);
+
+    timer::SystemTime systemTime{};
+    EXPECT_TRUE(systemTime.isInitialized());
+
+    // Case 1 - Verify that the hardware counter is counted in steps of 0.5 us.
+    TCNT0 = 100U;
+    EXPECT_EQ(50U, systemTime.uptime_us());
+
+    // Case 2 - Verify that a pending overflow is accounted for after the counter wrapped.
+    utils::set(TIFR0, TOV0);
+    TCNT0 = 10U;
+    EXPECT_EQ(128U + 5U, systemTime.uptime_us());
+
+    // Expect the pending overflow to be ignored before the counter wrapped.
+    TCNT0 = 250U;
+    EXPECT_EQ(125U, systemTime.uptime_us());
+    utils::clear(TIFR0, TOV0);
+
+    // Case 3 - Verify that the time base is advanced by 16 ms on each timeout.
+    for (std::uint32_t i{}; i < 1000U; ++i) { systemTime.handleTimeout(); }
+    TCNT0 = 0U;
+    EXPECT_EQ(16000000U, systemTime.uptime_us());
+    EXPECT_EQ(16000U, systemTime.uptime_ms());
+
+    // Case 4 - Verify that the uptime exceeds 32 bits without wrapping around.
+    for (std::uint32_t i{}; i < 300000U; ++i) { systemTime.handleTimeout(); }
+    EXPECT_EQ(301000ULL * 16000ULL, systemTime.uptime_us());
+
+    // Expect interrupts to be enabled after reading the uptime.
+    EXPECT_TRUE(utils::read(SREG, I_FLAG));
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,291 @@
+/**
+ * @brief Unit tests for the timer wheel and software timers.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/timer/atmega328p.h"
+#include "driver/timer/software.h"
+#include "driver/timer/wheel.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** The number of timers used in the expiry test. */
+constexpr std::size_t TimerCount{10U};
+
+/** Pointer to the wheel under test. */
+timer::Wheel* wheelUnderTest{nullptr};
+
+/** The number of timeouts of each timer. */
+std::uint32_t timeoutCount[TimerCount]{};
+
+/** Tick count at the last timeout of each timer. */
+std::uint32_t lastTimeout[TimerCount]{};
+
+/** Pointer to a timer to stop on timeout (used to simulate a one-shot timer). */
+timer::Interface* timerToStop{nullptr};
+
+// -----------------------------------------------------------------------------
+template <std::size_t Index>
+void countTimeout() noexcept
+{
+    timeoutCount[Index]++;
+    lastTimeout[Index] = wheelUnderTest->ticks();
+}
+
+// -----------------------------------------------------------------------------
+void stopTimer() noexcept
+{
+    // Expect the timeout to be indicated during the callback.
+    EXPECT_TRUE(timerToStop->hasTimedOut());
+    timerToStop->stop();
+}
+
+// -----------------------------------------------------------------------------
+void resetCounters() noexcept
+{
+    for (std::size_t i{}; i < TimerCount; ++i)
+    {
+        timeoutCount[i] = 0U;
+        lastTimeout[i]  = 0U;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void tick(timer::Wheel& wheel, const std::uint32_t tickCount) noexcept
+{
+    for (std::uint32_t i{}; i < tickCount; ++i) { wheel.tick(); }
+}
+
+/**
+ * @brief Timer wheel initialization test.
+ * 
+ *        Verify that the wheel only reserves one timer circuit, that only one wheel can be used
+ *        at a time and that software timers with invalid timeouts aren't initialized.
+ */
+TEST(Timer_Wheel, Initialization)
+{
+    // Case 1 - Expect the wheel to reserve one circuit, leaving two for hardware timers.
+    {
+        timer::Wheel wheel{};
+        EXPECT_TRUE(wheel.isInitialized());
+
+        timer::Atmega328p timer1{10U};
+        timer::Atmega328p timer2{10U};
+        timer::Atmega328p timer3{10U};
+        EXPECT_TRUE(timer1.isInitialized());
+        EXPECT_TRUE(timer2.isInitialized());
+        EXPECT_FALSE(timer3.isInitialized());
+    }
+
+    // Case 2 - Expect only one wheel to be used at a time.
+    {
+        timer::Wheel wheel1{};
+        timer::Wheel wheel2{};
+        EXPECT_TRUE(wheel1.isInitialized());
+        EXPECT_FALSE(wheel2.isInitialized());
+
+        // Expect software timers to be initialized if the wheel is initialized and the 
+        // timeout is valid.
+        timer::Software timer1{wheel1, 100U};
+        timer::Software timer2{wheel1, 0U};
+        timer::Software timer3{wheel2, 100U};
+        EXPECT_TRUE(timer1.isInitialized());
+        EXPECT_FALSE(timer2.isInitialized());
+        EXPECT_FALSE(timer3.isInitialized());
+
+        // Expect uninitialized timers not to start.
+        timer2.start();
+        timer3.start();
+        EXPECT_FALSE(timer2.isEnabled());
+        EXPECT_FALSE(timer3.isEnabled());
+    }
+
+    // Case 3 - Expect the circuit to be released with the wheel.
+    {
+        timer::Atmega328p timer1{10U};
+        timer::Atmega328p timer2{10U};
+        timer::Atmega328p timer3{10U};
+        EXPECT_TRUE(timer3.isInitialized());
+    }
+}
+
+/**
+ * @brief Timer wheel expiry test.
+ * 
+ *        Verify that timers on every level of the wheel time out at the exact tick and are 
+ *        restarted periodically.
+ */
+TEST(Timer_Wheel, Expiry)
+{
+    timer::Wheel wheel{};
+    wheelUnderTest = &wheel;
+    resetCounters();
+
+    // Use timeouts on and around the level boundaries.
+    constexpr std::uint32_t timeouts[TimerCount]{1U, 15U, 16U, 17U, 255U, 
+                                                 256U, 257U, 4097U, 65536U, 100000U};
+    timer::Software timer0{wheel, timeouts[0U], countTimeout<0U>, true};
+    timer::Software timer1{wheel, timeouts[1U], countTimeout<1U>, true};
+    timer::Software timer2{wheel, timeouts[2U], countTimeout<2U>, true};
+    timer::Software timer3{wheel, timeouts[3U], countTimeout<3U>, true};
+    timer::Software timer4{wheel, timeouts[4U], countTimeout<4U>, true};
+    timer::Software timer5{wheel, timeouts[5U], countTimeout<5U>, true};
+    timer::Software timer6{wheel, timeouts[6U], countTimeout<6U>, true};
+    timer::Software timer7{wheel, timeouts[7U], countTimeout<7U>, true};
+    timer::Software timer8{wheel, timeouts[8U], countTimeout<8U>, true};
+    timer::Software timer9{wheel, timeouts[9U], countTimeout<9U>, true};
+
+    // Advance the wheel, expect each timer to time out periodically at the exact tick.
+    constexpr std::uint32_t tickCount{200000U};
+    tick(wheel, tickCount);
+
+    for (std::size_t i{}; i < TimerCount; ++i)
+    {
+        const std::uint32_t expectedCount{tickCount / timeouts[i]};
+        EXPECT_EQ(expectedCount, timeoutCount[i]);
+        EXPECT_EQ(expectedCount * timeouts[i], lastTimeout[i]);
+    }
+    wheelUnderTest = nullptr;
+}
+
+/**
+ * @brief Timer wheel accuracy test.
+ * 
+ *        Verify that timers time out after their real timeout when the wheel is driven by a
+ *        hardware tick that isn't an exact millisecond, i.e. that the timers don't drift.
+ */
+TEST(Timer_Wheel, Accuracy)
+{
+    timer::Wheel wheel{};
+    wheelUnderTest = &wheel;
+    resetCounters();
+
+    // Use the tick interval of the hardware timer, i.e. eight 128 us intervals.
+    constexpr std::uint32_t hardwareTick_us{1024U};
+    constexpr std::uint32_t timeouts[]{10U, 100U, 60000U};
+
+    timer::Software timer0{wheel, timeouts[0U], countTimeout<0U>, true};
+    timer::Software timer1{wheel, timeouts[1U], countTimeout<1U>, true};
+    timer::Software timer2{wheel, timeouts[2U], countTimeout<2U>, true};
+    std::uint32_t firstTimeout_us[sizeof(timeouts) / sizeof(timeouts[0U])]{};
+
+    // Advance the wheel by hardware ticks, record the real time of the first timeout of each
+    // timer. Expect each timeout within one hardware tick after the real timeout.
+    for (std::uint32_t time_us{hardwareTick_us}; time_us <= 64000000UL; 
+         time_us += hardwareTick_us)
+    {
+        wheel.elapse(hardwareTick_us);
+
+        for (std::size_t i{}; i < sizeof(timeouts) / sizeof(timeouts[0U]); ++i)
+        {
+            if ((0U == firstTimeout_us[i]) && (0U < timeoutCount[i])) 
+            { 
+                firstTimeout_us[i] = time_us; 
+            }
+        }
+    }
+
+    for (std::size_t i{}; i < sizeof(timeouts) / sizeof(timeouts[0U]); ++i)
+    {
+        const std::uint32_t timeout_us{timeouts[i] * 1000U};
+        EXPECT_LE(timeout_us, firstTimeout_us[i]);
+        EXPECT_GT(timeout_us + hardwareTick_us, firstTimeout_us[i]);
+    }
+
+    // Expect the timers to keep their period, e.g. 6400 timeouts of the 10 ms timer in 64 s
+    // (exactly 62500 hardware ticks).
+    EXPECT_EQ(6400U, timeoutCount[0U]);
+    EXPECT_EQ(640U, timeoutCount[1U]);
+    EXPECT_EQ(1U, timeoutCount[2U]);
+    wheelUnderTest = nullptr;
+}
+
+/**
+ * @brief Software timer control test.
+ * 
+ *        Verify that software timers can be stopped, restarted and toggled, also from within 
+ *        their callbacks.
+ */
+TEST(Timer_Wheel, Control)
+{
+    timer::Wheel wheel{};
+    wheelUnderTest = &wheel;
+    resetCounters();
+
+    // Case 1 - Stop a timer before its timeout, expect no timeout.
+    {
+        timer::Software timer{wheel, 10U, countTimeout<0U>, true};
+        EXPECT_TRUE(timer.isEnabled());
+        tick(wheel, 9U);
+        timer.stop();
+        EXPECT_FALSE(timer.isEnabled());
+        tick(wheel, 100U);
+        EXPECT_EQ(0U, timeoutCount[0U]);
+    }
+
+    // Case 2 - Restart a timer just before its timeout, expect the timeout to be postponed.
+    {
+        timer::Software timer{wheel, 10U, countTimeout<1U>, true};
+        tick(wheel, 9U);
+        timer.restart();
+        tick(wheel, 9U);
+        EXPECT_EQ(0U, timeoutCount[1U]);
+        tick(wheel, 1U);
+        EXPECT_EQ(1U, timeoutCount[1U]);
+
+        // Change the timeout, expect it to be used once the current period has elapsed.
+        timer.setTimeout_ms(20U);
+        timer.setTimeout_ms(0U);
+        EXPECT_EQ(20U, timer.timeout_ms());
+        tick(wheel, 10U);
+        EXPECT_EQ(2U, timeoutCount[1U]);
+        tick(wheel, 19U);
+        EXPECT_EQ(2U, timeoutCount[1U]);
+        tick(wheel, 1U);
+        EXPECT_EQ(3U, timeoutCount[1U]);
+    }
+
+    // Case 3 - Toggle a timer, expect it to be stopped and started.
+    {
+        timer::Software timer{wheel, 5U, countTimeout<2U>};
+        EXPECT_FALSE(timer.isEnabled());
+        timer.toggle();
+        EXPECT_TRUE(timer.isEnabled());
+        tick(wheel, 5U);
+        EXPECT_EQ(1U, timeoutCount[2U]);
+        timer.toggle();
+        EXPECT_FALSE(timer.isEnabled());
+        tick(wheel, 50U);
+        EXPECT_EQ(1U, timeoutCount[2U]);
+    }
+
+    // Case 4 - Stop a timer from its callback, expect a single timeout (one-shot timer).
+    {
+        timer::Software timer{wheel, 3U, stopTimer, true};
+        timerToStop = &timer;
+        tick(wheel, 3U);
+        EXPECT_FALSE(timer.isEnabled());
+        EXPECT_FALSE(timer.hasTimedOut());
+        timerToStop = nullptr;
+    }
+
+    // Case 5 - Destroy a running timer, expect it to be removed from the wheel.
+    {
+        {
+            timer::Software timer{wheel, 10U, countTimeout<3U>, true};
+        }
+        tick(wheel, 100U);
+        EXPECT_EQ(0U, timeoutCount[3U]);
+    }
+    wheelUnderTest = nullptr;
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -14,8 +14,20 @@
 
 namespace driver
 {
+namespace watchdog
+{
+/** Watchdog timeout interrupt service routine. */
+void WDT_vect() noexcept;
+} // namespace watchdog
+
 namespace
 {
+/** The number of times the timeout callback has been invoked. */
+std::uint8_t myTimeoutCount{};
+
+// -----------------------------------------------------------------------------
+void countTimeout() { myTimeoutCount++; }
+
 using Timeout = watchdog::Atmega328p::Timeout;
 
 // -----------------------------------------------------------------------------
@@ -176,6 +188,46 @@ TEST(Watchdog_Atmega328p, Timeout)
         }
     }
 }
+
+/**
+ * @brief Watchdog timeout callback test.
+ * 
+ *        Verify that the watchdog operates in interrupt-then-reset mode with a timeout callback.
+ */
+TEST(Watchdog_Atmega328p, TimeoutCallback)
+{
+    watchdog::Interface& watchdog{initWatchdog()};
+    watchdog.setEnabled(true);
+    EXPECT_FALSE(utils::read(WDTCSR, WDIE));
+
+    // Case 1 - Set a callback, expect the timeout interrupt to be enabled.
+    watchdog.setTimeoutCallback(countTimeout);
+    EXPECT_TRUE(utils::read(WDTCSR, WDE));
+    EXPECT_TRUE(utils::read(WDTCSR, WDIE));
+
+    // Case 2 - Simulate a timeout, expect the callback to be invoked.
+    utils::clear(WDTCSR, WDIE);
+    watchdog::WDT_vect();
+    EXPECT_EQ(1U, myTimeoutCount);
+
+    // Case 3 - Reset the watchdog, expect the timeout interrupt to be re-armed.
+    watchdog.reset();
+    EXPECT_TRUE(utils::read(WDTCSR, WDIE));
+
+    // Case 4 - Disable and re-enable the watchdog, expect the interrupt to follow.
+    watchdog.setEnabled(false);
+    EXPECT_FALSE(utils::read(WDTCSR, WDIE));
+    watchdog.setEnabled(true);
+    EXPECT_TRUE(utils::read(WDTCSR, WDIE));
+
+    // Case 5 - Remove the callback, expect reset mode only.
+    watchdog.setTimeoutCallback(nullptr);
+    EXPECT_FALSE(utils::read(WDTCSR, WDIE));
+    EXPECT_TRUE(utils::read(WDTCSR, WDE));
+    watchdog::WDT_vect();
+    EXPECT_EQ(1U, myTimeoutCount);
+    watchdog.setEnabled(false);
+}
 } // namespace
 } // namespace driver.
 
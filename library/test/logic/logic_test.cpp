@@ -3,6 +3,7 @@
  */
 #include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <thread>
@@ -11,6 +12,7 @@
 
 #include "driver/eeprom/stub.h"
 #include "driver/gpio/stub.h"
+#include "driver/reset/stub.h"
 #include "driver/serial/stub.h"
 #include "driver/tempsensor/stub.h"
 #include "driver/timer/stub.h"
@@ -65,6 +67,9 @@ struct Mock final
     /** Temperature sensor stub. */
     driver::tempsensor::Stub tempSensor;
 
+    /** Reset cause stub. */
+    driver::reset::Stub resetCause;
+
     /** Logic implementation stub. */
     std::unique_ptr<logic::Stub> logicImpl;
 
@@ -82,6 +87,7 @@ struct Mock final
         , watchdog{}
         , eeprom{}
         , tempSensor{}
+        , resetCause{}
         , logicImpl{nullptr}
     {}
 
@@ -93,13 +99,17 @@ struct Mock final
     /**
      * @brief Create logic implementation.
      * 
+     * @param[in] useDebounceTimer True to pass the debounce timer to the logic, false if the
+     *                             buttons are debounced elsewhere (default = true).
+     * 
      * @return Reference to the logic implementation.
      */
-    logic::Interface& createLogic()
+    logic::Interface& createLogic(const bool useDebounceTimer = true)
     {
         logicImpl = std::make_unique<logic::Stub>(
-            led, toggleButton, tempButton, debounceTimer, toggleTimer, 
-            tempTimer, serial, watchdog, eeprom, tempSensor);
+            led, toggleButton, tempButton, useDebounceTimer ? &debounceTimer : nullptr, 
+            toggleTimer, tempTimer, serial, watchdog, eeprom, tempSensor, nullptr, nullptr, 
+            &resetCause);
         return *logicImpl;
     }
 
@@ -203,6 +213,54 @@ TEST(Logic, DebounceHandling)
     }
 }
 
+/**
+ * @brief Debounce handling test without debounce timer.
+ *
+ *        Verify that raw button events are handled without a debounce period if the buttons
+ *        are debounced elsewhere, i.e. if no debounce timer is passed to the logic.
+ */
+TEST(Logic, NoDebounceTimer)
+{
+    // Create logic implementation without debounce timer and run the system.
+    Mock mock{};
+    logic::Interface& logic{mock.createLogic(false)};
+    mock.runSystem();
+
+    // Case 1 - Press the toggle button, simulate button event.
+    // Expect the toggle timer to be enabled with the button interrupts still disabled, since
+    // the buttons are polled rather than waking up the system.
+    {
+        EXPECT_FALSE(mock.toggleButton.isInterruptEnabled());
+        EXPECT_FALSE(mock.tempButton.isInterruptEnabled());
+
+        mock.toggleButton.write(true);
+        logic.handleButtonEvent();
+        mock.toggleButton.write(false);
+
+        EXPECT_FALSE(mock.toggleButton.isInterruptEnabled());
+        EXPECT_FALSE(mock.tempButton.isInterruptEnabled());
+        EXPECT_FALSE(mock.debounceTimer.isEnabled());
+        EXPECT_TRUE(mock.toggleTimer.isEnabled());
+    }
+
+    // Case 2 - Press the toggle button again right away.
+    // Expect the press to be handled, i.e. the toggle timer to be disabled.
+    {
+        mock.toggleButton.write(true);
+        logic.handleButtonEvent();
+        mock.toggleButton.write(false);
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+    }
+
+    // Case 3 - Post a debounce timer event, expect it to be ignored.
+    {
+        logic.postEvent(logic::Event::DebounceTimer);
+        mock.runSystem();
+        EXPECT_FALSE(mock.debounceTimer.isEnabled());
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+    }
+}
+
 /**
  * @brief Toggle handling test.
  *
@@ -367,6 +425,144 @@ TEST(Logic, TempHandling)
     }
 }
 
+/**
+ * @brief Event handling test.
+ *
+ *        Verify that posted events are handled in main context while the system is running.
+ */
+TEST(Logic, EventHandling)
+{
+    Mock mock{};
+    logic::Interface& logic{mock.createLogic()};
+
+    // Case 1 - Post a toggle timer event while the toggle timer is disabled.
+    // Expect the event to be ignored, i.e. expect the LED to remain disabled.
+    {
+        logic.postEvent(logic::Event::ToggleTimer);
+        mock.runSystem();
+        EXPECT_FALSE(mock.led.read());
+    }
+
+    // Case 2 - Press the toggle button and post a button event.
+    // Expect the toggle timer and the debounce timer to be enabled once the event is handled.
+    {
+        mock.toggleButton.write(true);
+        logic.postEvent(logic::Event::Button);
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+        mock.runSystem();
+        mock.toggleButton.write(false);
+
+        EXPECT_TRUE(mock.toggleTimer.isEnabled());
+        EXPECT_TRUE(mock.debounceTimer.isEnabled());
+    }
+
+    // Case 3 - Post debounce and toggle timer events.
+    // Expect the debounce period to end and the LED to be toggled.
+    {
+        logic.postEvent(logic::Event::ToggleTimer);
+        logic.postEvent(logic::Event::DebounceTimer);
+        mock.runSystem();
+
+        EXPECT_FALSE(mock.debounceTimer.isEnabled());
+        EXPECT_TRUE(mock.toggleButton.isInterruptEnabled());
+        EXPECT_TRUE(mock.led.read());
+    }
+
+    // Case 4 - Post a temperature timer event, expect the temperature to be printed once.
+    {
+        const auto printouts{mock.logicImpl->tempPrintoutCount()};
+        logic.postEvent(logic::Event::TempTimer);
+        mock.runSystem();
+        EXPECT_EQ(printouts + 1U, mock.logicImpl->tempPrintoutCount());
+    }
+
+    // Case 5 - Simulate the command "r" via the serial port.
+    // Expect the temperature to be printed once more.
+    {
+        const auto printouts{mock.logicImpl->tempPrintoutCount()};
+        const std::uint8_t command[]{'r', '\n'};
+        mock.serial.setReadBuffer(command, sizeof(command));
+        logic.postEvent(logic::Event::SerialReceive);
+        mock.runSystem();
+        EXPECT_EQ(printouts + 1U, mock.logicImpl->tempPrintoutCount());
+    }
+
+    // Case 6 - Post debounced press events for both buttons at once.
+    // Expect both to be handled, i.e. the toggle timer to be disabled and the temperature
+    // to be printed, without starting the debounce timer.
+    {
+        const auto printouts{mock.logicImpl->tempPrintoutCount()};
+        logic.postEvent(logic::Event::ToggleButton);
+        logic.postEvent(logic::Event::TempButton);
+        mock.runSystem();
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+        EXPECT_FALSE(mock.debounceTimer.isEnabled());
+        EXPECT_EQ(printouts + 1U, mock.logicImpl->tempPrintoutCount());
+    }
+
+    // Case 7 - Post a temperature timer event, expect it to be recorded in the crash record
+    // as the last handled event.
+    {
+        const auto eventCount{mock.resetCause.eventCount()};
+        logic.postEvent(logic::Event::TempTimer);
+        mock.runSystem();
+        EXPECT_EQ(eventCount + 1U, mock.resetCause.eventCount());
+        EXPECT_EQ(static_cast<std::uint8_t>(logic::Event::TempTimer), 
+                  mock.resetCause.lastEvent());
+    }
+}
+
+/**
+ * @brief Serial command test.
+ *
+ *        Verify that command lines received via the serial port are executed.
+ */
+TEST(Logic, SerialCommands)
+{
+    Mock mock{};
+    logic::Interface& logic{mock.createLogic()};
+
+    // Simulate reception of given text followed by a serial receive event.
+    auto receive{[&](const char* text)
+    {
+        mock.serial.setReadBuffer(reinterpret_cast<const std::uint8_t*>(text), 
+                                  static_cast<std::uint16_t>(std::strlen(text)));
+        logic.postEvent(logic::Event::SerialReceive);
+        mock.runSystem();
+    }};
+
+    // Case 1 - Set the toggle and temperature timer intervals, expect them to be updated.
+    {
+        receive("set toggle 250\r\ntemp interval 5000\n");
+        EXPECT_EQ(250U, mock.toggleTimer.timeout_ms());
+        EXPECT_EQ(5000U, mock.tempTimer.timeout_ms());
+    }
+
+    // Case 2 - Send a command split over several receptions, expect it to be executed once 
+    // the end of the line is received.
+    {
+        receive("set tog");
+        EXPECT_EQ(250U, mock.toggleTimer.timeout_ms());
+        receive("gle 100\n");
+        EXPECT_EQ(100U, mock.toggleTimer.timeout_ms());
+    }
+
+    // Case 3 - Send invalid commands, expect the intervals to be unchanged.
+    {
+        receive("set toggle 0\nset toggle\nset toggle abc\ntemp 5\n");
+        receive("set toggle 12345678901234567890123456789012345\n");
+        EXPECT_EQ(100U, mock.toggleTimer.timeout_ms());
+        EXPECT_EQ(5000U, mock.tempTimer.timeout_ms());
+    }
+
+    // Case 4 - Toggle the toggle timer via command "t", expect it to be enabled.
+    {
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+        receive("t\n");
+        EXPECT_TRUE(mock.toggleTimer.isEnabled());
+    }
+}
+
 /**
  * @brief EEPROM handling test.
  *
@@ -0,0 +1,188 @@
+/**
+ * @brief Unit tests for the arena allocator.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/list.h"
+#include "container/vector.h"
+#include "memory/allocator/arena.h"
+#include "memory/shared_ptr.h"
+#include "memory/unique_ptr.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace allocator
+{
+namespace
+{
+/** Size of the arena buffer in bytes. */
+constexpr std::size_t BufferSize{256U};
+
+/**
+ * @brief Arena allocation test.
+ *
+ *        Verify that blocks are allocated aligned and that allocation fails once the arena is
+ *        exhausted.
+ */
+TEST(Memory_Allocator_Arena, Allocate)
+{
+    alignas(Alignment) std::uint8_t buffer[BufferSize]{};
+    Arena arena{buffer, BufferSize};
+    EXPECT_EQ(BufferSize, arena.capacity());
+    EXPECT_EQ(0U, arena.used());
+
+    // Case 1 - Allocate an empty block, expect the allocation to fail.
+    EXPECT_EQ(nullptr, arena.allocate(0U));
+
+    // Case 2 - Allocate blocks, expect the blocks to be aligned and placed after each other.
+    auto block1{static_cast<std::uint8_t*>(arena.allocate(3U))};
+    auto block2{static_cast<std::uint8_t*>(arena.allocate(8U))};
+    ASSERT_NE(nullptr, block1);
+    ASSERT_NE(nullptr, block2);
+    EXPECT_EQ(buffer, block1);
+    EXPECT_EQ(buffer + Alignment, block2);
+    EXPECT_EQ(Alignment + 8U, arena.used());
+
+    // Case 3 - Allocate more memory than available, expect the allocation to fail.
+    EXPECT_EQ(nullptr, arena.allocate(BufferSize));
+    EXPECT_EQ(Alignment + 8U, arena.used());
+
+    // Case 4 - Reset the arena, expect the memory to be reused.
+    arena.reset();
+    EXPECT_EQ(0U, arena.used());
+    EXPECT_EQ(buffer, arena.allocate(BufferSize));
+    EXPECT_EQ(nullptr, arena.allocate(1U));
+}
+
+/**
+ * @brief Arena reallocation test.
+ *
+ *        Verify that the last block is resized in place and that other blocks are copied.
+ */
+TEST(Memory_Allocator_Arena, Reallocate)
+{
+    alignas(Alignment) std::uint8_t buffer[BufferSize]{};
+    Arena arena{buffer, BufferSize};
+
+    // Case 1 - Resize the last block, expect the block to be resized in place.
+    auto block1{static_cast<std::uint8_t*>(arena.reallocate(nullptr, 4U))};
+    ASSERT_NE(nullptr, block1);
+    for (std::uint8_t i{}; i < 4U; ++i) { block1[i] = i; }
+    EXPECT_EQ(block1, arena.reallocate(block1, 16U));
+    EXPECT_EQ(16U, arena.used());
+
+    // Case 2 - Resize a block that isn't the last block, expect the content to be copied.
+    ASSERT_NE(nullptr, arena.allocate(4U));
+    auto block2{static_cast<std::uint8_t*>(arena.reallocate(block1, 32U))};
+    ASSERT_NE(nullptr, block2);
+    EXPECT_NE(block1, block2);
+    for (std::uint8_t i{}; i < 4U; ++i) { EXPECT_EQ(i, block2[i]); }
+
+    // Case 3 - Deallocate the last block, expect its memory to be reclaimed.
+    const std::size_t used{arena.used()};
+    arena.deallocate(block2);
+    EXPECT_GT(used, arena.used());
+
+    // Case 4 - Grow a block beyond the capacity, expect the reallocation to fail.
+    EXPECT_EQ(nullptr, arena.reallocate(block1, BufferSize));
+}
+
+/**
+ * @brief Arena scope test.
+ *
+ *        Verify that memory allocated within a scope is released at the end of the scope.
+ */
+TEST(Memory_Allocator_Arena, Scope)
+{
+    alignas(Alignment) std::uint8_t buffer[BufferSize]{};
+    Arena arena{buffer, BufferSize};
+    ASSERT_NE(nullptr, arena.allocate(8U));
+    const Arena::Marker marker{arena.mark()};
+
+    // Case 1 - Allocate within a scope, expect the memory to be released at the end of the scope.
+    {
+        Arena::Scope scope{arena};
+        ASSERT_NE(nullptr, arena.allocate(64U));
+        ASSERT_NE(nullptr, arena.allocate(64U));
+        EXPECT_LT(marker, arena.used());
+    }
+    EXPECT_EQ(marker, arena.used());
+
+    // Case 2 - Release to a marker beyond the current position, expect no change.
+    arena.release(BufferSize);
+    EXPECT_EQ(marker, arena.used());
+}
+
+/**
+ * @brief Per-instance allocator selection test.
+ *
+ *        Verify that containers and smart pointers allocate their memory via the selected arena.
+ */
+TEST(Memory_Allocator_Arena, Selection)
+{
+    alignas(Alignment) std::uint8_t buffer[BufferSize]{};
+    Arena arena{buffer, BufferSize};
+    const auto inArena{[&buffer](const void* block)
+    {
+        const auto byte{static_cast<const std::uint8_t*>(block)};
+        return (buffer <= byte) && (byte < buffer + BufferSize);
+    }};
+
+    // Case 1 - Push values to a vector using the arena, expect the data to be held by the arena.
+    {
+        Arena::Scope scope{arena};
+        container::Vector<std::uint16_t> vector{arena};
+        for (std::uint16_t i{}; i < 8U; ++i) { EXPECT_TRUE(vector.pushBack(i)); }
+        EXPECT_TRUE(inArena(vector.data()));
+        EXPECT_EQ(8U * sizeof(std::uint16_t), arena.used());
+
+        // Copy the vector, expect the copy to use the same arena.
+        const container::Vector<std::uint16_t> copy{vector};
+        EXPECT_TRUE(inArena(copy.data()));
+        for (std::uint16_t i{}; i < 8U; ++i) { EXPECT_EQ(i, copy[i]); }
+    }
+    EXPECT_EQ(0U, arena.used());
+
+    // Case 2 - Push values to a list using the arena, expect the nodes to be held by the arena.
+    {
+        Arena::Scope scope{arena};
+        container::List<std::uint32_t> list{arena};
+        EXPECT_TRUE(list.pushBack(1U));
+        EXPECT_TRUE(list.pushBack(2U));
+        EXPECT_EQ(2U, list.size());
+        EXPECT_TRUE(inArena(list.begin().address()));
+    }
+    EXPECT_EQ(0U, arena.used());
+
+    // Case 3 - Create smart pointers using the arena, expect the objects to be held by the arena.
+    {
+        Arena::Scope scope{arena};
+        auto unique{allocateUnique<std::uint32_t>(arena, 42U)};
+        ASSERT_TRUE(unique);
+        EXPECT_EQ(42U, *unique);
+        EXPECT_TRUE(inArena(unique.get()));
+
+        auto shared{allocateShared<std::uint32_t>(arena, 43U)};
+        ASSERT_TRUE(shared);
+        const SharedPtr<std::uint32_t> copy{shared};
+        EXPECT_EQ(43U, *copy);
+        EXPECT_TRUE(inArena(shared.get()));
+    }
+    EXPECT_EQ(0U, arena.used());
+
+    // Case 4 - Create a vector without an allocator, expect the data to be held on the heap.
+    container::Vector<std::uint16_t> vector{};
+    EXPECT_TRUE(vector.pushBack(1U));
+    EXPECT_FALSE(inArena(vector.data()));
+    EXPECT_EQ(0U, arena.used());
+}
+} // namespace
+} // namespace allocator
+} // namespace memory
+
+#endif /** TESTSUITE */
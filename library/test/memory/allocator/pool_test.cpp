@@ -0,0 +1,178 @@
+/**
+ * @brief Unit tests for the pool and size-class allocators.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/vector.h"
+#include "memory/allocator/pool.h"
+#include "memory/allocator/size_classes.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace allocator
+{
+namespace
+{
+/**
+ * @brief Pool allocation test.
+ *
+ *        Verify that fixed-size blocks are allocated until the pool is exhausted and that
+ *        deallocated blocks are reused.
+ */
+TEST(Memory_Allocator_Pool, Allocate)
+{
+    constexpr std::size_t blockCount{4U};
+    // Reserve one extra byte for the map of free blocks.
+    alignas(Alignment) std::uint8_t buffer[blockCount * Alignment + 1U]{};
+    Pool pool{buffer, sizeof(buffer), 1U};
+    EXPECT_EQ(Alignment, pool.blockSize());
+    EXPECT_EQ(blockCount, pool.blockCount());
+    EXPECT_EQ(blockCount, pool.freeCount());
+
+    // Case 1 - Allocate a block larger than the block size, expect the allocation to fail.
+    EXPECT_EQ(nullptr, pool.allocate(Alignment + 1U));
+
+    // Case 2 - Allocate all blocks, expect each block to be owned by the pool.
+    void* blocks[blockCount]{};
+    for (auto& block : blocks)
+    {
+        block = pool.allocate(Alignment);
+        ASSERT_NE(nullptr, block);
+        EXPECT_TRUE(pool.owns(block));
+    }
+    EXPECT_EQ(0U, pool.freeCount());
+    EXPECT_EQ(nullptr, pool.allocate(1U));
+
+    // Case 3 - Deallocate a block, expect the block to be reused by the next allocation.
+    pool.deallocate(blocks[2U]);
+    EXPECT_EQ(1U, pool.freeCount());
+    EXPECT_EQ(blocks[2U], pool.allocate(1U));
+
+    // Case 4 - Deallocate a block not owned by the pool, expect it to be ignored.
+    std::uint8_t other[Alignment]{};
+    EXPECT_FALSE(pool.owns(other));
+    pool.deallocate(other);
+    EXPECT_EQ(0U, pool.freeCount());
+
+    // Case 5 - Resize a block, expect the block to be kept within the block size only.
+    EXPECT_EQ(blocks[0U], pool.reallocate(blocks[0U], Alignment));
+    EXPECT_EQ(nullptr, pool.reallocate(blocks[0U], Alignment + 1U));
+    EXPECT_EQ(nullptr, pool.reallocate(blocks[0U], 0U));
+    EXPECT_EQ(1U, pool.freeCount());
+
+    // Case 6 - Deallocate a block twice, expect the second call to be ignored, i.e. expect
+    // the block to be allocated only once.
+    pool.deallocate(blocks[1U]);
+    pool.deallocate(blocks[1U]);
+    EXPECT_EQ(2U, pool.freeCount());
+    void* first{pool.allocate(1U)};
+    void* second{pool.allocate(1U)};
+    EXPECT_NE(first, second);
+    EXPECT_EQ(nullptr, pool.allocate(1U));
+    EXPECT_EQ(0U, pool.freeCount());
+
+    // Case 7 - Create a pool without room for the map of free blocks, expect one block less.
+    alignas(Alignment) std::uint8_t smallBuffer[blockCount * Alignment]{};
+    Pool smallPool{smallBuffer, sizeof(smallBuffer), 1U};
+    EXPECT_EQ(blockCount - 1U, smallPool.blockCount());
+    EXPECT_EQ(blockCount - 1U, smallPool.freeCount());
+}
+
+/**
+ * @brief Size-class allocation test.
+ *
+ *        Verify that blocks are allocated from the smallest pool that fits and moved to larger
+ *        pools when resized.
+ */
+TEST(Memory_Allocator_SizeClasses, Allocate)
+{
+    alignas(Alignment) std::uint8_t smallBuffer[2U * Alignment + 1U]{};
+    alignas(Alignment) std::uint8_t largeBuffer[2U * 4U * Alignment + 1U]{};
+    Pool small{smallBuffer, sizeof(smallBuffer), Alignment};
+    Pool large{largeBuffer, sizeof(largeBuffer), 4U * Alignment};
+    Pool* const pools[]{&small, &large};
+    SizeClasses sizeClasses{pools, 2U};
+
+    // Case 1 - Allocate small blocks, expect the small pool to be used until exhausted.
+    void* block1{sizeClasses.allocate(1U)};
+    void* block2{sizeClasses.allocate(1U)};
+    void* block3{sizeClasses.allocate(1U)};
+    EXPECT_TRUE(small.owns(block1));
+    EXPECT_TRUE(small.owns(block2));
+    EXPECT_TRUE(large.owns(block3));
+
+    // Case 2 - Allocate a block exceeding the largest block size, expect the allocation to fail.
+    EXPECT_EQ(nullptr, sizeClasses.allocate(4U * Alignment + 1U));
+
+    // Case 3 - Grow a small block, expect the content to be moved to the large pool.
+    static_cast<std::uint8_t*>(block1)[0U] = 0x5AU;
+    void* grown{sizeClasses.reallocate(block1, 2U * Alignment)};
+    ASSERT_NE(nullptr, grown);
+    EXPECT_TRUE(large.owns(grown));
+    EXPECT_EQ(0x5AU, static_cast<std::uint8_t*>(grown)[0U]);
+    EXPECT_EQ(1U, small.freeCount());
+
+    // Case 4 - Deallocate all blocks, expect all blocks to be free.
+    sizeClasses.deallocate(block2);
+    sizeClasses.deallocate(block3);
+    sizeClasses.deallocate(grown);
+    EXPECT_EQ(small.blockCount(), small.freeCount());
+    EXPECT_EQ(large.blockCount(), large.freeCount());
+
+    // Case 5 - Use the size classes for a vector, expect the data to follow the vector size.
+    {
+        container::Vector<std::uint8_t> vector{sizeClasses};
+        EXPECT_TRUE(vector.resize(Alignment));
+        EXPECT_TRUE(small.owns(vector.data()));
+        EXPECT_TRUE(vector.resize(3U * Alignment));
+        EXPECT_TRUE(large.owns(vector.data()));
+        EXPECT_FALSE(vector.resize(8U * Alignment));
+    }
+    EXPECT_EQ(small.blockCount(), small.freeCount());
+    EXPECT_EQ(large.blockCount(), large.freeCount());
+}
+
+/**
+ * @brief Size-class pool order test.
+ *
+ *        Verify that pools not sorted by ascending block size are rejected.
+ */
+TEST(Memory_Allocator_SizeClasses, PoolOrder)
+{
+    alignas(Alignment) std::uint8_t smallBuffer[2U * Alignment + 1U]{};
+    alignas(Alignment) std::uint8_t largeBuffer[2U * 4U * Alignment + 1U]{};
+    Pool small{smallBuffer, sizeof(smallBuffer), Alignment};
+    Pool large{largeBuffer, sizeof(largeBuffer), 4U * Alignment};
+
+    // Case 1 - Pass the pools in descending order, expect all allocations to fail.
+    {
+        Pool* const pools[]{&large, &small};
+        SizeClasses sizeClasses{pools, 2U};
+        EXPECT_EQ(nullptr, sizeClasses.allocate(1U));
+    }
+
+    // Case 2 - Pass a pool twice, expect all allocations to fail.
+    {
+        Pool* const pools[]{&small, &small};
+        SizeClasses sizeClasses{pools, 2U};
+        EXPECT_EQ(nullptr, sizeClasses.allocate(1U));
+    }
+
+    // Case 3 - Pass a null pool, expect all allocations to fail.
+    {
+        Pool* const pools[]{&small, nullptr};
+        SizeClasses sizeClasses{pools, 2U};
+        EXPECT_EQ(nullptr, sizeClasses.allocate(1U));
+    }
+    EXPECT_EQ(small.blockCount(), small.freeCount());
+    EXPECT_EQ(large.blockCount(), large.freeCount());
+}
+} // namespace
+} // namespace allocator
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,109 @@
+/**
+ * @brief Unit tests for the memory instrumentation.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "memory/instrumentation.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Heap statistics test.
+ *
+ *        Verify that allocations are tracked while heap statistics are enabled.
+ */
+TEST(Memory_Instrumentation, HeapStats)
+{
+    setHeapStatsEnabled(true);
+    ASSERT_TRUE(isHeapStatsEnabled());
+    resetHeapStats();
+    const HeapStats initial{heapStats()};
+
+    // Case 1 - Allocate a block, expect the block to be counted.
+    auto block{utils::newMemory<std::uint32_t>(16U)};
+    ASSERT_NE(nullptr, block);
+    HeapStats stats{heapStats()};
+    EXPECT_LE(initial.current + 16U * sizeof(std::uint32_t), stats.current);
+    EXPECT_EQ(stats.current, stats.peak);
+    EXPECT_EQ(1U, stats.allocationCount);
+
+    // Case 2 - Grow the block, expect the current size and the peak to increase.
+    // Expect the allocation count to be unchanged, since no new block was allocated.
+    const std::size_t allocated{stats.current};
+    auto grown{utils::reallocMemory(block, 64U)};
+    ASSERT_NE(nullptr, grown);
+    block = grown;
+    stats = heapStats();
+    EXPECT_LE(initial.current + 64U * sizeof(std::uint32_t), stats.current);
+    EXPECT_LT(allocated, stats.peak);
+    EXPECT_EQ(1U, stats.allocationCount);
+
+    // Case 3 - Delete the block, expect the current size to be restored and the peak to be kept.
+    const std::size_t peak{stats.peak};
+    utils::deleteMemory(block);
+    EXPECT_EQ(nullptr, block);
+    stats = heapStats();
+    EXPECT_EQ(initial.current, stats.current);
+    EXPECT_EQ(peak, stats.peak);
+
+    // Case 4 - Reallocate a null pointer, expect the new block to be counted.
+    std::uint32_t* reallocated{nullptr};
+    reallocated = utils::reallocMemory(reallocated, 8U);
+    ASSERT_NE(nullptr, reallocated);
+    stats = heapStats();
+    EXPECT_LE(initial.current + 8U * sizeof(std::uint32_t), stats.current);
+    EXPECT_EQ(2U, stats.allocationCount);
+    utils::deleteMemory(reallocated);
+
+    // Case 5 - Reset the statistics, expect the peak to drop to the current size.
+    resetHeapStats();
+    stats = heapStats();
+    EXPECT_EQ(stats.current, stats.peak);
+    EXPECT_EQ(0U, stats.allocationCount);
+
+    // Case 6 - Disable the statistics, expect allocations not to be counted.
+    setHeapStatsEnabled(false);
+    EXPECT_FALSE(isHeapStatsEnabled());
+    auto untracked{utils::newMemory<std::uint8_t>(32U)};
+    EXPECT_EQ(0U, heapStats().allocationCount);
+    utils::deleteMemory(untracked);
+}
+
+/**
+ * @brief Stack painting test.
+ *
+ *        Verify that the stack high-water mark is found in a painted region.
+ */
+TEST(Memory_Instrumentation, StackPainting)
+{
+    constexpr std::size_t size{64U};
+    std::uint8_t stack[size]{};
+
+    // Case 1 - Paint the region, expect no stack usage.
+    paintStack(stack, stack + size);
+    EXPECT_EQ(0U, stackHighWater(stack, stack + size));
+
+    // Case 2 - Simulate stack usage from the end of the region, expect it to be measured.
+    for (std::size_t i{size - 20U}; i < size; ++i) { stack[i] = 0U; }
+    EXPECT_EQ(20U, stackHighWater(stack, stack + size));
+
+    // Case 3 - Restore part of the paint, expect the high-water mark to be kept since the
+    //          deepest used byte is still overwritten.
+    paintStack(stack + size - 10U, stack + size);
+    EXPECT_EQ(20U, stackHighWater(stack, stack + size));
+
+    // Case 4 - Simulate a stack overflow, expect the whole region to be reported as used.
+    stack[0U] = 0U;
+    EXPECT_EQ(size, stackHighWater(stack, stack + size));
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,172 @@
+/**
+ * @brief Unit tests for the shared pointer implementation.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "memory/allocator/arena.h"
+#include "memory/instrumentation.h"
+#include "memory/ref_counted.h"
+#include "memory/shared_ptr.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Object embedding its own reference count.
+ */
+struct Counted final : public RefCounted
+{
+    explicit Counted(const std::uint32_t value = 0U) noexcept
+        : RefCounted{}
+        , myValue{value} {}
+
+    std::uint32_t myValue;
+};
+
+/**
+ * @brief Fused allocation test.
+ *
+ *        Verify that objects created via makeShared() are allocated as a single block together
+ *        with their control block, while adopted objects need a separate control block.
+ */
+TEST(Memory_SharedPtr, FusedAllocation)
+{
+    setHeapStatsEnabled(true);
+    resetHeapStats();
+
+    // Case 1 - Create a shared object, expect a single allocation.
+    {
+        auto ptr{makeShared<std::uint32_t>(42U)};
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(42U, *ptr);
+        EXPECT_EQ(1U, ptr.useCount());
+        EXPECT_EQ(1U, heapStats().allocationCount);
+
+        // Copy the pointer, expect the object to be shared without further allocations.
+        SharedPtr<std::uint32_t> copy{ptr};
+        EXPECT_EQ(2U, ptr.useCount());
+        EXPECT_EQ(ptr.get(), copy.get());
+        EXPECT_EQ(1U, heapStats().allocationCount);
+
+        // Release the copy, expect the count to decrease and the object to be kept.
+        EXPECT_EQ(nullptr, copy.release());
+        EXPECT_FALSE(copy);
+        EXPECT_EQ(1U, ptr.useCount());
+
+        // Release the only pointer, expect the ownership to be kept, since the object can't
+        // be deallocated separately from its control block.
+        EXPECT_EQ(nullptr, ptr.release());
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(42U, *ptr);
+        EXPECT_EQ(1U, ptr.useCount());
+    }
+    EXPECT_EQ(0U, heapStats().current);
+
+    // Case 2 - Adopt an object allocated separately, expect a separate control block.
+    resetHeapStats();
+    {
+        SharedPtr<std::uint32_t> ptr{utils::newObject<std::uint32_t>(43U)};
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(1U, ptr.useCount());
+        EXPECT_EQ(2U, heapStats().allocationCount);
+
+        // Release the only pointer, expect the ownership to be passed to the caller.
+        auto data{ptr.release()};
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(43U, *data);
+        EXPECT_EQ(0U, ptr.useCount());
+        utils::deleteMemory(data);
+    }
+    EXPECT_EQ(0U, heapStats().current);
+    setHeapStatsEnabled(false);
+}
+
+/**
+ * @brief Intrusive reference count test.
+ *
+ *        Verify that objects embedding their own count are shared without a control block.
+ */
+TEST(Memory_SharedPtr, Intrusive)
+{
+    setHeapStatsEnabled(true);
+    resetHeapStats();
+
+    // Case 1 - Create a shared object, expect the count to be held by the object.
+    {
+        auto ptr{makeShared<Counted>(7U)};
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(7U, ptr->myValue);
+        EXPECT_EQ(1U, ptr->refCount());
+        EXPECT_EQ(1U, heapStats().allocationCount);
+
+        // Create a new pointer from the raw pointer, expect the ownership to be shared.
+        SharedPtr<Counted> other{ptr.get()};
+        EXPECT_EQ(2U, ptr->refCount());
+        EXPECT_EQ(2U, other.useCount());
+
+        // Copy the object, expect the copy not to share the count.
+        const Counted copy{*ptr};
+        EXPECT_EQ(0U, copy.refCount());
+        EXPECT_EQ(7U, copy.myValue);
+
+        other.reset();
+        EXPECT_EQ(1U, ptr.useCount());
+    }
+    EXPECT_EQ(0U, heapStats().current);
+    setHeapStatsEnabled(false);
+}
+
+/**
+ * @brief Shared allocation via allocator test.
+ *
+ *        Verify that the fused block is allocated via the selected allocator.
+ */
+TEST(Memory_SharedPtr, Allocator)
+{
+    constexpr std::size_t bufferSize{128U};
+    alignas(allocator::Alignment) std::uint8_t buffer[bufferSize]{};
+    allocator::Arena arena{buffer, bufferSize};
+
+    // Case 1 - Create a shared object via the arena, expect a single block to be allocated.
+    {
+        auto ptr{allocateShared<std::uint64_t>(arena, 44U)};
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(44U, *ptr);
+        EXPECT_LT(0U, arena.used());
+        EXPECT_GE(2U * sizeof(std::uint64_t) + sizeof(std::size_t), arena.used());
+    }
+
+    // Case 2 - Release the last pointer, expect the block to be returned to the arena.
+    EXPECT_EQ(0U, arena.used());
+
+    // Case 3 - Create a new pointer from the raw pointer to a shared object allocated via the
+    // arena, release the original pointer. Expect the object to be returned to the arena
+    // when the new pointer is released.
+    {
+        auto ptr{allocateShared<Counted>(arena, 46U)};
+        ASSERT_TRUE(ptr);
+        SharedPtr<Counted> other{ptr.get()};
+        EXPECT_EQ(2U, other.useCount());
+        ptr = SharedPtr<Counted>{};
+        EXPECT_EQ(1U, other.useCount());
+        EXPECT_EQ(46U, other->myValue);
+        EXPECT_LT(0U, arena.used());
+    }
+    EXPECT_EQ(0U, arena.used());
+
+    // Case 4 - Exhaust the arena, expect the shared pointer to be null.
+    ASSERT_NE(nullptr, arena.allocate(bufferSize));
+    const auto ptr{allocateShared<std::uint64_t>(arena, 45U)};
+    EXPECT_FALSE(ptr);
+    EXPECT_EQ(0U, ptr.useCount());
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,179 @@
+/**
+ * @brief Unit tests for the fixed-point linear regression model.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/fixed_point.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Fixed-point model with the default Q15.16 format. */
+using Model = lin_reg::FixedPoint<>;
+
+/**
+ * @brief Happy path test.
+ *
+ *        Verify that the fixed-point model predicts as intended during optimal conditions.
+ */
+TEST(LinRegFixedPoint, HappyPath)
+{
+    // Create a linear regression model, expect the model to be untrained.
+    Model linReg{};
+    EXPECT_FALSE(linReg.isTrained());
+
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    const Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+    constexpr std::size_t epochCount{100U};
+    constexpr double learningRate{0.01};
+
+    // Verify that the model predicts 0 when untrained.
+    for (const auto& input : trainIn)
+    {
+        constexpr double expectedPrediction{0.0};
+        EXPECT_EQ(expectedPrediction, linReg.predict(input));
+    }
+
+    // Train the model, expect the training to succeed.
+    EXPECT_TRUE(linReg.train(trainIn, trainOut, epochCount, learningRate));
+    EXPECT_TRUE(linReg.isTrained());
+
+    // Verify that the model predicts as intended, both in floating-point and fixed-point format.
+    for (std::size_t i{}; i < trainIn.size(); ++i)
+    {
+        const double input{trainIn[i]};
+        const double output{trainOut[i]};
+
+        constexpr double precision{1e-3};
+        EXPECT_NEAR(output, linReg.predict(input), precision);
+        EXPECT_NEAR(output, Model::toDouble(linReg.predictFixed(Model::toFixed(input))),
+                    precision);
+    }
+}
+
+/**
+ * @brief Fixed-point versus floating-point test.
+ *
+ *        Verify that the fixed-point model converges to the same parameters as the
+ *        floating-point model when trained to predict the temperature based on the input voltage.
+ */
+TEST(LinRegFixedPoint, SameAsFloatingPoint)
+{
+    // Training data to teach the models to predict T = 100 * Uin - 50.
+    const Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7,
+                           0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4};
+    const Matrix2d trainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0,
+                            30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0};
+    constexpr std::size_t epochCount{1000U};
+    constexpr double learningRate{0.01};
+
+    // Train both models, expect success.
+    lin_reg::Fixed reference{};
+    Model linReg{};
+    EXPECT_TRUE(reference.train(trainIn, trainOut, epochCount, learningRate));
+    EXPECT_TRUE(linReg.train(trainIn, trainOut, epochCount, learningRate));
+
+    // Expect the models to predict the same temperatures within tolerance.
+    for (double input{}; input <= 5.0; input += 0.05)
+    {
+        constexpr double tolerance{0.05};
+        EXPECT_NEAR(reference.predict(input), linReg.predict(input), tolerance);
+    }
+}
+
+/**
+ * @brief Saturation test.
+ *
+ *        Verify that fixed-point arithmetic saturates instead of wrapping around.
+ */
+TEST(LinRegFixedPoint, Saturation)
+{
+    constexpr std::int32_t max{INT32_MAX};
+    constexpr std::int32_t min{INT32_MIN};
+    constexpr std::int32_t one{Model::One};
+
+    // Expect conversions of numbers out of range to saturate.
+    EXPECT_EQ(max, Model::toFixed(1e9));
+    EXPECT_EQ(min, Model::toFixed(-1e9));
+
+    // Expect additions and subtractions to saturate.
+    EXPECT_EQ(max, Model::add(max, one));
+    EXPECT_EQ(min, Model::add(min, -one));
+    EXPECT_EQ(max, Model::subtract(max, -one));
+    EXPECT_EQ(min, Model::subtract(min, one));
+
+    // Expect multiplications to saturate.
+    EXPECT_EQ(max, Model::multiply(max, 2 * one));
+    EXPECT_EQ(min, Model::multiply(max, -2 * one));
+
+    // Expect ordinary operations to be exact.
+    EXPECT_EQ(3 * one, Model::add(one, 2 * one));
+    EXPECT_EQ(-one, Model::subtract(one, 2 * one));
+    EXPECT_EQ(6 * one, Model::multiply(2 * one, 3 * one));
+    EXPECT_EQ(one / 4, Model::multiply(one / 2, one / 2));
+    EXPECT_DOUBLE_EQ(-2.5, Model::toDouble(Model::toFixed(-2.5)));
+}
+
+/**
+ * @brief Q-format test.
+ *
+ *        Verify that the model can be trained with another number of fraction bits.
+ */
+TEST(LinRegFixedPoint, QFormat)
+{
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    const Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+    constexpr std::size_t epochCount{100U};
+    constexpr double learningRate{0.01};
+
+    // Train a Q23.8 model, expect success.
+    lin_reg::FixedPoint<8U> linReg{};
+    EXPECT_TRUE(linReg.train(trainIn, trainOut, epochCount, learningRate));
+
+    // Expect the model to predict as intended, with lower precision.
+    for (std::size_t i{}; i < trainIn.size(); ++i)
+    {
+        constexpr double precision{0.25};
+        EXPECT_NEAR(trainOut[i], linReg.predict(trainIn[i]), precision);
+    }
+}
+
+/**
+ * @brief Invalid training parameters test.
+ *
+ *        Verify that the model doesn't get trained if the epoch count, the learning rate or
+ *        the training sets are invalid.
+ */
+TEST(LinRegFixedPoint, InvalidParameters)
+{
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    const Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+    const Matrix1d empty{};
+    constexpr std::size_t epochCount{100U};
+    constexpr double learningRate{0.01};
+
+    Model linReg{};
+
+    // Expect the training to fail if no complete training sets are present.
+    EXPECT_FALSE(linReg.train(empty, trainOut, epochCount, learningRate));
+    EXPECT_FALSE(linReg.train(trainIn, empty, epochCount, learningRate));
+
+    // Expect the training to fail if the epoch count is 0.
+    EXPECT_FALSE(linReg.train(trainIn, trainOut, 0U, learningRate));
+
+    // Expect the training to fail if the learning rate is out of range.
+    EXPECT_FALSE(linReg.train(trainIn, trainOut, epochCount, 0.0));
+    EXPECT_FALSE(linReg.train(trainIn, trainOut, epochCount, 1.1));
+    EXPECT_FALSE(linReg.isTrained());
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
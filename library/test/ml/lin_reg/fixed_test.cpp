@@ -1,8 +1,11 @@
 /**
  * @brief Unit tests for the fixed linear regression model.
  */
+#include <cstdint>
+
 #include <gtest/gtest.h>
 
+#include "driver/eeprom/stub.h"
 #include "ml/lin_reg/fixed.h"
 #include "ml/types.h"
 
@@ -177,6 +180,345 @@ TEST(LinRegFixed, LearningRate)
         EXPECT_EQ(valid, linReg.isTrained());   
     }
 }
+
+/**
+ * @brief Closed-form training test.
+ * 
+ *        Verify that the closed-form solution fits linear data exactly and gives the same 
+ *        parameters as gradient descent.
+ */
+TEST(LinRegFixed, ClosedForm)
+{
+    const Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 
+                           0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4};
+    const Matrix2d trainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 
+                            30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0};
+
+    // Train one model with gradient descent and one with the closed-form solution.
+    lin_reg::Fixed reference{};
+    lin_reg::Fixed linReg{};
+    EXPECT_TRUE(reference.train(trainIn, trainOut, 1000U, 0.01));
+    EXPECT_FALSE(linReg.isTrained());
+    EXPECT_TRUE(linReg.trainClosedForm(trainIn, trainOut));
+    EXPECT_TRUE(linReg.isTrained());
+
+    // Expect the closed-form model to predict T = 100 * Uin - 50 exactly, and the same 
+    // values as the model trained with gradient descent.
+    for (double input{}; input <= 5.0; input += 0.05)
+    {
+        EXPECT_NEAR(100.0 * input - 50.0, linReg.predict(input), 1e-9);
+        EXPECT_NEAR(reference.predict(input), linReg.predict(input), 1e-6);
+    }
+}
+
+/**
+ * @brief Closed-form training with noisy data.
+ * 
+ *        Verify that the closed-form solution equals the least-squares fit of noisy data, 
+ *        even when the inputs have a large offset.
+ */
+TEST(LinRegFixed, ClosedFormNoisy)
+{
+    // Noisy samples of y = 2x + 1, offset by 1e6 to verify numerical stability.
+    constexpr double offset{1e6};
+    const Matrix1d trainIn{offset + 0.0, offset + 1.0, offset + 2.0, offset + 3.0, offset + 4.0};
+    const Matrix2d trainOut{1.1, 2.9, 5.2, 6.8, 9.1};
+
+    // Least-squares solution computed by hand: weight = 1.99, bias = 1.04 (relative to offset).
+    constexpr double expectedWeight{1.99};
+    constexpr double expectedBias{1.04};
+
+    lin_reg::Fixed linReg{};
+    EXPECT_TRUE(linReg.trainClosedForm(trainIn, trainOut));
+
+    for (std::size_t i{}; i < trainIn.size(); ++i)
+    {
+        const double expected{expectedWeight * (trainIn[i] - offset) + expectedBias};
+        EXPECT_NEAR(expected, linReg.predict(trainIn[i]), 1e-6);
+    }
+}
+
+/**
+ * @brief Closed-form training with invalid sets.
+ * 
+ *        Verify that the model doesn't get trained if no complete training sets are present,
+ *        and that constant input gives the mean output.
+ */
+TEST(LinRegFixed, ClosedFormSpecialCases)
+{
+    // Case 1 - No training sets.
+    {
+        lin_reg::Fixed linReg{};
+        const Matrix1d trainIn{};
+        const Matrix2d trainOut{2.0, 4.0};
+        EXPECT_FALSE(linReg.trainClosedForm(trainIn, trainOut));
+        EXPECT_FALSE(linReg.isTrained());
+    }
+
+    // Case 2 - Constant input, expect the mean output to be predicted.
+    {
+        lin_reg::Fixed linReg{};
+        const Matrix1d trainIn{1.0, 1.0, 1.0};
+        const Matrix2d trainOut{2.0, 4.0, 6.0};
+        EXPECT_TRUE(linReg.trainClosedForm(trainIn, trainOut));
+        EXPECT_DOUBLE_EQ(4.0, linReg.predict(1.0));
+        EXPECT_DOUBLE_EQ(4.0, linReg.predict(10.0));
+    }
+}
+
+/**
+ * @brief Online update test.
+ * 
+ *        Verify that online updates converge to the same parameters as closed-form training and
+ *        that an untrained model becomes trained once samples with different inputs are seen.
+ */
+TEST(LinRegFixed, OnlineUpdate)
+{
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    const Matrix2d trainOut{1.1, 2.9, 5.2, 6.8, 9.1};
+
+    // Train the reference model in closed form.
+    lin_reg::Fixed reference{};
+    EXPECT_TRUE(reference.trainClosedForm(trainIn, trainOut));
+
+    // Update the model sample by sample, expect it to be trained after the second sample.
+    lin_reg::Fixed linReg{};
+    EXPECT_FALSE(linReg.update(trainIn[0U], trainOut[0U]));
+    EXPECT_FALSE(linReg.isTrained());
+
+    for (std::size_t i{1U}; i < trainIn.size(); ++i)
+    {
+        EXPECT_TRUE(linReg.update(trainIn[i], trainOut[i]));
+    }
+
+    // Expect the models to predict the same values.
+    for (double input{-5.0}; input <= 5.0; input += 0.5)
+    {
+        EXPECT_NEAR(reference.predict(input), linReg.predict(input), 1e-9);
+    }
+}
+
+/**
+ * @brief Online recalibration test.
+ * 
+ *        Verify that a trained model tracks a drifted relation when updated online, both after
+ *        closed-form and gradient descent training.
+ */
+TEST(LinRegFixed, OnlineRecalibration)
+{
+    // Training data to teach the model to predict y = 2x + 2.
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    const Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+
+    // Case 1 - Closed-form training, forget earlier samples to track y = 3x - 1.
+    {
+        lin_reg::Fixed linReg{0.5};
+        EXPECT_TRUE(linReg.trainClosedForm(trainIn, trainOut));
+
+        for (std::size_t i{}; i < 100U; ++i)
+        {
+            const double input{static_cast<double>(i % trainIn.size())};
+            EXPECT_TRUE(linReg.update(input, 3.0 * input - 1.0));
+        }
+        EXPECT_NEAR(-1.0, linReg.predict(0.0), 1e-6);
+        EXPECT_NEAR(29.0, linReg.predict(10.0), 1e-6);
+    }
+
+    // Case 2 - Gradient descent training, then recalibrate the offset.
+    {
+        lin_reg::Fixed linReg{};
+        EXPECT_TRUE(linReg.train(trainIn, trainOut, 1000U));
+        const double weight{linReg.predict(1.0) - linReg.predict(0.0)};
+
+        // Expect the weight to be kept and the bias to move towards a single sample.
+        EXPECT_TRUE(linReg.update(1.0, 5.0));
+        EXPECT_NEAR(weight, linReg.predict(1.0) - linReg.predict(0.0), 1e-9);
+        EXPECT_LT(4.0, linReg.predict(1.0));
+        EXPECT_GT(5.0, linReg.predict(1.0));
+
+        // Expect a second sample to refine the weight rather than replacing it.
+        EXPECT_TRUE(linReg.update(3.0, 10.0));
+        EXPECT_LT(weight, linReg.predict(1.0) - linReg.predict(0.0));
+        EXPECT_GT(2.5, linReg.predict(1.0) - linReg.predict(0.0));
+
+        // Expect repeated samples to converge to the new offset.
+        for (std::size_t i{}; i < 1000U; ++i)
+        {
+            const double input{static_cast<double>(i % trainIn.size())};
+            EXPECT_TRUE(linReg.update(input, 2.0 * input + 3.0));
+        }
+        EXPECT_NEAR(3.0, linReg.predict(0.0), 0.05);
+        EXPECT_NEAR(23.0, linReg.predict(10.0), 0.05);
+    }
+
+    // Case 3 - Expect an invalid forgetting factor to be replaced by 1.0 (no forgetting).
+    {
+        lin_reg::Fixed linReg{2.0};
+        lin_reg::Fixed reference{};
+        const Matrix2d noisyOut{2.5, 3.5, 6.5, 7.5, 10.5};
+
+        for (std::size_t i{}; i < trainIn.size(); ++i)
+        {
+            linReg.update(trainIn[i], noisyOut[i]);
+            reference.update(trainIn[i], noisyOut[i]);
+        }
+        EXPECT_NEAR(reference.predict(10.0), linReg.predict(10.0), 1e-9);
+    }
+}
+
+/**
+ * @brief Batch prediction and training test.
+ * 
+ *        Verify that batch prediction and training yield the same results as the scalar 
+ *        functions for any number of samples, including counts that aren't a multiple of the 
+ *        SIMD width.
+ */
+TEST(LinRegFixed, Batch)
+{
+    constexpr std::size_t maxCount{1000U};
+    double input[maxCount]{};
+    double output[maxCount]{};
+
+    // Create noisy training data for y = 3x - 2.
+    for (std::size_t i{}; i < maxCount; ++i)
+    {
+        input[i]  = 0.01 * i;
+        output[i] = 3.0 * input[i] - 2.0 + (0U == i % 2U ? 0.1 : -0.1) + 0.001 * (i % 7U);
+    }
+
+    // Case 1 - Train with different sample counts, expect the same result as the scalar 
+    //          closed-form training.
+    for (const std::size_t count : {1U, 2U, 3U, 5U, 8U, 13U, 1000U})
+    {
+        Matrix1d trainIn{};
+        Matrix2d trainOut{};
+        for (std::size_t i{}; i < count; ++i)
+        {
+            trainIn.pushBack(input[i]);
+            trainOut.pushBack(output[i]);
+        }
+
+        lin_reg::Fixed reference{};
+        lin_reg::Fixed linReg{};
+        EXPECT_TRUE(reference.trainClosedForm(trainIn, trainOut));
+        EXPECT_TRUE(linReg.trainBatch(input, output, count));
+        EXPECT_NEAR(reference.predict(0.0), linReg.predict(0.0), 1e-9);
+        EXPECT_NEAR(reference.predict(10.0), linReg.predict(10.0), 1e-9);
+
+        // Expect online updates to continue from the batch statistics.
+        EXPECT_TRUE(reference.update(5.0, 13.0));
+        EXPECT_TRUE(linReg.update(5.0, 13.0));
+        EXPECT_NEAR(reference.predict(10.0), linReg.predict(10.0), 1e-9);
+    }
+
+    // Case 2 - Predict with different sample counts, expect the same result as the scalar
+    //          prediction and the remaining outputs to be untouched.
+    {
+        lin_reg::Fixed linReg{};
+        EXPECT_TRUE(linReg.trainBatch(input, output, maxCount));
+
+        for (std::size_t count{}; count <= 9U; ++count)
+        {
+            double predictions[10U]{};
+            linReg.predictBatch(input + 1U, predictions, count);
+            for (std::size_t i{}; i < count; ++i)
+            {
+                EXPECT_DOUBLE_EQ(linReg.predict(input[i + 1U]), predictions[i]);
+            }
+            EXPECT_EQ(0.0, predictions[count]);
+        }
+    }
+
+    // Case 3 - Expect the batch training to fail if the training data is missing.
+    {
+        lin_reg::Fixed linReg{};
+        EXPECT_FALSE(linReg.trainBatch(nullptr, output, maxCount));
+        EXPECT_FALSE(linReg.trainBatch(input, nullptr, maxCount));
+        EXPECT_FALSE(linReg.trainBatch(input, output, 0U));
+        EXPECT_FALSE(linReg.isTrained());
+
+        // Expect missing prediction data to be ignored.
+        linReg.predictBatch(nullptr, output, maxCount);
+        linReg.predictBatch(input, nullptr, maxCount);
+    }
+}
+
+/**
+ * @brief Model persistence test.
+ * 
+ *        Verify that a trained model can be stored in and restored from EEPROM, and that 
+ *        missing or corrupted models are rejected.
+ */
+TEST(LinRegFixed, Persistence)
+{
+    constexpr std::uint16_t address{8U};
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    const Matrix2d trainOut{1.1, 2.9, 5.2, 6.8, 9.1};
+
+    driver::eeprom::Stub<64U> eeprom{};
+    lin_reg::Fixed model{};
+
+    // Case 1 - Expect an untrained model not to be stored and an erased EEPROM to be rejected.
+    {
+        EXPECT_FALSE(model.save(eeprom, address));
+        for (std::uint16_t i{}; i < eeprom.size(); ++i) 
+        { 
+            eeprom.write(i, static_cast<std::uint8_t>(0xFFU)); 
+        }
+        EXPECT_FALSE(model.load(eeprom, address));
+        EXPECT_FALSE(model.isTrained());
+    }
+
+    // Case 2 - Store a trained model, expect an identical model to be loaded.
+    {
+        EXPECT_TRUE(model.trainClosedForm(trainIn, trainOut));
+        EXPECT_TRUE(model.save(eeprom, address));
+
+        lin_reg::Fixed loaded{};
+        EXPECT_TRUE(loaded.load(eeprom, address));
+        EXPECT_TRUE(loaded.isTrained());
+        for (double input{-5.0}; input <= 5.0; input += 0.5)
+        {
+            EXPECT_EQ(model.predict(input), loaded.predict(input));
+        }
+
+        // Expect online updates to start from the loaded parameters.
+        const double weight{loaded.predict(1.0) - loaded.predict(0.0)};
+        EXPECT_TRUE(loaded.update(2.0, model.predict(2.0) + 1.0));
+        EXPECT_NEAR(weight, loaded.predict(1.0) - loaded.predict(0.0), 1e-9);
+        EXPECT_LT(model.predict(2.0), loaded.predict(2.0));
+        EXPECT_GT(model.predict(2.0) + 1.0, loaded.predict(2.0));
+
+        // Expect the bytes outside the reserved region to be untouched.
+        std::uint8_t data{};
+        EXPECT_TRUE(eeprom.read(address - 1U, data));
+        EXPECT_EQ(0xFFU, data);
+        EXPECT_TRUE(eeprom.read(address + lin_reg::Fixed::StorageSize, data));
+        EXPECT_EQ(0xFFU, data);
+    }
+
+    // Case 3 - Corrupt each stored byte in turn, expect the model to be rejected.
+    for (std::uint16_t i{}; i < lin_reg::Fixed::StorageSize; ++i)
+    {
+        std::uint8_t data{};
+        EXPECT_TRUE(eeprom.read(address + i, data));
+        EXPECT_TRUE(eeprom.write(address + i, static_cast<std::uint8_t>(data ^ 0x10U)));
+
+        lin_reg::Fixed loaded{};
+        EXPECT_FALSE(loaded.load(eeprom, address));
+        EXPECT_FALSE(loaded.isTrained());
+        EXPECT_TRUE(eeprom.write(address + i, data));
+    }
+
+    // Case 4 - Expect the operations to fail if the region is out of range or the EEPROM 
+    //          stream is disabled.
+    {
+        EXPECT_FALSE(model.save(eeprom, eeprom.size() - 1U));
+        eeprom.setEnabled(false);
+        EXPECT_FALSE(model.save(eeprom, address));
+        EXPECT_FALSE(model.load(eeprom, address));
+    }
+}
 } // namespace
 } // namespace ml
 
@@ -0,0 +1,245 @@
+/**
+ * @brief Unit tests for the multivariate and polynomial regression models.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/vector.h"
+#include "ml/lin_reg/multivariate.h"
+#include "ml/lin_reg/polynomial.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Model with two input features. */
+using Model = lin_reg::Multivariate<2U>;
+
+// -----------------------------------------------------------------------------
+constexpr double computeOutput(const double x0, const double x1) noexcept
+{
+    // Relation to learn: y = 2 * x0 - 3 * x1 + 1.
+    return 2.0 * x0 - 3.0 * x1 + 1.0;
+}
+
+// -----------------------------------------------------------------------------
+void createTrainingData(container::Vector<Model::Features>& trainIn, Matrix2d& trainOut) noexcept
+{
+    for (double x0{}; x0 < 1.0; x0 += 0.25)
+    {
+        for (double x1{}; x1 < 1.0; x1 += 0.25)
+        {
+            trainIn.pushBack(Model::Features{{x0, x1}});
+            trainOut.pushBack(computeOutput(x0, x1));
+        }
+    }
+}
+
+/**
+ * @brief Multivariate closed-form training test.
+ * 
+ *        Verify that the normal equations yield the exact parameters and that too few 
+ *        training sets are detected.
+ */
+TEST(LinRegMultivariate, ClosedForm)
+{
+    container::Vector<Model::Features> trainIn{};
+    Matrix2d trainOut{};
+    createTrainingData(trainIn, trainOut);
+
+    // Case 1 - Train the model, expect the exact parameters.
+    {
+        Model linReg{};
+        EXPECT_FALSE(linReg.isTrained());
+        EXPECT_TRUE(linReg.trainClosedForm(trainIn, trainOut));
+        EXPECT_TRUE(linReg.isTrained());
+        EXPECT_NEAR(2.0, linReg.weights()[0U], 1e-9);
+        EXPECT_NEAR(-3.0, linReg.weights()[1U], 1e-9);
+        EXPECT_NEAR(1.0, linReg.bias(), 1e-9);
+        EXPECT_NEAR(computeOutput(5.0, -2.0), linReg.predict(Model::Features{{5.0, -2.0}}), 1e-9);
+    }
+
+    // Case 2 - Expect the training to fail without training sets or if the features are
+    //          linearly dependent (x1 = x0).
+    {
+        Model linReg{};
+        const container::Vector<Model::Features> empty{};
+        EXPECT_FALSE(linReg.trainClosedForm(empty, trainOut));
+
+        container::Vector<Model::Features> dependentIn{};
+        Matrix2d dependentOut{};
+        for (double x{}; x < 1.0; x += 0.1)
+        {
+            dependentIn.pushBack(Model::Features{{x, x}});
+            dependentOut.pushBack(computeOutput(x, x));
+        }
+        EXPECT_FALSE(linReg.trainClosedForm(dependentIn, dependentOut));
+        EXPECT_FALSE(linReg.isTrained());
+    }
+}
+
+/**
+ * @brief Multivariate gradient descent test.
+ * 
+ *        Verify that the model converges with different batch sizes and that invalid 
+ *        parameters are detected.
+ */
+TEST(LinRegMultivariate, GradientDescent)
+{
+    container::Vector<Model::Features> trainIn{};
+    Matrix2d trainOut{};
+    createTrainingData(trainIn, trainOut);
+
+    // Case 1 - Train with different batch sizes, including a batch size that doesn't divide
+    //          the number of training sets and full-batch training.
+    for (const std::size_t batchSize : {1U, 3U, 16U})
+    {
+        Model linReg{};
+        constexpr std::size_t epochCount{20000U};
+        constexpr double learningRate{0.1};
+        EXPECT_TRUE(linReg.train(trainIn, trainOut, epochCount, learningRate, batchSize));
+        EXPECT_NEAR(2.0, linReg.weights()[0U], 1e-3);
+        EXPECT_NEAR(-3.0, linReg.weights()[1U], 1e-3);
+        EXPECT_NEAR(1.0, linReg.bias(), 1e-3);
+    }
+
+    // Case 2 - Expect invalid parameters to be detected.
+    {
+        Model linReg{};
+        EXPECT_FALSE(linReg.train(trainIn, trainOut, 0U));
+        EXPECT_FALSE(linReg.train(trainIn, trainOut, 100U, 0.0));
+        EXPECT_FALSE(linReg.train(trainIn, trainOut, 100U, 1.1));
+        EXPECT_FALSE(linReg.train(trainIn, trainOut, 100U, 0.01, 0U));
+        EXPECT_FALSE(linReg.isTrained());
+    }
+}
+
+/**
+ * @brief Multivariate online update test.
+ * 
+ *        Verify that the model becomes trained once enough samples have been added and 
+ *        yields the same parameters as closed-form training.
+ */
+TEST(LinRegMultivariate, OnlineUpdate)
+{
+    container::Vector<Model::Features> trainIn{};
+    Matrix2d trainOut{};
+    createTrainingData(trainIn, trainOut);
+
+    // Expect the model to be untrained until three independent samples have been added.
+    Model linReg{};
+    EXPECT_FALSE(linReg.update(Model::Features{{0.0, 0.0}}, computeOutput(0.0, 0.0)));
+    EXPECT_FALSE(linReg.update(Model::Features{{1.0, 0.0}}, computeOutput(1.0, 0.0)));
+    EXPECT_TRUE(linReg.update(Model::Features{{0.0, 1.0}}, computeOutput(0.0, 1.0)));
+
+    // Add the remaining samples, expect the exact parameters.
+    for (std::size_t i{}; i < trainIn.size(); ++i) { linReg.update(trainIn[i], trainOut[i]); }
+    EXPECT_NEAR(2.0, linReg.weights()[0U], 1e-9);
+    EXPECT_NEAR(-3.0, linReg.weights()[1U], 1e-9);
+    EXPECT_NEAR(1.0, linReg.bias(), 1e-9);
+}
+
+/**
+ * @brief Multivariate online update after gradient descent test.
+ * 
+ *        Verify that online updates refine a model trained with gradient descent instead of
+ *        replacing its parameters with a fit to the new samples only.
+ */
+TEST(LinRegMultivariate, OnlineUpdateAfterGradientDescent)
+{
+    container::Vector<Model::Features> trainIn{};
+    Matrix2d trainOut{};
+    createTrainingData(trainIn, trainOut);
+
+    Model linReg{};
+    ASSERT_TRUE(linReg.train(trainIn, trainOut, 20000U, 0.1, 16U));
+
+    // Case 1 - Add three independent samples offset by 0.5, which alone would determine 
+    //          the bias 1.5. Expect the weights to be kept and the bias to move towards the
+    //          new samples only partially.
+    {
+        EXPECT_TRUE(linReg.update(Model::Features{{0.0, 0.0}}, computeOutput(0.0, 0.0) + 0.5));
+        EXPECT_TRUE(linReg.update(Model::Features{{1.0, 0.0}}, computeOutput(1.0, 0.0) + 0.5));
+        EXPECT_TRUE(linReg.update(Model::Features{{0.0, 1.0}}, computeOutput(0.0, 1.0) + 0.5));
+        EXPECT_NEAR(2.0, linReg.weights()[0U], 0.1);
+        EXPECT_NEAR(-3.0, linReg.weights()[1U], 0.1);
+        EXPECT_LT(1.0, linReg.bias());
+        EXPECT_GT(1.5, linReg.bias());
+    }
+
+    // Case 2 - Keep adding samples offset by 0.5, expect the bias to converge towards 1.5.
+    {
+        for (std::size_t i{}; i < 100U; ++i)
+        {
+            for (std::size_t j{}; j < trainIn.size(); ++j) 
+            { 
+                linReg.update(trainIn[j], trainOut[j] + 0.5); 
+            }
+        }
+        EXPECT_NEAR(2.0, linReg.weights()[0U], 0.02);
+        EXPECT_NEAR(-3.0, linReg.weights()[1U], 0.02);
+        EXPECT_NEAR(1.5, linReg.bias(), 0.02);
+    }
+}
+
+/**
+ * @brief Polynomial regression test.
+ * 
+ *        Verify that a polynomial model learns a non-linear relation via its interface.
+ */
+TEST(LinRegPolynomial, HappyPath)
+{
+    // Training data to teach the model to predict y = 0.5x^2 - 2x + 3.
+    Matrix1d trainIn{};
+    Matrix2d trainOut{};
+    for (double x{-2.0}; x <= 2.0; x += 0.5)
+    {
+        trainIn.pushBack(x);
+        trainOut.pushBack(0.5 * x * x - 2.0 * x + 3.0);
+    }
+
+    // Case 1 - Train with the normal equations, expect the exact coefficients.
+    {
+        lin_reg::Polynomial<2U> model{};
+        lin_reg::Interface& linReg{model};
+        EXPECT_FALSE(linReg.isTrained());
+        EXPECT_TRUE(model.trainClosedForm(trainIn, trainOut));
+        EXPECT_TRUE(linReg.isTrained());
+        EXPECT_NEAR(-2.0, model.coefficients()[0U], 1e-9);
+        EXPECT_NEAR(0.5, model.coefficients()[1U], 1e-9);
+        EXPECT_NEAR(3.0, model.constant(), 1e-9);
+        EXPECT_NEAR(9.0, linReg.predict(6.0), 1e-9);
+
+        // Expect the training to fail without training sets.
+        EXPECT_FALSE(model.trainClosedForm(Matrix1d{}, trainOut));
+    }
+
+    // Case 2 - Train with mini-batch gradient descent, expect approximate predictions.
+    {
+        lin_reg::Polynomial<2U> model{};
+        EXPECT_TRUE(model.train(trainIn, trainOut, 5000U, 0.05, 3U));
+        for (std::size_t i{}; i < trainIn.size(); ++i)
+        {
+            EXPECT_NEAR(trainOut[i], model.predict(trainIn[i]), 1e-3);
+        }
+    }
+
+    // Case 3 - Update online via the interface, expect the model to be trained after three 
+    //          different inputs.
+    {
+        lin_reg::Polynomial<2U> model{};
+        lin_reg::Interface& linReg{model};
+        EXPECT_FALSE(linReg.update(trainIn[0U], trainOut[0U]));
+        EXPECT_FALSE(linReg.update(trainIn[1U], trainOut[1U]));
+        EXPECT_TRUE(linReg.update(trainIn[2U], trainOut[2U]));
+        EXPECT_NEAR(9.0, linReg.predict(6.0), 1e-9);
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,127 @@
+/**
+ * @brief Unit tests for the small matrix implementation.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "ml/matrix.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/**
+ * @brief Matrix storage test.
+ * 
+ *        Verify that the elements are stored contiguously in row-major order.
+ */
+TEST(Matrix, Storage)
+{
+    // Create a 2x3 matrix, expect the dimensions to be correct.
+    Matrix<2U, 3U> matrix{{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}};
+    EXPECT_EQ(2U, matrix.rows());
+    EXPECT_EQ(3U, matrix.columns());
+    EXPECT_EQ(6U, matrix.size());
+    EXPECT_EQ(6U * sizeof(double), sizeof(matrix));
+
+    // Expect element (r, c) to be located at index r * 3 + c.
+    for (std::size_t row{}; row < matrix.rows(); ++row)
+    {
+        for (std::size_t column{}; column < matrix.columns(); ++column)
+        {
+            const std::size_t index{row * matrix.columns() + column};
+            EXPECT_DOUBLE_EQ(static_cast<double>(index + 1U), matrix(row, column));
+            EXPECT_EQ(&matrix[index], &matrix(row, column));
+            EXPECT_EQ(matrix.data() + index, &matrix(row, column));
+        }
+    }
+
+    // Expect the matrix to be cleared.
+    matrix.clear();
+    for (std::size_t i{}; i < matrix.size(); ++i) { EXPECT_EQ(0.0, matrix[i]); }
+}
+
+/**
+ * @brief Matrix arithmetic test.
+ * 
+ *        Verify that transposition, multiplication and addition work as intended.
+ */
+TEST(Matrix, Arithmetic)
+{
+    const Matrix<2U, 3U> a{{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}};
+    const Matrix<3U, 2U> b{{7.0, 8.0, 9.0, 10.0, 11.0, 12.0}};
+
+    // Case 1 - Transpose the matrix.
+    {
+        const auto transposed{a.transpose()};
+        EXPECT_EQ(3U, transposed.rows());
+        EXPECT_EQ(2U, transposed.columns());
+        EXPECT_DOUBLE_EQ(a(0U, 2U), transposed(2U, 0U));
+        EXPECT_DOUBLE_EQ(a(1U, 0U), transposed(0U, 1U));
+    }
+
+    // Case 2 - Multiply the matrices.
+    {
+        const auto product{a * b};
+        EXPECT_EQ(2U, product.rows());
+        EXPECT_EQ(2U, product.columns());
+        EXPECT_DOUBLE_EQ(58.0, product(0U, 0U));
+        EXPECT_DOUBLE_EQ(64.0, product(0U, 1U));
+        EXPECT_DOUBLE_EQ(139.0, product(1U, 0U));
+        EXPECT_DOUBLE_EQ(154.0, product(1U, 1U));
+    }
+
+    // Case 3 - Add and scale the matrix.
+    {
+        Matrix<2U, 3U> sum{a};
+        sum += a;
+        sum *= 0.5;
+        for (std::size_t i{}; i < sum.size(); ++i) { EXPECT_DOUBLE_EQ(a[i], sum[i]); }
+    }
+
+    // Case 4 - Compute inner products of different lengths (with and without remainder).
+    {
+        const double x[]{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+        EXPECT_DOUBLE_EQ(14.0, dotProduct<3U>(x, x));
+        EXPECT_DOUBLE_EQ(30.0, dotProduct<4U>(x, x));
+        EXPECT_DOUBLE_EQ(140.0, dotProduct<7U>(x, x));
+    }
+}
+
+/**
+ * @brief Linear equation system test.
+ * 
+ *        Verify that linear equation systems are solved and singular systems are detected.
+ */
+TEST(Matrix, Solve)
+{
+    // Case 1 - Solve a system that requires pivoting (the first pivot is zero).
+    {
+        const Matrix<3U, 3U> a{{0.0, 2.0, 1.0, 
+                                1.0, 1.0, 1.0, 
+                                2.0, 1.0, 3.0}};
+        const Matrix<3U> expected{{1.0, -2.0, 3.0}};
+        const auto b{a * expected};
+
+        Matrix<3U> x{};
+        EXPECT_TRUE(solve(a, b, x));
+        for (std::size_t i{}; i < x.size(); ++i) { EXPECT_NEAR(expected[i], x[i], 1e-12); }
+    }
+
+    // Case 2 - Expect a singular system to be detected and the solution to be unchanged.
+    {
+        const Matrix<2U, 2U> a{{1.0, 2.0, 2.0, 4.0}};
+        const Matrix<2U> b{{3.0, 6.0}};
+        Matrix<2U> x{{5.0, 5.0}};
+        EXPECT_FALSE(solve(a, b, x));
+        EXPECT_EQ(5.0, x[0U]);
+        EXPECT_EQ(5.0, x[1U]);
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,94 @@
+/**
+ * @brief Unit tests for the event queue.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "scheduler/event_queue.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace scheduler
+{
+namespace
+{
+/**
+ * @brief Event queue priority test.
+ * 
+ *        Verify that events are popped in priority order and only handled once.
+ */
+TEST(Scheduler_EventQueue, Priority)
+{
+    EventQueue queue{};
+    EXPECT_TRUE(queue.isEmpty());
+
+    // Case 1 - Verify that invalid events are rejected.
+    EXPECT_FALSE(queue.post(EventQueue::MaxEventCount));
+    EXPECT_FALSE(queue.isPending(EventQueue::MaxEventCount));
+    EXPECT_TRUE(queue.isEmpty());
+
+    // Case 2 - Post events in reverse priority order, expect them to be popped by priority.
+    EXPECT_TRUE(queue.post(15U));
+    EXPECT_TRUE(queue.post(7U));
+    EXPECT_TRUE(queue.post(3U));
+    EXPECT_TRUE(queue.post(7U));
+    EXPECT_FALSE(queue.isEmpty());
+    EXPECT_TRUE(queue.isPending(7U));
+
+    std::uint8_t event{};
+    EXPECT_TRUE(queue.pop(event));
+    EXPECT_EQ(3U, event);
+
+    // Expect an event with higher priority posted meanwhile to be handled next.
+    EXPECT_TRUE(queue.post(0U));
+    EXPECT_TRUE(queue.pop(event));
+    EXPECT_EQ(0U, event);
+
+    // Expect the event posted twice to only be popped once.
+    EXPECT_TRUE(queue.pop(event));
+    EXPECT_EQ(7U, event);
+    EXPECT_FALSE(queue.isPending(7U));
+    EXPECT_TRUE(queue.pop(event));
+    EXPECT_EQ(15U, event);
+    EXPECT_FALSE(queue.pop(event));
+    EXPECT_TRUE(queue.isEmpty());
+
+    // Case 3 - Verify that the queue can be cleared.
+    EXPECT_TRUE(queue.post(1U));
+    queue.clear();
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+/**
+ * @brief Event queue sleep test.
+ * 
+ *        Verify that the CPU is put in idle sleep mode and that interrupts are enabled afterwards.
+ */
+TEST(Scheduler_EventQueue, Sleep)
+{
+    EventQueue queue{};
+
+    // Verify that interrupts are enabled after waiting, and that the sleep mode is cleared.
+    utils::globalInterruptDisable();
+    queue.waitForEvent();
+    EXPECT_TRUE(utils::read(SREG, I_FLAG));
+    EXPECT_EQ(0U, SMCR);
+
+    // Expect interrupts to be preserved when posting and popping events.
+    utils::globalInterruptDisable();
+    EXPECT_TRUE(queue.post(2U));
+    EXPECT_FALSE(utils::read(SREG, I_FLAG));
+    utils::globalInterruptEnable();
+
+    // Expect waiting to return immediately when events are pending.
+    queue.waitForEvent();
+    EXPECT_TRUE(utils::read(SREG, I_FLAG));
+    EXPECT_TRUE(queue.isPending(2U));
+}
+} // namespace
+} // namespace scheduler
+
+#endif /** TESTSUITE */
@@ -0,0 +1,183 @@
+/**
+ * @brief Unit tests for the sleep-mode power manager.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/timer/system_time.h"
+#include "scheduler/event_queue.h"
+#include "scheduler/power_manager.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace scheduler
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+void clearPeripheralRegisters() noexcept
+{
+    TCCR0B = 0U;
+    TCCR1B = 0U;
+    TCCR2B = 0U;
+    ASSR   = 0U;
+    ADCSRA = 0U;
+    UCSR0A = 0U;
+    UCSR0B = 0U;
+    SPCR   = 0U;
+    TWCR   = 0U;
+    EIMSK  = 0U;
+    EICRA  = 0U;
+    PRR    = 0U;
+    SMCR   = 0U;
+}
+
+/**
+ * @brief Sleep mode selection test.
+ *
+ *        Verify that the deepest sleep mode is selected that keeps all active peripherals running.
+ */
+TEST(Scheduler_PowerManager, SleepModeSelection)
+{
+    clearPeripheralRegisters();
+    const PowerManager powerManager{};
+
+    // Case 1 - Verify that power-down mode is used when no peripherals are active.
+    EXPECT_EQ(PowerState::PowerDown, powerManager.deepestSleepMode());
+
+    // Case 2 - Verify that ADC noise reduction mode is used during ADC conversions.
+    utils::set(ADCSRA, ADEN, ADSC);
+    EXPECT_EQ(PowerState::AdcNoiseReduction, powerManager.deepestSleepMode());
+    utils::clear(ADCSRA, ADSC);
+    EXPECT_EQ(PowerState::PowerDown, powerManager.deepestSleepMode());
+
+    // Case 3 - Verify that Timer 2 requires idle mode unless clocked asynchronously.
+    utils::set(TCCR2B, CS22);
+    EXPECT_EQ(PowerState::Idle, powerManager.deepestSleepMode());
+    utils::set(ASSR, AS2);
+    EXPECT_EQ(PowerState::PowerSave, powerManager.deepestSleepMode());
+    TCCR2B = 0U;
+
+    // Case 4 - Verify that synchronously clocked timers require idle mode.
+    utils::set(TCCR0B, CS00);
+    EXPECT_EQ(PowerState::Idle, powerManager.deepestSleepMode());
+    TCCR0B = 0U;
+    utils::set(TCCR1B, CS11);
+    EXPECT_EQ(PowerState::Idle, powerManager.deepestSleepMode());
+    TCCR1B = 0U;
+
+    // Case 5 - Verify that the USART requires idle mode when receiving or transmitting.
+    utils::set(UCSR0B, RXEN0);
+    EXPECT_EQ(PowerState::Idle, powerManager.deepestSleepMode());
+    UCSR0B = (1U << TXEN0);
+    EXPECT_EQ(PowerState::Idle, powerManager.deepestSleepMode());
+    utils::set(UCSR0A, TXC0);
+    EXPECT_EQ(PowerState::PowerDown, powerManager.deepestSleepMode());
+
+    // Case 6 - Verify that SPI and edge-triggered external interrupts require idle mode.
+    utils::set(SPCR, SPE);
+    EXPECT_EQ(PowerState::Idle, powerManager.deepestSleepMode());
+    SPCR = 0U;
+    utils::set(EIMSK, INT1);
+    EXPECT_EQ(PowerState::PowerDown, powerManager.deepestSleepMode());
+    utils::set(EICRA, ISC11);
+    EXPECT_EQ(PowerState::Idle, powerManager.deepestSleepMode());
+    clearPeripheralRegisters();
+}
+
+/**
+ * @brief Power reduction test.
+ *
+ *        Verify that unused peripherals are powered down while sleeping only.
+ */
+TEST(Scheduler_PowerManager, PowerReduction)
+{
+    clearPeripheralRegisters();
+    PowerManager powerManager{};
+
+    // Case 1 - Expect all peripherals to be unused.
+    constexpr std::uint8_t allPeripherals{(1U << PRTWI) | (1U << PRTIM2) | (1U << PRTIM0)
+        | (1U << PRTIM1) | (1U << PRSPI) | (1U << PRUSART0) | (1U << PRADC)};
+    EXPECT_EQ(allPeripherals, powerManager.unusedPeripherals());
+
+    // Case 2 - Enable the ADC, the USART and Timer 1, expect them to be powered.
+    utils::set(ADCSRA, ADEN);
+    utils::set(UCSR0B, TXEN0);
+    utils::set(TCCR1B, CS10);
+    constexpr std::uint8_t unused{(1U << PRTWI) | (1U << PRTIM2) | (1U << PRTIM0)
+        | (1U << PRSPI)};
+    EXPECT_EQ(unused, powerManager.unusedPeripherals());
+
+    // Case 3 - Sleep, expect the power reduction bits and the sleep mode to be restored
+    // afterwards and interrupts to be enabled.
+    utils::globalInterruptDisable();
+    powerManager.sleep();
+    EXPECT_EQ(0U, PRR);
+    EXPECT_EQ(0U, SMCR);
+    EXPECT_TRUE(utils::read(SREG, I_FLAG));
+
+    // Case 4 - Expect power reduction bits set by the application to be kept.
+    PRR = (1U << PRTWI);
+    utils::globalInterruptDisable();
+    powerManager.sleep();
+    EXPECT_EQ((1U << PRTWI), PRR);
+    clearPeripheralRegisters();
+}
+
+/**
+ * @brief Statistics test.
+ *
+ *        Verify that the transitions to and the time spent in each power state are recorded.
+ */
+TEST(Scheduler_PowerManager, Statistics)
+{
+    clearPeripheralRegisters();
+
+    // Case 1 - Sleep via the event queue without a system time service.
+    // Expect the transitions to be counted, but no time to be measured.
+    {
+        PowerManager powerManager{};
+        EventQueue queue{};
+        queue.waitForEvent(&powerManager);
+        queue.waitForEvent(&powerManager);
+        EXPECT_EQ(2U, powerManager.entryCount(PowerState::PowerDown));
+        EXPECT_EQ(2U, powerManager.entryCount(PowerState::Active));
+        EXPECT_EQ(0U, powerManager.entryCount(PowerState::Idle));
+        EXPECT_EQ(0U, powerManager.timeInState_us(PowerState::Active));
+
+        // Expect the CPU not to sleep if events are pending.
+        EXPECT_TRUE(queue.post(0U));
+        queue.waitForEvent(&powerManager);
+        EXPECT_EQ(2U, powerManager.entryCount(PowerState::PowerDown));
+
+        // Expect invalid states to be ignored and the statistics to be resettable.
+        EXPECT_EQ(0U, powerManager.entryCount(PowerState::Count));
+        powerManager.resetStatistics();
+        EXPECT_EQ(0U, powerManager.entryCount(PowerState::PowerDown));
+    }
+
+    // Case 2 - Sleep with a system time service, expect the CPU to use idle mode due to the
+    // system timer. Expect the active time to be measured.
+    {
+        driver::timer::SystemTime systemTime{};
+        ASSERT_TRUE(systemTime.isInitialized());
+        PowerManager powerManager{&systemTime};
+        EXPECT_EQ(PowerState::Idle, powerManager.deepestSleepMode());
+
+        // Advance the time by one system time period (16 ms).
+        systemTime.handleTimeout();
+        utils::globalInterruptDisable();
+        powerManager.sleep();
+        EXPECT_EQ(1U, powerManager.entryCount(PowerState::Idle));
+        EXPECT_LE(16000U, powerManager.timeInState_us(PowerState::Active));
+        EXPECT_GT(17000U, powerManager.timeInState_us(PowerState::Active));
+    }
+    clearPeripheralRegisters();
+}
+} // namespace
+} // namespace scheduler
+
+#endif /** TESTSUITE */
@@ -0,0 +1,143 @@
+/**
+ * @brief Unit tests for the table-driven state machine.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "scheduler/state_machine.h"
+
+#ifdef TESTSUITE
+
+namespace scheduler
+{
+namespace
+{
+/**
+ * @brief Enumeration of turnstile states.
+ */
+enum class State : std::uint8_t
+{
+    Locked,   // Turnstile locked.
+    Unlocked, // Turnstile unlocked.
+    Count,    // Number of states.
+};
+
+/**
+ * @brief Enumeration of turnstile events.
+ */
+enum class Event : std::uint8_t
+{
+    Coin,  // Coin inserted.
+    Push,  // Turnstile pushed.
+    Count, // Number of events.
+};
+
+/**
+ * @brief Structure of turnstile context.
+ */
+struct Turnstile
+{
+    /** The number of coins inserted while locked. */
+    std::uint16_t coins;
+
+    /** The number of coins inserted while unlocked, i.e. refunded. */
+    std::uint16_t refunds;
+
+    /** The number of passages. */
+    std::uint16_t passages;
+};
+
+/** Turnstile state machine. */
+using Machine = StateMachine<Turnstile, State, Event>;
+
+// -----------------------------------------------------------------------------
+void acceptCoin(Turnstile& turnstile) noexcept { turnstile.coins++; }
+
+// -----------------------------------------------------------------------------
+void refundCoin(Turnstile& turnstile) noexcept { turnstile.refunds++; }
+
+// -----------------------------------------------------------------------------
+void pass(Turnstile& turnstile) noexcept { turnstile.passages++; }
+
+/** Turnstile transition table. */
+constexpr Machine::Table TransitionTable
+{
+    // State::Locked
+    {
+        {State::Unlocked, &acceptCoin}, // Event::Coin
+        {State::Locked, nullptr},       // Event::Push
+    },
+    // State::Unlocked
+    {
+        {State::Unlocked, &refundCoin}, // Event::Coin
+        {State::Locked, &pass},         // Event::Push
+    },
+};
+
+// Verify that the transition table can be validated at compile time.
+static_assert(Machine::isValid(TransitionTable), "Invalid transition table!");
+
+/**
+ * @brief State machine dispatch test.
+ *
+ *        Verify that events cause the transitions and actions specified in the table.
+ */
+TEST(Scheduler_StateMachine, Dispatch)
+{
+    Turnstile turnstile{};
+    Machine machine{TransitionTable, turnstile, State::Locked};
+    EXPECT_EQ(State::Locked, machine.state());
+
+    // Case 1 - Push the locked turnstile, expect the event to be ignored.
+    EXPECT_FALSE(machine.dispatch(Event::Push));
+    EXPECT_EQ(State::Locked, machine.state());
+    EXPECT_EQ(0U, turnstile.passages);
+
+    // Case 2 - Insert a coin, expect the turnstile to be unlocked.
+    EXPECT_TRUE(machine.dispatch(Event::Coin));
+    EXPECT_EQ(State::Unlocked, machine.state());
+    EXPECT_EQ(1U, turnstile.coins);
+
+    // Case 3 - Insert another coin, expect the coin to be refunded without state change.
+    EXPECT_TRUE(machine.dispatch(Event::Coin));
+    EXPECT_EQ(State::Unlocked, machine.state());
+    EXPECT_EQ(1U, turnstile.coins);
+    EXPECT_EQ(1U, turnstile.refunds);
+
+    // Case 4 - Push the turnstile, expect a passage and the turnstile to be locked.
+    EXPECT_TRUE(machine.dispatch(Event::Push));
+    EXPECT_EQ(State::Locked, machine.state());
+    EXPECT_EQ(1U, turnstile.passages);
+
+    // Case 5 - Verify that invalid events and states are ignored.
+    EXPECT_FALSE(machine.dispatch(Event::Count));
+    machine.setState(State::Count);
+    EXPECT_EQ(State::Locked, machine.state());
+
+    // Case 6 - Set the state directly, expect no action to be performed.
+    machine.setState(State::Unlocked);
+    EXPECT_EQ(State::Unlocked, machine.state());
+    EXPECT_EQ(1U, turnstile.coins);
+    EXPECT_EQ(1U, turnstile.passages);
+}
+
+/**
+ * @brief Transition table validation test.
+ *
+ *        Verify that transition tables containing invalid states are detected.
+ */
+TEST(Scheduler_StateMachine, Validation)
+{
+    constexpr Machine::Table invalidTable
+    {
+        {{State::Unlocked, nullptr}, {State::Locked, nullptr}},
+        {{State::Count, nullptr}, {State::Locked, nullptr}},
+    };
+    EXPECT_TRUE(Machine::isValid(TransitionTable));
+    EXPECT_FALSE(Machine::isValid(invalidTable));
+}
+} // namespace
+} // namespace scheduler
+
+#endif /** TESTSUITE */
@@ -0,0 +1,151 @@
+/**
+ * @brief Unit tests for the watchdog supervisor.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/stub.h"
+#include "driver/timer/system_time.h"
+#include "driver/watchdog/stub.h"
+#include "scheduler/supervisor.h"
+
+#ifdef TESTSUITE
+
+namespace scheduler
+{
+namespace
+{
+/** Time between each system time update in ms. */
+constexpr std::uint32_t SystemTimePeriod_ms{16U};
+
+// -----------------------------------------------------------------------------
+void advanceTime(driver::timer::SystemTime& systemTime, const std::uint32_t time_ms) noexcept
+{
+    for (std::uint32_t i{}; i < time_ms / SystemTimePeriod_ms; ++i) { systemTime.handleTimeout(); }
+}
+
+/**
+ * @brief Task supervision test.
+ *
+ *        Verify that the watchdog is only reset while all tasks check in before their deadlines.
+ */
+TEST(Scheduler_Supervisor, Supervision)
+{
+    driver::watchdog::Stub watchdog{};
+    driver::timer::SystemTime systemTime{};
+    ASSERT_TRUE(systemTime.isInitialized());
+    Supervisor supervisor{watchdog, systemTime};
+    ASSERT_TRUE(supervisor.isInitialized());
+
+    // Expect only one supervisor to be used at a time.
+    {
+        Supervisor other{watchdog, systemTime};
+        EXPECT_FALSE(other.isInitialized());
+        EXPECT_EQ(-1, other.addTask(100U));
+    }
+
+    // Register a fast and a slow task.
+    const std::int8_t fastTask{supervisor.addTask(10U * SystemTimePeriod_ms)};
+    const std::int8_t slowTask{supervisor.addTask(50U * SystemTimePeriod_ms)};
+    ASSERT_EQ(0, fastTask);
+    ASSERT_EQ(1, slowTask);
+    EXPECT_EQ(2U, supervisor.taskCount());
+
+    // Case 1 - Let both tasks check in regularly, expect the watchdog to be reset each time.
+    for (std::uint8_t i{}; i < 20U; ++i)
+    {
+        advanceTime(systemTime, 5U * SystemTimePeriod_ms);
+        supervisor.checkIn(fastTask);
+        supervisor.checkIn(slowTask);
+        EXPECT_TRUE(supervisor.service());
+    }
+    EXPECT_EQ(20U, watchdog.resetCount());
+    EXPECT_EQ(-1, supervisor.overdueTask());
+
+    // Case 2 - Stop checking in the fast task, expect the watchdog not to be reset once the
+    //          deadline of the fast task has passed.
+    advanceTime(systemTime, 11U * SystemTimePeriod_ms);
+    supervisor.checkIn(slowTask);
+    EXPECT_EQ(fastTask, supervisor.overdueTask());
+    EXPECT_FALSE(supervisor.service());
+    EXPECT_EQ(20U, watchdog.resetCount());
+
+    // Case 3 - Let the fast task check in again, expect the watchdog to be reset again.
+    supervisor.checkIn(fastTask);
+    EXPECT_TRUE(supervisor.service());
+    EXPECT_EQ(21U, watchdog.resetCount());
+
+    // Case 4 - Verify that check-ins of invalid tasks are ignored.
+    supervisor.checkIn(Supervisor::MaxTaskCount);
+    EXPECT_EQ(-1, supervisor.overdueTask());
+}
+
+/**
+ * @brief Failure record test.
+ *
+ *        Verify that the overdue task and the uptime are stored in EEPROM on watchdog timeout.
+ */
+TEST(Scheduler_Supervisor, FailureRecord)
+{
+    constexpr std::uint16_t recordAddr{8U};
+    driver::watchdog::Stub watchdog{};
+    driver::eeprom::Stub<32U> eeprom{};
+    driver::timer::SystemTime systemTime{};
+    ASSERT_TRUE(systemTime.isInitialized());
+
+    std::uint8_t task{};
+    std::uint32_t uptime_ms{};
+
+    // Limit the scope of the supervisor.
+    {
+        Supervisor supervisor{watchdog, systemTime, &eeprom, recordAddr};
+        supervisor.clearRecord();
+        EXPECT_FALSE(supervisor.readRecord(task, uptime_ms));
+
+        // Case 1 - Time out without overdue tasks, expect no task to be recorded.
+        (void) (supervisor.addTask(SystemTimePeriod_ms));
+        const std::int8_t slowTask{supervisor.addTask(100U * SystemTimePeriod_ms)};
+        watchdog.simulateTimeout();
+        ASSERT_TRUE(supervisor.readRecord(task, uptime_ms));
+        EXPECT_EQ(Supervisor::NoTask, task);
+
+        // Case 2 - Let the second task miss its deadline, expect it to be recorded along with
+        //          the uptime on timeout.
+        advanceTime(systemTime, 101U * SystemTimePeriod_ms);
+        supervisor.checkIn(0U);
+        watchdog.simulateTimeout();
+        ASSERT_TRUE(supervisor.readRecord(task, uptime_ms));
+        EXPECT_EQ(slowTask, static_cast<std::int8_t>(task));
+        EXPECT_LE(101U * SystemTimePeriod_ms, uptime_ms);
+
+        // Case 3 - Service the watchdog while the second task is still overdue, expect the
+        //          record to be kept.
+        EXPECT_FALSE(supervisor.service());
+        EXPECT_TRUE(supervisor.readRecord(task, uptime_ms));
+
+        // Case 4 - Let the second task recover before the system is reset, expect the record
+        //          to be cleared once the watchdog is serviced.
+        supervisor.checkIn(static_cast<std::uint8_t>(slowTask));
+        EXPECT_TRUE(supervisor.service());
+        EXPECT_FALSE(supervisor.readRecord(task, uptime_ms));
+
+        // Case 5 - Let the second task miss its deadline again, expect it to be recorded.
+        advanceTime(systemTime, 101U * SystemTimePeriod_ms);
+        supervisor.checkIn(0U);
+        watchdog.simulateTimeout();
+        ASSERT_TRUE(supervisor.readRecord(task, uptime_ms));
+        EXPECT_EQ(slowTask, static_cast<std::int8_t>(task));
+    }
+
+    // Case 6 - Verify that the record survives the supervisor, i.e. a restart, until cleared.
+    Supervisor supervisor{watchdog, systemTime, &eeprom, recordAddr};
+    ASSERT_TRUE(supervisor.readRecord(task, uptime_ms));
+    EXPECT_EQ(1U, task);
+    supervisor.clearRecord();
+    EXPECT_FALSE(supervisor.readRecord(task, uptime_ms));
+}
+} // namespace
+} // namespace scheduler
+
+#endif /** TESTSUITE */
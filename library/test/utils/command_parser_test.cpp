@@ -0,0 +1,224 @@
+/**
+ * @brief Unit tests for the command line tokenizer and command parser.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "utils/command_parser.h"
+
+#ifdef TESTSUITE
+
+namespace utils
+{
+namespace
+{
+/**
+ * @brief Structure of test context.
+ */
+struct Context
+{
+    /** The last value set via command "set value". */
+    std::uint32_t value;
+
+    /** The number of times command "dump" has been executed. */
+    std::uint16_t dumps;
+
+    /** The number of times command "dump all" has been executed. */
+    std::uint16_t fullDumps;
+};
+
+/** Command parser used for testing. */
+using Parser = CommandParser<Context>;
+
+// -----------------------------------------------------------------------------
+bool dump(Context& context, const Tokens&) noexcept
+{
+    context.dumps++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool dumpAll(Context& context, const Tokens&) noexcept
+{
+    context.fullDumps++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool setValue(Context& context, const Tokens& args) noexcept
+{
+    return args.toUint32(0U, context.value);
+}
+
+/** Command table sorted by name, placed in program memory. */
+constexpr Parser::Command Commands[] PROGMEM
+{
+    {"dump", "", "dump a single value", 0U, &dump},
+    {"dump-all", "", "dump all values", 0U, &dumpAll},
+    {"set value", "<value>", "set the value", 1U, &setValue},
+};
+
+// Verify that the command table can be validated at compile time.
+static_assert(Parser::isValid(Commands), "Invalid command table!");
+
+/**
+ * @brief Tokenizer test.
+ *
+ *        Verify that command lines are split into whitespace-separated tokens in place.
+ */
+TEST(Utils_CommandParser, Tokenizer)
+{
+    // Case 1 - Verify that leading, trailing and repeated whitespace is ignored.
+    {
+        char line[]{"  set\ttoggle   250 \r\n"};
+        const Tokens tokens{line};
+        ASSERT_EQ(3U, tokens.count());
+        EXPECT_STREQ("set", tokens[0U]);
+        EXPECT_STREQ("toggle", tokens[1U]);
+        EXPECT_STREQ("250", tokens[2U]);
+        EXPECT_EQ(nullptr, tokens[3U]);
+        EXPECT_FALSE(tokens.isTruncated());
+
+        // Expect the tokens to point into the line.
+        EXPECT_EQ(&line[2U], tokens[0U]);
+
+        // Expect the tail to contain the arguments.
+        const Tokens args{tokens.tail(2U)};
+        ASSERT_EQ(1U, args.count());
+        EXPECT_STREQ("250", args[0U]);
+    }
+
+    // Case 2 - Verify that empty lines result in no tokens.
+    {
+        char line[]{" \t "};
+        EXPECT_EQ(0U, Tokens{line}.count());
+        EXPECT_EQ(0U, Tokens{nullptr}.count());
+    }
+
+    // Case 3 - Verify that lines containing too many tokens are truncated.
+    {
+        char line[]{"1 2 3 4 5 6 7 8 9"};
+        const Tokens tokens{line};
+        EXPECT_EQ(Tokens::MaxCount, tokens.count());
+        EXPECT_TRUE(tokens.isTruncated());
+    }
+
+    // Case 4 - Verify number conversion.
+    {
+        char line[]{"0 4294967295 4294967296 12a"};
+        const Tokens tokens{line};
+        std::uint32_t value{1U};
+        EXPECT_TRUE(tokens.toUint32(0U, value));
+        EXPECT_EQ(0U, value);
+        EXPECT_TRUE(tokens.toUint32(1U, value));
+        EXPECT_EQ(UINT32_MAX, value);
+        EXPECT_FALSE(tokens.toUint32(2U, value));
+        EXPECT_FALSE(tokens.toUint32(3U, value));
+        EXPECT_FALSE(tokens.toUint32(4U, value));
+        EXPECT_EQ(UINT32_MAX, value);
+    }
+}
+
+/**
+ * @brief Command execution test.
+ *
+ *        Verify that command lines are dispatched to the matching command handlers.
+ */
+TEST(Utils_CommandParser, Execute)
+{
+    Context context{};
+    const Parser parser{Commands, context};
+    EXPECT_EQ(3U, parser.commandCount());
+    Parser::Command command{};
+    ASSERT_TRUE(parser.command(0U, command));
+    EXPECT_STREQ("dump", command.name);
+    EXPECT_STREQ("dump a single value", command.description);
+    ASSERT_TRUE(parser.command(2U, command));
+    EXPECT_STREQ("<value>", command.args);
+    EXPECT_EQ(1U, command.argCount);
+    EXPECT_FALSE(parser.command(3U, command));
+
+    // Case 1 - Verify that commands with and without arguments are executed.
+    {
+        char line1[]{"dump"};
+        char line2[]{"dump-all"};
+        char line3[]{"set value 250"};
+        EXPECT_EQ(CommandResult::Success, parser.execute(line1));
+        EXPECT_EQ(CommandResult::Success, parser.execute(line2));
+        EXPECT_EQ(CommandResult::Success, parser.execute(line3));
+        EXPECT_EQ(1U, context.dumps);
+        EXPECT_EQ(1U, context.fullDumps);
+        EXPECT_EQ(250U, context.value);
+    }
+
+    // Case 2 - Verify that unknown commands and partial names aren't executed.
+    {
+        char line1[]{"dum"};
+        char line2[]{"set"};
+        char line3[]{"set values 1"};
+        char line4[]{"reset"};
+        EXPECT_EQ(CommandResult::UnknownCommand, parser.execute(line1));
+        EXPECT_EQ(CommandResult::UnknownCommand, parser.execute(line2));
+        EXPECT_EQ(CommandResult::UnknownCommand, parser.execute(line3));
+        EXPECT_EQ(CommandResult::UnknownCommand, parser.execute(line4));
+    }
+
+    // Case 3 - Verify that the number of arguments is checked.
+    {
+        char line1[]{"set value"};
+        char line2[]{"set value 1 2"};
+        char line3[]{"dump 1"};
+        EXPECT_EQ(CommandResult::InvalidArguments, parser.execute(line1));
+        EXPECT_EQ(CommandResult::InvalidArguments, parser.execute(line2));
+        EXPECT_EQ(CommandResult::InvalidArguments, parser.execute(line3));
+        EXPECT_EQ(1U, context.dumps);
+    }
+
+    // Case 4 - Verify that failing handlers and empty lines are reported.
+    {
+        char line1[]{"set value abc"};
+        char line2[]{"   "};
+        EXPECT_EQ(CommandResult::Failed, parser.execute(line1));
+        EXPECT_EQ(CommandResult::Empty, parser.execute(line2));
+        EXPECT_EQ(250U, context.value);
+    }
+}
+
+/**
+ * @brief Command table validation test.
+ *
+ *        Verify that unsorted tables and ambiguous names are detected.
+ */
+TEST(Utils_CommandParser, Validation)
+{
+    constexpr Parser::Command unsorted[]
+    {
+        {"set value", "<value>", "set the value", 1U, &setValue},
+        {"dump", "", "dump a single value", 0U, &dump},
+    };
+    constexpr Parser::Command duplicates[]
+    {
+        {"dump", "", "dump a single value", 0U, &dump},
+        {"dump", "", "dump all values", 0U, &dumpAll},
+    };
+    constexpr Parser::Command ambiguous[]
+    {
+        {"dump", "", "dump a single value", 0U, &dump},
+        {"dump all", "", "dump all values", 0U, &dumpAll},
+    };
+    constexpr Parser::Command missingHandler[]
+    {
+        {"dump", "", "dump a single value", 0U, nullptr},
+    };
+    EXPECT_FALSE(Parser::isValid(unsorted));
+    EXPECT_FALSE(Parser::isValid(duplicates));
+    EXPECT_FALSE(Parser::isValid(ambiguous));
+    EXPECT_FALSE(Parser::isValid(missingHandler));
+    EXPECT_TRUE(Parser::isValid(Commands));
+}
+} // namespace
+} // namespace utils
+
+#endif /** TESTSUITE */